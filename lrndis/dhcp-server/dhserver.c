@@ -23,6 +23,9 @@
  */
 
 #include "dhserver.h"
+#include "arch/perf.h"
+#include "lwip/sys.h"
+#include <stddef.h>
 
 /* DHCP message type */
 #define DHCP_DISCOVER       1
@@ -64,6 +67,7 @@ enum DHCP_OPTIONS
 	DHCP_CLASSID                = 60,
 	DHCP_CLIENTID               = 61,
 	DHCP_USERCLASS              = 77,  /* RFC 3004 */
+	DHCP_RAPIDCOMMIT            = 80,  /* RFC 4039 */
 	DHCP_FQDN                   = 81,
 	DHCP_DNSSEARCH              = 119, /* RFC 3397 */
 	DHCP_CSR                    = 121, /* RFC 3442 */
@@ -87,227 +91,552 @@ typedef struct
     uint8_t  dp_chaddr[16];   /* client hardware address */
     uint8_t  dp_legacy[192];
     uint8_t  dp_magic[4];     
-    uint8_t  dp_options[275]; /* options area */
+    /* options follow */
 } DHCP_TYPE;
 
-DHCP_TYPE dhcp_data;
+#define DHCP_MESSAGE_MAX 548 /* message size every client accepts, RFC 2131 */
+#define DHCP_OPTIONS_MAX (DHCP_MESSAGE_MAX - sizeof(DHCP_TYPE)) /* options area of a reply after the magic */
+#define DHCP_MIN_SIZE    300 /* BOOTP minimum message size, RFC 1542 */
+
 static struct udp_pcb *pcb = NULL;
 static dhcp_config_t *config = NULL;
 
 char magic_cookie[] = {0x63,0x82,0x53,0x63};
 
-static dhcp_entry_t *entry_by_ip(uint32_t ip)
+#define NO_LEASE 0xFFFF
+
+static uint16_t mac_hash[DHSERV_HASH_SIZE]; /* first lease of each chain */
+static uint16_t free_head = NO_LEASE;       /* free list, oldest first */
+static uint16_t free_tail = NO_LEASE;
+static int num_used;                        /* leases covered by pools */
+
+static __inline bool expired(const dhcp_lease_t *lease, uint32_t now)
+{
+	return (int32_t)(lease->expire - now) <= 0;
+}
+
+static int hash_of(const uint8_t *mac)
 {
 	int i;
-	for (i = 0; i < config->num_entry; i++)
-		if (*(uint32_t *)config->entries[i].addr == ip)
-			return &config->entries[i];
-	return NULL;
+	uint32_t h = 2166136261u; /* FNV-1a */
+	for (i = 0; i < 6; i++)
+		h = (h ^ mac[i]) * 16777619u;
+	return h & (DHSERV_HASH_SIZE - 1);
 }
 
-static dhcp_entry_t *entry_by_mac(uint8_t *mac)
+/* lease index of an address in network order, or -1 */
+static int lease_by_ip(uint32_t ip)
+{
+	int i, base;
+	uint32_t offset;
+	base = 0;
+	for (i = 0; i < config->num_pool; i++)
+	{
+		offset = ntohl(ip) - ntohl(*(uint32_t *)config->pools[i].first);
+		if (offset < config->pools[i].size)
+			return base + offset;
+		base += config->pools[i].size;
+	}
+	return -1;
+}
+
+/* pool of a lease and its address in network order */
+static dhcp_pool_t *pool_by_lease(int index, uint32_t *ip)
 {
 	int i;
-	for (i = 0; i < config->num_entry; i++)
-		if (memcmp(config->entries[i].mac, mac, 6) == 0)
-			return &config->entries[i];
+	for (i = 0; i < config->num_pool; i++)
+	{
+		if (index < config->pools[i].size)
+		{
+			*ip = htonl(ntohl(*(uint32_t *)config->pools[i].first) + index);
+			return &config->pools[i];
+		}
+		index -= config->pools[i].size;
+	}
 	return NULL;
 }
 
-static __inline bool is_vacant(dhcp_entry_t *entry)
+static int lease_by_mac(const uint8_t *mac)
+{
+	uint16_t i;
+	for (i = mac_hash[hash_of(mac)]; i != NO_LEASE; i = config->leases[i].next)
+		if (memcmp(config->leases[i].mac, mac, 6) == 0)
+			return i;
+	return -1;
+}
+
+static void hash_insert(int index)
+{
+	int h = hash_of(config->leases[index].mac);
+	config->leases[index].next = mac_hash[h];
+	mac_hash[h] = index;
+}
+
+static void hash_remove(int index)
+{
+	uint16_t *link;
+	link = &mac_hash[hash_of(config->leases[index].mac)];
+	while (*link != NO_LEASE)
+	{
+		if (*link == index)
+		{
+			*link = config->leases[index].next;
+			return;
+		}
+		link = &config->leases[*link].next;
+	}
+}
+
+static void free_push(int index)
+{
+	dhcp_lease_t *lease = &config->leases[index];
+	memset(lease->mac, 0, 6);
+	lease->state = DHCP_LEASE_FREE;
+	lease->next = NO_LEASE;
+	lease->prev = free_tail;
+	if (free_tail != NO_LEASE)
+		config->leases[free_tail].next = index; else
+		free_head = index;
+	free_tail = index;
+}
+
+static void free_remove(int index)
 {
-	return memcmp("\0\0\0\0\0", entry->mac, 6) == 0;
+	dhcp_lease_t *lease = &config->leases[index];
+	if (lease->prev != NO_LEASE)
+		config->leases[lease->prev].next = lease->next; else
+		free_head = lease->next;
+	if (lease->next != NO_LEASE)
+		config->leases[lease->next].prev = lease->prev; else
+		free_tail = lease->prev;
 }
 
-static dhcp_entry_t *vacant_address()
+/* returns an expired or declined lease to the free list */
+static void release_lease(int index)
+{
+	if (config->leases[index].state == DHCP_LEASE_FREE) return;
+	if (config->leases[index].state != DHCP_LEASE_DECLINED)
+		hash_remove(index);
+	free_push(index);
+}
+
+/* called when the free list is empty */
+static void reclaim(uint32_t now)
 {
 	int i;
-	for (i = 0; i < config->num_entry; i++)
-		if (is_vacant(config->entries + i))
-			return config->entries + i;
-	return NULL;
+	for (i = 0; i < num_used; i++)
+		if (config->leases[i].state != DHCP_LEASE_FREE && expired(&config->leases[i], now))
+			release_lease(i);
 }
 
-static __inline void free_entry(dhcp_entry_t *entry)
+static bool is_available(int index, const uint8_t *mac, uint32_t now)
 {
-	memset(entry->mac, 0, 6);
+	dhcp_lease_t *lease = &config->leases[index];
+	switch (lease->state)
+	{
+	case DHCP_LEASE_FREE:
+		return true;
+	case DHCP_LEASE_DECLINED:
+		return expired(lease, now);
+	default:
+		return memcmp(lease->mac, mac, 6) == 0 || expired(lease, now);
+	}
 }
 
-uint8_t *find_dhcp_option(uint8_t *attrs, int size, uint8_t attr)
+/* assigns a lease to mac, mac must not own another lease */
+static void assign_lease(int index, const uint8_t *mac)
 {
-	int i = 0;
-	while ((i + 1) < size)
+	dhcp_lease_t *lease = &config->leases[index];
+	if (lease->state == DHCP_LEASE_FREE)
+		free_remove(index);
+	else if (lease->state != DHCP_LEASE_DECLINED)
 	{
-		int next = i + attrs[i + 1] + 2;
-		if (next > size) return NULL;
-		if (attrs[i] == attr)
-			return attrs + i;
-		i = next;
+		if (memcmp(lease->mac, mac, 6) == 0) return;
+		hash_remove(index);
 	}
-	return NULL;
+	memcpy(lease->mac, mac, 6);
+	lease->state = DHCP_LEASE_OFFERED;
+	hash_insert(index);
 }
 
-int fill_options(void *dest,
-	uint8_t msg_type,
-	const char *domain,
-	uint32_t dns,
-	int lease_time,
-	uint32_t serverid,
-	uint32_t router,
-	uint32_t subnet)
-{
-	uint8_t *ptr = (uint8_t *)dest;
-	/* ACK message type */
-	*ptr++ = 53;
-	*ptr++ = 1;
-	*ptr++ = msg_type;
+/* binds a lease for the lease time of its pool */
+static void bind_lease(int index, const uint8_t *mac, uint32_t now)
+{
+	uint32_t ip;
+	dhcp_lease_t *lease = &config->leases[index];
+	bool renew = lease->state == DHCP_LEASE_BOUND && memcmp(lease->mac, mac, 6) == 0;
+	assign_lease(index, mac);
+	lease->state = DHCP_LEASE_BOUND;
+	lease->expire = now + pool_by_lease(index, &ip)->lease * 1000;
+	if (!renew && config->on_lease != NULL)
+		config->on_lease(index, lease);
+}
 
-	/* dhcp server identifier */
-	*ptr++ = DHCP_SERVERID;
-	*ptr++ = 4;
-	*(uint32_t *)ptr = serverid;
-	ptr += 4;
+static void notify_release(int index)
+{
+	if (config->on_lease != NULL)
+		config->on_lease(index, &config->leases[index]);
+}
 
-	/* lease time */
-	*ptr++ = DHCP_LEASETIME;
+/* lease for DISCOVER: the lease of the client, the requested address or a free one */
+static int offer_lease(const uint8_t *mac, uint32_t requested, uint32_t now)
+{
+	int i;
+	i = lease_by_mac(mac);
+	if (i >= 0) return i;
+	if (requested != 0)
+	{
+		i = lease_by_ip(requested);
+		if (i >= 0 && is_available(i, mac, now)) return i;
+	}
+	if (free_head == NO_LEASE)
+		reclaim(now);
+	if (free_head == NO_LEASE)
+		return -1;
+	return free_head;
+}
+/* Offset of the option value in the request or -1. The options are
+ * parsed in place, so the request may be a pbuf chain. */
+static int find_dhcp_option(struct pbuf *p, uint8_t attr, int *len)
+{
+	int i, n;
+	uint8_t code;
+	i = sizeof(DHCP_TYPE);
+	while (i + 1 < p->tot_len)
+	{
+		code = pbuf_get_at(p, i);
+		if (code == DHCP_END) break;
+		if (code == DHCP_PAD)
+		{
+			i++;
+			continue;
+		}
+		n = pbuf_get_at(p, i + 1);
+		if (i + 2 + n > p->tot_len) break;
+		if (code == attr)
+		{
+			*len = n;
+			return i + 2;
+		}
+		i += 2 + n;
+	}
+	return -1;
+}
+
+/* options sent to clients without a parameter request list */
+static const uint8_t default_options[] =
+{
+	DHCP_ROUTER, DHCP_DNSSERVER, DHCP_DNSDOMAIN
+};
+
+/* addresses of the config are byte arrays without alignment */
+static bool addr_is_zero(const uint8_t *addr)
+{
+	return (addr[0] | addr[1] | addr[2] | addr[3]) == 0;
+}
+
+static uint8_t *put_addr(uint8_t *ptr, uint8_t attr, const uint8_t *addr)
+{
+	*ptr++ = attr;
 	*ptr++ = 4;
-	*ptr++ = (lease_time >> 24) & 0xFF;
-	*ptr++ = (lease_time >> 16) & 0xFF;
-	*ptr++ = (lease_time >> 8) & 0xFF;
-	*ptr++ = (lease_time >> 0) & 0xFF;
+	memcpy(ptr, addr, 4);
+	return ptr + 4;
+}
 
-	/* subnet mask */
-	*ptr++ = DHCP_SUBNETMASK;
+static uint8_t *put_time(uint8_t *ptr, uint8_t attr, uint32_t time)
+{
+	*ptr++ = attr;
 	*ptr++ = 4;
-	*(uint32_t *)ptr = subnet;
-	ptr += 4;
+	*ptr++ = (time >> 24) & 0xFF;
+	*ptr++ = (time >> 16) & 0xFF;
+	*ptr++ = (time >> 8) & 0xFF;
+	*ptr++ = (time >> 0) & 0xFF;
+	return ptr;
+}
 
-	/* router */
-	if (router != 0)
+static uint8_t *put_routes(uint8_t *ptr, uint8_t *end, uint8_t attr, const dhcp_pool_t *pool)
+{
+	int i, n;
+	uint8_t *start = ptr;
+	if (end - ptr < 2) return ptr;
+	*ptr++ = attr;
+	ptr++;
+	for (i = 0; i < pool->num_route; i++)
 	{
-		*ptr++ = DHCP_ROUTER;
-		*ptr++ = 4;
-		*(uint32_t *)ptr = router;
+		n = (pool->routes[i].width + 7) / 8;
+		if (ptr - start - 2 + 1 + n + 4 > 255 || end - ptr < 1 + n + 4) return start;
+		*ptr++ = pool->routes[i].width;
+		memcpy(ptr, pool->routes[i].dest, n);
+		ptr += n;
+		memcpy(ptr, pool->routes[i].router, 4);
 		ptr += 4;
 	}
+	start[1] = ptr - start - 2;
+	return ptr;
+}
 
-	/* domain name */
-	if (domain != NULL)
+/* writes one requested option if it is configured and fits before end */
+static uint8_t *put_option(uint8_t *ptr, uint8_t *end, uint8_t attr, const dhcp_pool_t *pool)
+{
+	int len;
+	switch (attr)
 	{
-		int len = strlen(domain);
-		*ptr++ = DHCP_DNSDOMAIN;
+	case DHCP_ROUTER:
+		if (addr_is_zero(pool->router) || end - ptr < 6) break;
+		return put_addr(ptr, attr, pool->router);
+	case DHCP_DNSSERVER:
+		if (addr_is_zero(config->dns) || end - ptr < 6) break;
+		return put_addr(ptr, attr, config->dns);
+	case DHCP_DNSDOMAIN:
+		if (config->domain == NULL) break;
+		len = strlen(config->domain);
+		if (len > 255 || end - ptr < len + 2) break;
+		*ptr++ = attr;
 		*ptr++ = len;
-		memcpy(ptr, domain, len);
-		ptr += len;
+		memcpy(ptr, config->domain, len);
+		return ptr + len;
+	case DHCP_MTU:
+		if (pool->mtu == 0 || end - ptr < 4) break;
+		*ptr++ = attr;
+		*ptr++ = 2;
+		*ptr++ = pool->mtu >> 8;
+		*ptr++ = pool->mtu & 0xFF;
+		return ptr;
+	case DHCP_RENEWALTIME:
+		if (end - ptr < 6) break;
+		return put_time(ptr, attr, pool->lease / 2);
+	case DHCP_REBINDTIME:
+		if (end - ptr < 6) break;
+		return put_time(ptr, attr, pool->lease / 8 * 7);
+	case DHCP_CSR:
+	case DHCP_MSCSR:
+		if (pool->num_route == 0) break;
+		return put_routes(ptr, end, attr, pool);
 	}
+	return ptr;
+}
+
+/* Fills options of OFFER/ACK. Message type, server id, lease time and
+ * subnet mask are always sent, the rest in the order of the parameter
+ * request list of the client. */
+static int fill_options(uint8_t *dest, int size, uint8_t msg_type, const dhcp_pool_t *pool, struct pbuf *req, bool rapid_commit)
+{
+	int i, n, offset;
+	uint8_t *ptr = dest;
+	uint8_t *end = dest + size - 1; /* room for DHCP_END */
+
+	*ptr++ = DHCP_MESSAGETYPE;
+	*ptr++ = 1;
+	*ptr++ = msg_type;
+	ptr = put_addr(ptr, DHCP_SERVERID, config->addr);
+	ptr = put_time(ptr, DHCP_LEASETIME, pool->lease);
+	ptr = put_addr(ptr, DHCP_SUBNETMASK, pool->subnet);
 
-	/* domain name server (DNS) */
-	if (dns != 0)
+	/* rapid commit */
+	if (rapid_commit)
 	{
-		*ptr++ = DHCP_DNSSERVER;
-		*ptr++ = 4;
-		*(uint32_t *)ptr = dns;
-		ptr += 4;
+		*ptr++ = DHCP_RAPIDCOMMIT;
+		*ptr++ = 0;
 	}
 
+	offset = find_dhcp_option(req, DHCP_PARAMETERREQUESTLIST, &n);
+	if (offset < 0) n = sizeof(default_options);
+	for (i = 0; i < n; i++)
+		ptr = put_option(ptr, end,
+			offset < 0 ? default_options[i] : pbuf_get_at(req, offset + i),
+			pool);
+
 	/* end */
 	*ptr++ = DHCP_END;
-	return ptr - (uint8_t *)dest;
+	return ptr - dest;
 }
 
-static void udp_recv_proc(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+static uint32_t get_option_addr(struct pbuf *p, uint8_t attr)
+{
+	int offset, len;
+	uint32_t res;
+	offset = find_dhcp_option(p, attr, &len);
+	if (offset < 0 || len != 4) return 0;
+	pbuf_copy_partial(p, &res, 4, offset);
+	return res;
+}
+
+/* The reply is built in place: the request header is copied up to
+ * chaddr, options are written behind the header and the pbuf is
+ * trimmed to the actual size. */
+static void send_reply(struct udp_pcb *upcb, u16_t port, struct pbuf *req, uint8_t msg_type, int index, bool rapid_commit)
 {
-	uint8_t *ptr;
-	dhcp_entry_t *entry;
 	struct pbuf *pp;
+	DHCP_TYPE *reply;
+	uint8_t *ptr;
+	dhcp_pool_t *pool;
+	uint32_t ip;
+	int size;
+
+	pp = pbuf_alloc(PBUF_TRANSPORT, sizeof(DHCP_TYPE) + DHCP_OPTIONS_MAX, PBUF_RAM);
+	if (pp == NULL) return;
+	reply = (DHCP_TYPE *)pp->payload;
+	memset(reply, 0, sizeof(DHCP_TYPE));
+	pbuf_copy_partial(req, reply, offsetof(DHCP_TYPE, dp_legacy), 0);
+	reply->dp_op = 2; /* reply */
+	reply->dp_hops = 0;
+	reply->dp_secs = 0;
+	reply->dp_flags = 0;
+	memset(reply->dp_ciaddr, 0, 4);
+	memcpy(reply->dp_magic, magic_cookie, 4);
+	ptr = (uint8_t *)(reply + 1);
+
+	if (msg_type == DHCP_NAK)
+	{
+		*ptr++ = DHCP_MESSAGETYPE;
+		*ptr++ = 1;
+		*ptr++ = DHCP_NAK;
+		*ptr++ = DHCP_SERVERID;
+		*ptr++ = 4;
+		memcpy(ptr, config->addr, 4);
+		ptr += 4;
+		*ptr++ = DHCP_END;
+	}
+	else
+	{
+		pool = pool_by_lease(index, &ip);
+		*(uint32_t *)reply->dp_yiaddr = ip;
+		ptr += fill_options(ptr, DHCP_OPTIONS_MAX, msg_type, pool, req, rapid_commit);
+	}
+
+	size = ptr - (uint8_t *)reply;
+	if (size < DHCP_MIN_SIZE)
+	{
+		memset(ptr, 0, DHCP_MIN_SIZE - size);
+		size = DHCP_MIN_SIZE;
+	}
+	pbuf_realloc(pp, size);
+	udp_sendto(upcb, pp, IP_ADDR_BROADCAST, port);
+	pbuf_free(pp);
+}
 
-	int n = p->len;
-	if (n > sizeof(dhcp_data)) n = sizeof(dhcp_data);
-	memcpy(&dhcp_data, p->payload, n);
-	switch (dhcp_data.dp_options[2])
+static void handle_request(struct udp_pcb *upcb, struct pbuf *p, u16_t port)
+{
+	uint8_t mac[6];
+	dhcp_lease_t *lease;
+	uint32_t now, ip, ciaddr, server;
+	int i, old, len;
+
+	if (p->tot_len < sizeof(DHCP_TYPE)) return;
+	if (pbuf_get_at(p, offsetof(DHCP_TYPE, dp_op)) != 1) return;
+	if (pbuf_memcmp(p, offsetof(DHCP_TYPE, dp_magic), magic_cookie, 4) != 0) return;
+	i = find_dhcp_option(p, DHCP_MESSAGETYPE, &len);
+	if (i < 0 || len != 1) return;
+
+	pbuf_copy_partial(p, mac, 6, offsetof(DHCP_TYPE, dp_chaddr));
+	pbuf_copy_partial(p, &ciaddr, 4, offsetof(DHCP_TYPE, dp_ciaddr));
+	now = sys_now();
+
+	switch (pbuf_get_at(p, i))
 	{
 		case DHCP_DISCOVER:
-			entry = entry_by_mac(dhcp_data.dp_chaddr);
-			if (entry == NULL) entry = vacant_address();
-			if (entry == NULL) break;
-
-			dhcp_data.dp_op = 2; /* reply */
-			dhcp_data.dp_secs = 0;
-			dhcp_data.dp_flags = 0;
-			*(uint32_t *)dhcp_data.dp_yiaddr = *(uint32_t *)entry->addr;
-			memcpy(dhcp_data.dp_magic, magic_cookie, 4);
-
-			memset(dhcp_data.dp_options, 0, sizeof(dhcp_data.dp_options));
-
-			fill_options(dhcp_data.dp_options,
-				DHCP_OFFER,
-				config->domain,
-				*(uint32_t *)config->dns,
-				entry->lease, 
-				*(uint32_t *)config->addr,
-				*(uint32_t *)config->addr, 
-				*(uint32_t *)entry->subnet);
-
-			pp = pbuf_alloc(PBUF_TRANSPORT, sizeof(dhcp_data), PBUF_POOL);
-			if (pp == NULL) break;
-			memcpy(pp->payload, &dhcp_data, sizeof(dhcp_data));
-			udp_sendto(upcb, pp, IP_ADDR_BROADCAST, port);
-			pbuf_free(pp);
+			i = offer_lease(mac, get_option_addr(p, DHCP_IPADDRESS), now);
+			if (i < 0) break;
+			assign_lease(i, mac);
+			lease = &config->leases[i];
+#if DHSERV_RAPID_COMMIT
+			/* two-message exchange: commit the lease and ACK at once */
+			if (find_dhcp_option(p, DHCP_RAPIDCOMMIT, &len) >= 0)
+			{
+				bind_lease(i, mac, now);
+				send_reply(upcb, port, p, DHCP_ACK, i, true);
+				break;
+			}
+#endif
+			if (lease->state != DHCP_LEASE_BOUND || expired(lease, now))
+			{
+				lease->state = DHCP_LEASE_OFFERED;
+				lease->expire = now + DHSERV_OFFER_TIME;
+			}
+			send_reply(upcb, port, p, DHCP_OFFER, i, false);
 			break;
 
 		case DHCP_REQUEST:
-			/* 1. find requested ipaddr in option list */
-			ptr = find_dhcp_option(dhcp_data.dp_options, sizeof(dhcp_data.dp_options), DHCP_IPADDRESS);
-			if (ptr == NULL) break;
-			if (ptr[1] != 4) break;
-			ptr += 2;
-
-			/* 2. does hw-address registered? */
-			entry = entry_by_mac(dhcp_data.dp_chaddr);
-			if (entry != NULL) free_entry(entry);
-
-			/* 3. find requested ipaddr */
-			entry = entry_by_ip(*(uint32_t *)ptr);
-			if (entry == NULL) break;
-			if (!is_vacant(entry)) break;
-
-			/* 4. fill struct fields */
-			memcpy(dhcp_data.dp_yiaddr, ptr, 4);
-			dhcp_data.dp_op = 2; /* reply */
-			dhcp_data.dp_secs = 0;
-			dhcp_data.dp_flags = 0;
-			memcpy(dhcp_data.dp_magic, magic_cookie, 4);
-
-			/* 5. fill options */
-			memset(dhcp_data.dp_options, 0, sizeof(dhcp_data.dp_options));
-
-			fill_options(dhcp_data.dp_options,
-				DHCP_ACK,
-				config->domain,
-				*(uint32_t *)config->dns,
-				entry->lease, 
-				*(uint32_t *)config->addr,
-				*(uint32_t *)config->addr, 
-				*(uint32_t *)entry->subnet);
-
-			/* 6. send ACK */
-			pp = pbuf_alloc(PBUF_TRANSPORT, sizeof(dhcp_data), PBUF_POOL);
-			if (pp == NULL) break;
-			memcpy(entry->mac, dhcp_data.dp_chaddr, 6);
-			memcpy(pp->payload, &dhcp_data, sizeof(dhcp_data));
-			udp_sendto(upcb, pp, IP_ADDR_BROADCAST, port);
-			pbuf_free(pp);
+			/* 1. client selected another server? */
+			server = get_option_addr(p, DHCP_SERVERID);
+			if (server != 0 && server != *(uint32_t *)config->addr)
+			{
+				i = lease_by_mac(mac);
+				if (i >= 0 && config->leases[i].state == DHCP_LEASE_OFFERED)
+					config->leases[i].expire = now;
+				break;
+			}
+
+			/* 2. requested address: option for SELECTING/INIT-REBOOT, ciaddr for RENEWING */
+			ip = get_option_addr(p, DHCP_IPADDRESS);
+			if (ip == 0) ip = ciaddr;
+			if (ip == 0) break;
+
+			i = lease_by_ip(ip);
+			if (i < 0 || !is_available(i, mac, now))
+			{
+				send_reply(upcb, port, p, DHCP_NAK, 0, false);
+				break;
+			}
+
+			/* 3. the client moves to another address */
+			old = lease_by_mac(mac);
+			if (old >= 0 && old != i)
+			{
+				release_lease(old);
+				notify_release(old);
+			}
+
+			/* 4. bind and ACK */
+			bind_lease(i, mac, now);
+			send_reply(upcb, port, p, DHCP_ACK, i, false);
+			break;
+
+		case DHCP_RELEASE:
+			/* the lease expires but stays with the client until reclaimed */
+			i = lease_by_ip(ciaddr);
+			if (i < 0) break;
+			lease = &config->leases[i];
+			if (lease->state != DHCP_LEASE_BOUND || memcmp(lease->mac, mac, 6) != 0) break;
+			lease->expire = now;
+			lease->state = DHCP_LEASE_OFFERED; /* not bound, rebinding is reported again */
+			notify_release(i);
+			break;
+
+		case DHCP_DECLINE:
+			/* the address is used by somebody else */
+			i = lease_by_ip(get_option_addr(p, DHCP_IPADDRESS));
+			if (i < 0) break;
+			lease = &config->leases[i];
+			if (lease->state == DHCP_LEASE_FREE || memcmp(lease->mac, mac, 6) != 0) break;
+			release_lease(i);
+			free_remove(i);
+			lease->state = DHCP_LEASE_DECLINED;
+			lease->expire = now + DHSERV_DECLINE_TIME;
+			notify_release(i);
 			break;
 
 		default:
 				break;
 	}
+}
+
+static void udp_recv_proc(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+	LAT_APP(LAT_APP_DHCP);
+	handle_request(upcb, p, port);
 	pbuf_free(p);
 }
 
 err_t dhserv_init(dhcp_config_t *c)
 {
 	err_t err;
+	int i, n;
+	n = 0;
+	for (i = 0; i < c->num_pool; i++)
+		n += c->pools[i].size;
+	if (n > c->num_lease || n >= NO_LEASE)
+		return ERR_ARG;
 	udp_init();
 	dhserv_free();
 	pcb = udp_new();
@@ -321,6 +650,32 @@ err_t dhserv_init(dhcp_config_t *c)
 	}
 	udp_recv(pcb, udp_recv_proc, NULL);
 	config = c;
+	for (i = 0; i < DHSERV_HASH_SIZE; i++)
+		mac_hash[i] = NO_LEASE;
+	free_head = free_tail = NO_LEASE;
+	num_used = n;
+	for (i = 0; i < n; i++)
+		free_push(i);
+	return ERR_OK;
+}
+
+err_t dhserv_restore(int index, const uint8_t *mac)
+{
+	int old;
+	uint32_t ip;
+	if (config == NULL || index < 0 || index >= num_used)
+		return ERR_ARG;
+	if (mac == NULL)
+	{
+		release_lease(index);
+		return ERR_OK;
+	}
+	old = lease_by_mac(mac);
+	if (old >= 0 && old != index)
+		release_lease(old);
+	assign_lease(index, mac);
+	config->leases[index].state = DHCP_LEASE_BOUND;
+	config->leases[index].expire = sys_now() + pool_by_lease(index, &ip)->lease * 1000;
 	return ERR_OK;
 }
 
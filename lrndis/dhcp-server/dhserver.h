@@ -39,13 +39,73 @@
 #include "lwip/udp.h"
 #include "netif/etharp.h"
 
-typedef struct dhcp_entry
+/* lease time of an offer not yet requested, ms */
+#ifndef DHSERV_OFFER_TIME
+#define DHSERV_OFFER_TIME (30 * 1000)
+#endif
+
+/* time an address declined by a client is not offered, ms */
+#ifndef DHSERV_DECLINE_TIME
+#define DHSERV_DECLINE_TIME (10 * 60 * 1000)
+#endif
+
+/* answer DISCOVER with rapid commit option by ACK, RFC 4039 */
+#ifndef DHSERV_RAPID_COMMIT
+#define DHSERV_RAPID_COMMIT 1
+#endif
+
+/* buckets of the mac address hash, power of 2 */
+#ifndef DHSERV_HASH_SIZE
+#define DHSERV_HASH_SIZE 64
+#endif
+
+/* classless static route, RFC 3442 */
+typedef struct dhcp_route
+{
+	uint8_t  dest[4];   /* destination network */
+	uint8_t  width;     /* prefix length */
+	uint8_t  router[4]; /* 0.0.0.0 for a route on the link */
+} dhcp_route_t;
+
+/* Options beyond mask and lease time are sent only if the client asks
+ * for them in its parameter request list and they are configured. */
+typedef struct dhcp_pool
+{
+	uint8_t  first[4];  /* first address of the range */
+	uint16_t size;      /* number of addresses */
+	uint8_t  subnet[4]; /* subnet mask */
+	uint32_t lease;     /* lease time, s */
+	uint8_t  router[4]; /* default gateway, 0.0.0.0 for none */
+	uint16_t mtu;       /* interface mtu, 0 to omit */
+	int      num_route; /* classless static routes */
+	const dhcp_route_t *routes;
+} dhcp_pool_t;
+
+/* lease state, kept by the server */
+enum
+{
+	DHCP_LEASE_FREE,     /* no owner, in the free list */
+	DHCP_LEASE_OFFERED,  /* offered to mac, not requested yet */
+	DHCP_LEASE_BOUND,    /* acked to mac */
+	DHCP_LEASE_DECLINED  /* in use by unknown host, quarantined */
+};
+
+/* Offered and bound leases stay assigned to their mac after expiry, so a
+ * client gets the same address back until it is reclaimed for another. */
+typedef struct dhcp_lease
 {
 	uint8_t  mac[6];
-	uint8_t  addr[4];
-	uint8_t  subnet[4];
-	uint32_t lease;
-} dhcp_entry_t;
+	uint8_t  state;      /* DHCP_LEASE_XXX */
+	uint8_t  reserved;
+	uint16_t next;       /* mac hash chain or free list */
+	uint16_t prev;       /* free list */
+	uint32_t expire;     /* sys_now() of expiration, ms */
+} dhcp_lease_t;
+
+/* Called when a lease is bound to a new owner or given up by it, for
+ * persistent storage. lease->state is DHCP_LEASE_BOUND or the lease
+ * is released. Renewals of a bound lease are not reported. */
+typedef void (*dhserv_lease_cb)(int index, const dhcp_lease_t *lease);
 
 typedef struct dhcp_config
 {
@@ -53,11 +113,15 @@ typedef struct dhcp_config
 	uint16_t      port;
 	uint8_t       dns[4];
 	const char   *domain;
-	int           num_entry;
-	dhcp_entry_t *entries;
+	int           num_pool;
+	dhcp_pool_t  *pools;
+	int           num_lease; /* size of leases, at least the sum of pool sizes */
+	dhcp_lease_t *leases;    /* lease storage, one per address of all pools */
+	dhserv_lease_cb on_lease; /* NULL if leases are not stored */
 } dhcp_config_t;
 
 err_t dhserv_init(dhcp_config_t *config);
 void dhserv_free(void);
+err_t dhserv_restore(int index, const uint8_t *mac); /* binds a lease stored before restart, NULL mac frees it */
 
 #endif /* DHSERVER_H */
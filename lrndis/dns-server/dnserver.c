@@ -28,11 +28,30 @@
  */
 
 #include "dnserver.h"
+#include "arch/perf.h"
 
-#define DNS_MAX_HOST_NAME_LEN 128
+/* response codes */
+#define DNS_RCODE_NOERROR  0
+#define DNS_RCODE_FORMERR  1
+#define DNS_RCODE_NXDOMAIN 3
+#define DNS_RCODE_REFUSED  5
+
+#define DNS_TYPE_OPT  41 /* EDNS0, RFC 6891 */
+
+#define DNS_CLASS_IN  1
+#define DNS_CLASS_ANY 255
+
+#define DNS_HEADER_SIZE 12
+#define DNS_MAX_NAME    255 /* octets of a name, RFC 1035 */
+#define DNS_OPT_SIZE    11  /* OPT record without options */
+#define DNS_MAX_HOPS    16 /* compression pointers followed per name */
+#define DNS_MAX_SUFFIX  24 /* names remembered for compression of a response */
+#define DNS_BAD_NAME    2  /* name_cmp result of a malformed name */
 
 static struct udp_pcb *pcb = NULL;
-dns_query_proc_t query_proc = NULL;
+static const dns_zone_t *zone = NULL;
+static uint8_t wildcard[4];
+static bool wildcard_enabled = false;
 
 #pragma pack(push, 1)
 typedef struct
@@ -65,98 +84,444 @@ typedef struct
 	uint16_t n_record[4];
 } dns_header_t;
 
-typedef struct dns_answer
-{
-	uint16_t name;
-	uint16_t type;
-	uint16_t Class;
-	uint32_t ttl;
-	uint16_t len;
-	uint32_t addr;
-} dns_answer_t;
 #pragma pack(pop)
 
 typedef struct dns_query
 {
-	char name[DNS_MAX_HOST_NAME_LEN];
+	uint16_t name;  /* offset of the name in the request */
 	uint16_t type;
 	uint16_t Class;
 } dns_query_t;
 
-static int parse_next_query(void *data, int size, dns_query_t *query)
+/* response under construction, names are compressed against the
+ * questions and the names written before */
+typedef struct dns_writer
 {
-	int len;
-	int lables;
+	struct pbuf *p;
+	uint8_t *base;
 	uint8_t *ptr;
+	uint8_t *end;
+	int      n_suffix;
+	uint16_t suffix[DNS_MAX_SUFFIX]; /* offsets of names and their label suffixes */
+} dns_writer_t;
+
+/* message reader, works on pbuf chains in place */
 
+static char lower(char c)
+{
+	return c >= 'A' && c <= 'Z' ? c + 'a' - 'A' : c;
+}
+
+/* offset behind the name at offset (not following pointers) or -1 if
+ * the name is malformed or longer than DNS_MAX_NAME */
+static int name_end(struct pbuf *p, int offset)
+{
+	int n, end, hops, len;
+	end = -1;
+	hops = 0;
 	len = 0;
-	lables = 0;
-	ptr = (uint8_t *)data;
+	while (offset < p->tot_len)
+	{
+		n = pbuf_get_at(p, offset);
+		if ((n & 0xC0) == 0xC0)
+		{
+			if (offset + 1 >= p->tot_len || ++hops > DNS_MAX_HOPS) return -1;
+			if (end < 0) end = offset + 2;
+			offset = ((n & 0x3F) << 8) | pbuf_get_at(p, offset + 1);
+			continue;
+		}
+		if (n > 63) return -1;
+		offset += n + 1;
+		len += n + 1;
+		if (len > DNS_MAX_NAME) return -1;
+		if (n == 0)
+			return end < 0 ? offset : end;
+	}
+	return -1;
+}
 
+/* Compares the name at offset with a dotted lower case name like strcmp,
+ * case insensitive. Returns DNS_BAD_NAME if the name is malformed. */
+static int name_cmp(struct pbuf *p, int offset, const char *name)
+{
+	int n, hops;
+	char c;
+	bool first;
+	hops = 0;
+	first = true;
 	while (true)
 	{
-		uint8_t lable_len;
-		if (size <= 0) return -1;
-		lable_len = *ptr++;
-		size--;
-		if (lable_len == 0) break;
-		if (lables > 0)
+		if (offset >= p->tot_len) return DNS_BAD_NAME;
+		n = pbuf_get_at(p, offset);
+		if ((n & 0xC0) == 0xC0)
 		{
-			if (len == DNS_MAX_HOST_NAME_LEN) return -2;
-			query->name[len++] = '.';
+			if (offset + 1 >= p->tot_len || ++hops > DNS_MAX_HOPS) return DNS_BAD_NAME;
+			offset = ((n & 0x3F) << 8) | pbuf_get_at(p, offset + 1);
+			continue;
+		}
+		if (n > 63) return DNS_BAD_NAME;
+		offset++;
+		if (n == 0) break;
+		if (!first)
+		{
+			if (*name != '.') return (uint8_t)*name < '.' ? 1 : -1;
+			name++;
+		}
+		first = false;
+		if (offset + n > p->tot_len) return DNS_BAD_NAME;
+		for (; n > 0; n--, offset++, name++)
+		{
+			if (*name == 0) return 1; /* longer, also if the label holds a zero byte */
+			c = lower(pbuf_get_at(p, offset));
+			if (c != *name) return (uint8_t)c < (uint8_t)*name ? -1 : 1;
 		}
-		if (lable_len > size) return -1;
-		if (len + lable_len >= DNS_MAX_HOST_NAME_LEN) return -2;
-		memcpy(&query->name[len], ptr, lable_len);
-		len += lable_len;
-		ptr += lable_len;
-		size -= lable_len;
-		lables++;
 	}
+	return *name == 0 ? 0 : -1;
+}
 
-	if (size < 4) return -1;
-	query->name[len] = 0;
-	query->type = *(uint16_t *)ptr;
-	ptr += 2;
-	query->Class = *(uint16_t *)ptr;
-	ptr += 2;
-	return ptr - (uint8_t *)data;
+/* true if the name at offset is apex or a subdomain of it */
+static bool in_domain(struct pbuf *p, int offset, const char *apex)
+{
+	int n, hops;
+	if (apex == NULL) return false;
+	hops = 0;
+	while (name_cmp(p, offset, apex) != 0)
+	{
+		n = pbuf_get_at(p, offset);
+		if (n == 0 || ++hops > DNS_MAX_HOPS + 63) return false;
+		if ((n & 0xC0) == 0xC0)
+			offset = ((n & 0x3F) << 8) | pbuf_get_at(p, offset + 1); else
+			offset += n + 1;
+	}
+	return true;
+}
+
+static uint16_t get16(struct pbuf *p, int offset)
+{
+	return (pbuf_get_at(p, offset) << 8) | pbuf_get_at(p, offset + 1);
+}
+
+/* response writer */
+
+static uint8_t *put16(uint8_t *ptr, uint16_t value)
+{
+	*ptr++ = value >> 8;
+	*ptr++ = value & 0xFF;
+	return ptr;
+}
+
+static uint8_t *put32(uint8_t *ptr, uint32_t value)
+{
+	ptr = put16(ptr, value >> 16);
+	return put16(ptr, value & 0xFFFF);
+}
+
+static void add_suffix(dns_writer_t *w, int offset)
+{
+	if (w->n_suffix < DNS_MAX_SUFFIX && offset < 0x3FFF)
+		w->suffix[w->n_suffix++] = offset;
+}
+
+/* remembers the labels of the name at offset for compression */
+static void add_name(dns_writer_t *w, int offset)
+{
+	int n;
+	while (true)
+	{
+		n = w->base[offset];
+		if (n == 0 || (n & 0xC0) == 0xC0) return;
+		add_suffix(w, offset);
+		offset += n + 1;
+	}
+}
+
+/* writes a dotted name, the longest known suffix as a pointer */
+static bool put_name(dns_writer_t *w, const char *name)
+{
+	int i;
+	const char *dot;
+	while (*name != 0)
+	{
+		for (i = 0; i < w->n_suffix; i++)
+			if (name_cmp(w->p, w->suffix[i], name) == 0)
+			{
+				if (w->end - w->ptr < 2) return false;
+				w->ptr = put16(w->ptr, 0xC000 | w->suffix[i]);
+				return true;
+			}
+		dot = strchr(name, '.');
+		if (dot == NULL) dot = name + strlen(name);
+		if (dot - name > 63 || w->end - w->ptr < dot - name + 2) return false;
+		add_suffix(w, w->ptr - w->base);
+		*w->ptr++ = dot - name;
+		memcpy(w->ptr, name, dot - name);
+		w->ptr += dot - name;
+		name = *dot == '.' ? dot + 1 : dot;
+	}
+	*w->ptr++ = 0;
+	return true;
+}
+
+/* appends a record owned by the name at offset, false if it does not fit */
+static bool put_record(dns_writer_t *w, int owner, const dns_record_t *rec, uint32_t ttl)
+{
+	uint8_t *start, *len;
+	int n;
+	start = w->ptr;
+	if (w->end - w->ptr < 12 + 6) return false;
+	w->ptr = put16(w->ptr, 0xC000 | owner);
+	w->ptr = put16(w->ptr, rec->type);
+	w->ptr = put16(w->ptr, DNS_CLASS_IN);
+	w->ptr = put32(w->ptr, ttl);
+	len = w->ptr;
+	w->ptr += 2;
+	switch (rec->type)
+	{
+	case DNS_TYPE_A:
+		memcpy(w->ptr, rec->addr, 4);
+		w->ptr += 4;
+		break;
+	case DNS_TYPE_PTR:
+		if (!put_name(w, rec->target)) goto full;
+		break;
+	case DNS_TYPE_TXT:
+		n = strlen(rec->target);
+		if (n > 255 || w->end - w->ptr < n + 1) goto full;
+		*w->ptr++ = n;
+		memcpy(w->ptr, rec->target, n);
+		w->ptr += n;
+		break;
+	case DNS_TYPE_SRV:
+		w->ptr = put16(w->ptr, rec->priority);
+		w->ptr = put16(w->ptr, rec->weight);
+		w->ptr = put16(w->ptr, rec->port);
+		if (!put_name(w, rec->target)) goto full;
+		break;
+	}
+	put16(len, w->ptr - len - 2);
+	return true;
+full:
+	w->ptr = start;
+	return false;
+}
+
+/* SOA of the zone apex for the authority section */
+static bool put_soa(dns_writer_t *w, const char *apex)
+{
+	uint8_t *start, *len;
+	start = w->ptr;
+	if (!put_name(w, apex) || w->end - w->ptr < 10) goto full;
+	w->ptr = put16(w->ptr, DNS_TYPE_SOA);
+	w->ptr = put16(w->ptr, DNS_CLASS_IN);
+	w->ptr = put32(w->ptr, zone->neg_ttl);
+	len = w->ptr;
+	w->ptr += 2;
+	if (!put_name(w, apex)) goto full;     /* primary server */
+	if (w->end - w->ptr < 11) goto full;   /* mailbox: hostmaster.<apex> */
+	*w->ptr++ = 10;
+	memcpy(w->ptr, "hostmaster", 10);
+	w->ptr += 10;
+	if (!put_name(w, apex) || w->end - w->ptr < 20) goto full;
+	w->ptr = put32(w->ptr, 1);             /* serial */
+	w->ptr = put32(w->ptr, 3600);          /* refresh */
+	w->ptr = put32(w->ptr, 600);           /* retry */
+	w->ptr = put32(w->ptr, 86400);         /* expire */
+	w->ptr = put32(w->ptr, zone->neg_ttl); /* minimum */
+	put16(len, w->ptr - len - 2);
+	return true;
+full:
+	w->ptr = start;
+	return false;
+}
+
+/* zone lookup */
+
+/* index of the first record of the name at offset or -1 */
+static int find_records(struct pbuf *p, int offset)
+{
+	int lo, hi, mid;
+	lo = 0;
+	hi = zone->num_record;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (name_cmp(p, offset, zone->records[mid].name) > 0)
+			lo = mid + 1; else
+			hi = mid;
+	}
+	if (lo < zone->num_record && name_cmp(p, offset, zone->records[lo].name) == 0)
+		return lo;
+	return -1;
+}
+
+/* Answers one question. Returns the number of answers or -1 if they do
+ * not fit. *rcode and *apex are set for negative answers. */
+static int answer_query(dns_writer_t *w, struct pbuf *p, const dns_query_t *q, int *rcode, const char **apex)
+{
+	int i, n;
+	dns_record_t rec;
+
+	*rcode = DNS_RCODE_NOERROR;
+	*apex = in_domain(p, q->name, zone->origin) ? zone->origin :
+	        in_domain(p, q->name, zone->reverse) ? zone->reverse : NULL;
+	if (q->Class != DNS_CLASS_IN && q->Class != DNS_CLASS_ANY)
+	{
+		*rcode = DNS_RCODE_REFUSED;
+		return 0;
+	}
+
+	n = 0;
+	i = find_records(p, q->name);
+	if (i >= 0)
+	{
+		for (; i < zone->num_record && name_cmp(p, q->name, zone->records[i].name) == 0; i++)
+		{
+			if (q->type != DNS_TYPE_ANY && q->type != zone->records[i].type) continue;
+			if (!put_record(w, q->name, &zone->records[i], zone->ttl)) return -1;
+			n++;
+		}
+		return n;
+	}
+
+	if (wildcard_enabled && *apex != zone->reverse)
+	{
+		/* captive portal: any other name is the device */
+		if (q->type != DNS_TYPE_A && q->type != DNS_TYPE_ANY) return 0;
+		memset(&rec, 0, sizeof(rec));
+		rec.type = DNS_TYPE_A;
+		memcpy(rec.addr, wildcard, 4);
+		return put_record(w, q->name, &rec, DNS_WILDCARD_TTL) ? 1 : -1;
+	}
+
+	*rcode = *apex == NULL ? DNS_RCODE_REFUSED : DNS_RCODE_NXDOMAIN;
+	return 0;
 }
 
 static void udp_recv_proc(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
 {
-	int len;
-	dns_header_t *header;
-	static dns_query_t query;
+	int i, n, offset, qend, rcode, first_rcode, size, opt_size, n_answer, n_question;
+	dns_header_t header;
+	dns_header_t *out_header;
+	dns_query_t query[DNS_MAX_QUESTIONS];
+	dns_writer_t w;
 	struct pbuf *out;
-	ip_addr_t host_addr;
-	dns_answer_t *answer;
+	const char *apex, *first_apex;
+	uint16_t type, edns_size;
+	int edns_version;
 
-	if (p->len <= sizeof(dns_header_t)) goto error;
-	header = (dns_header_t *)p->payload;
-	if (header->flags.qr != 0) goto error;
-	if (ntohs(header->n_record[0]) != 1) goto error;
+	LAT_APP(LAT_APP_DNS);
+	if (pbuf_copy_partial(p, &header, DNS_HEADER_SIZE, 0) != DNS_HEADER_SIZE) goto error;
+	if (header.flags.qr != 0 || header.flags.opcode != 0) goto error;
+	n_question = ntohs(header.n_record[0]);
+	if (n_question == 0 || n_question > DNS_MAX_QUESTIONS) goto error;
 
-	len = parse_next_query(header + 1, p->len - sizeof(dns_header_t), &query);
-	if (len < 0) goto error;
-	if (!query_proc(query.name, &host_addr)) goto error;
+	/* questions */
+	offset = DNS_HEADER_SIZE;
+	for (i = 0; i < n_question; i++)
+	{
+		query[i].name = offset;
+		offset = name_end(p, offset);
+		if (offset < 0 || offset + 4 > p->tot_len) goto error;
+		query[i].type = get16(p, offset);
+		query[i].Class = get16(p, offset + 2);
+		offset += 4;
+	}
+	qend = offset;
 
-	len += sizeof(dns_header_t);
-	out = pbuf_alloc(PBUF_TRANSPORT, len + 16, PBUF_POOL);
+	/* EDNS0 OPT in the additional section, RFC 6891 */
+	edns_version = -1;
+	edns_size = 0;
+	n = ntohs(header.n_record[1]) + ntohs(header.n_record[2]) + ntohs(header.n_record[3]);
+	for (i = 0; i < n; i++)
+	{
+		int start = offset;
+		offset = name_end(p, offset);
+		if (offset < 0 || offset + 10 > p->tot_len) break;
+		type = get16(p, offset);
+		if (type == DNS_TYPE_OPT && pbuf_get_at(p, start) == 0)
+		{
+			edns_size = get16(p, offset + 2);
+			edns_version = pbuf_get_at(p, offset + 5);
+		}
+		offset += 10 + get16(p, offset + 8);
+	}
+
+	size = DNS_MAX_MESSAGE;
+	if (edns_version >= 0 && edns_size > size)
+		size = edns_size < DNS_MAX_EDNS_MESSAGE ? edns_size : DNS_MAX_EDNS_MESSAGE;
+	out = pbuf_alloc(PBUF_TRANSPORT, size, PBUF_RAM);
 	if (out == NULL) goto error;
 
-	memcpy(out->payload, p->payload, len);
-	header = (dns_header_t *)out->payload;
-	header->flags.qr = 1;
-	header->n_record[1] = htons(1);
-	answer = (struct dns_answer *)((uint8_t *)out->payload + len);
-	answer->name = htons(0xC00C);
-	answer->type = htons(1);
-	answer->Class = htons(1);
-	answer->ttl = htonl(32);
-	answer->len = htons(4);
-	answer->addr = host_addr.addr;
-	
+	/* header and questions are echoed, questions that leave no room for
+	 * the OPT record are not: FORMERR with the header only */
+	first_rcode = DNS_RCODE_NOERROR;
+	opt_size = edns_version >= 0 ? DNS_OPT_SIZE : 0;
+	if (qend > size - opt_size)
+	{
+		first_rcode = DNS_RCODE_FORMERR;
+		n_question = 0;
+		qend = DNS_HEADER_SIZE;
+	}
+	pbuf_copy_partial(p, out->payload, qend, 0);
+	out_header = (dns_header_t *)out->payload;
+	out_header->n_record[0] = htons(n_question);
+	out_header->flags.qr = 1;
+	out_header->flags.aa = 1;
+	out_header->flags.tc = 0;
+	out_header->flags.ra = 0;
+	out_header->flags.z = 0;
+	out_header->n_record[1] = 0;
+	out_header->n_record[2] = 0;
+	out_header->n_record[3] = 0;
+
+	w.p = out;
+	w.base = (uint8_t *)out->payload;
+	w.ptr = w.base + qend;
+	w.end = w.base + size - opt_size; /* room for OPT */
+	w.n_suffix = 0;
+	for (i = 0; i < n_question; i++)
+		add_name(&w, query[i].name);
+
+	first_apex = NULL;
+	n_answer = 0;
+	if (edns_version <= 0) /* else BADVERS, set in the OPT record */
+	{
+		/* the rcode is that of the first question */
+		for (i = 0; i < n_question; i++)
+		{
+			n = answer_query(&w, p, &query[i], &rcode, &apex);
+			if (n < 0)
+			{
+				out_header->flags.tc = 1;
+				break;
+			}
+			n_answer += n;
+			if (i == 0)
+			{
+				first_rcode = rcode;
+				first_apex = apex;
+			}
+		}
+	}
+	out_header->flags.rcode = first_rcode;
+	out_header->n_record[1] = htons(n_answer);
+
+	/* NXDOMAIN or NODATA: SOA for negative caching, RFC 2308 */
+	if (n_answer == 0 && first_apex != NULL && first_rcode != DNS_RCODE_REFUSED && !out_header->flags.tc)
+		if (put_soa(&w, first_apex))
+			out_header->n_record[2] = htons(1);
+
+	if (edns_version >= 0)
+	{
+		*w.ptr++ = 0;                                  /* root */
+		w.ptr = put16(w.ptr, DNS_TYPE_OPT);
+		w.ptr = put16(w.ptr, DNS_MAX_EDNS_MESSAGE);    /* our udp payload size */
+		w.ptr = put32(w.ptr, edns_version > 0 && first_rcode == DNS_RCODE_NOERROR ? 0x01000000 : 0); /* BADVERS, version 0 */
+		w.ptr = put16(w.ptr, 0);
+		out_header->n_record[3] = htons(1);
+	}
+
+	pbuf_realloc(out, w.ptr - w.base);
 	udp_sendto(upcb, out, addr, port);
 	pbuf_free(out);
 
@@ -164,9 +529,13 @@ error:
 	pbuf_free(p);
 }
 
-err_t dnserv_init(ip_addr_t *bind, uint16_t port, dns_query_proc_t qp)
+err_t dnserv_init(ip_addr_t *bind, uint16_t port, const dns_zone_t *z)
 {
 	err_t err;
+	int i;
+	for (i = 1; i < z->num_record; i++)
+		if (strcmp(z->records[i - 1].name, z->records[i].name) > 0)
+			return ERR_ARG; /* not sorted */
 	udp_init();
 	dnserv_free();
 	pcb = udp_new();
@@ -179,10 +548,17 @@ err_t dnserv_init(ip_addr_t *bind, uint16_t port, dns_query_proc_t qp)
 		return err;
 	}
 	udp_recv(pcb, udp_recv_proc, NULL);
-	query_proc = qp;
+	zone = z;
 	return ERR_OK;
 }
 
+void dnserv_set_wildcard(const uint8_t *addr)
+{
+	wildcard_enabled = addr != NULL;
+	if (addr != NULL)
+		memcpy(wildcard, addr, 4);
+}
+
 void dnserv_free()
 {
 	if (pcb == NULL) return;
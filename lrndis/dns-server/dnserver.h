@@ -39,9 +39,71 @@
 #include "lwip/udp.h"
 #include "netif/etharp.h"
 
-typedef bool (*dns_query_proc_t)(const char *name, ip_addr_t *addr);
+/* record types */
+#define DNS_TYPE_A     1
+#define DNS_TYPE_NS    2
+#define DNS_TYPE_SOA   6
+#define DNS_TYPE_PTR   12
+#define DNS_TYPE_TXT   16
+#define DNS_TYPE_AAAA  28
+#define DNS_TYPE_SRV   33
+#define DNS_TYPE_ANY   255
 
-err_t dnserv_init(ip_addr_t *bind, uint16_t port, dns_query_proc_t query_proc);
+/* default time to live of answers, s */
+#ifndef DNS_DEFAULT_TTL
+#define DNS_DEFAULT_TTL 300
+#endif
+
+/* time to live of wildcard answers, short so that hosts forget them
+ * soon after the captive portal is turned off */
+#ifndef DNS_WILDCARD_TTL
+#define DNS_WILDCARD_TTL 10
+#endif
+
+/* largest response, longer answers are truncated (TC) */
+#ifndef DNS_MAX_MESSAGE
+#define DNS_MAX_MESSAGE 512
+#endif
+
+/* largest response to EDNS0 queries announcing a bigger buffer */
+#ifndef DNS_MAX_EDNS_MESSAGE
+#define DNS_MAX_EDNS_MESSAGE 1232
+#endif
+
+/* questions answered in one query */
+#ifndef DNS_MAX_QUESTIONS
+#define DNS_MAX_QUESTIONS 4
+#endif
+
+typedef struct dns_record
+{
+	const char *name;     /* lower case, no trailing dot */
+	uint16_t    type;     /* DNS_TYPE_A, _PTR, _TXT or _SRV */
+	uint8_t     addr[4];  /* A */
+	const char *target;   /* PTR, SRV: domain name, TXT: text */
+	uint16_t    port;     /* SRV */
+	uint16_t    priority; /* SRV */
+	uint16_t    weight;   /* SRV */
+} dns_record_t;
+
+/* Records are sorted by name (strcmp), so a lookup is a binary search.
+ * Names under origin or reverse which have no records are answered
+ * with NXDOMAIN, existing names without records of the queried type
+ * (e.g. AAAA) with an empty answer. Both carry the SOA of the zone, so
+ * hosts cache the negative answer for neg_ttl. Other names are
+ * REFUSED. */
+typedef struct dns_zone
+{
+	const char *origin;   /* forward zone, e.g. "stm" */
+	const char *reverse;  /* reverse zone, e.g. "7.168.192.in-addr.arpa", or NULL */
+	uint32_t    ttl;      /* of answers, s */
+	uint32_t    neg_ttl;  /* of negative answers (SOA minimum), s */
+	int         num_record;
+	const dns_record_t *records;
+} dns_zone_t;
+
+err_t dnserv_init(ip_addr_t *bind, uint16_t port, const dns_zone_t *zone);
 void  dnserv_free(void);
+void  dnserv_set_wildcard(const uint8_t *addr); /* answer unknown names with addr, NULL to stop */
 
 #endif
@@ -49,6 +49,22 @@
 
 /*-----------------------------------------------------------------------------------*/
 
+#if HTTPD_FS_HASH
+/** Hash of a file name (FNV-1a with a final mix), must match the one makefsdata
+ * uses to build fs_hash_disp[] and fs_hash_files[]. */
+static u32_t
+fs_hash(const char *name, u32_t seed)
+{
+  u32_t h = 2166136261UL ^ seed;
+  while (*name != 0) {
+    h = ((h ^ (u8_t)*name++) * 16777619UL) & 0xffffffffUL;
+  }
+  h ^= h >> 16;
+  h = (h * 0x85ebca6bUL) & 0xffffffffUL;
+  return h ^ (h >> 13);
+}
+#endif /* HTTPD_FS_HASH */
+
 #if LWIP_HTTPD_CUSTOM_FILES
 int fs_open_custom(struct fs_file *file, const char *name);
 void fs_close_custom(struct fs_file *file);
@@ -59,8 +75,8 @@ u8_t fs_wait_read_custom(struct fs_file *file, fs_wait_cb callback_fn, void *cal
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
 /*-----------------------------------------------------------------------------------*/
-err_t
-fs_open(struct fs_file *file, const char *name)
+static err_t
+fs_open_file(struct fs_file *file, const char *name, u8_t gzip)
 {
   const struct fsdata_file *f;
 
@@ -68,6 +84,13 @@ fs_open(struct fs_file *file, const char *name)
      return ERR_ARG;
   }
 
+#if HTTPD_FS_ETAG
+  file->etag = NULL;
+  file->not_modified = NULL;
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+  file->ssi_segs = NULL;
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 #if LWIP_HTTPD_CUSTOM_FILES
   if (fs_open_custom(file, name)) {
     file->is_custom_file = 1;
@@ -76,26 +99,65 @@ fs_open(struct fs_file *file, const char *name)
   file->is_custom_file = 0;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
-  for (f = FS_ROOT; f != NULL; f = f->next) {
-    if (!strcmp(name, (char *)f->name)) {
-      file->data = (const char *)f->data;
-      file->len = f->len;
-      file->index = f->len;
-      file->pextension = NULL;
-      file->http_header_included = f->http_header_included;
+#if HTTPD_FS_HASH
+  /* one probe: the slot of a name is unique, other names may land on it */
+  f = fs_hash_files[fs_hash(name, fs_hash_disp[fs_hash(name, 0) & (FS_HASH_BUCKETS - 1)]) &
+                    (FS_HASH_SIZE - 1)];
+  if ((f != NULL) && strcmp(name, (char *)f->name)) {
+    f = NULL;
+  }
+#else /* HTTPD_FS_HASH */
+  for (f = FS_ROOT; (f != NULL) && strcmp(name, (char *)f->name); f = f->next);
+#endif /* HTTPD_FS_HASH */
+  if (f == NULL) {
+    /* file not found */
+    return ERR_VAL;
+  }
+#if HTTPD_FS_GZIP
+  if (gzip && (f->gzip != NULL)) {
+    f = f->gzip;
+  }
+#else /* HTTPD_FS_GZIP */
+  LWIP_UNUSED_ARG(gzip);
+#endif /* HTTPD_FS_GZIP */
+  file->data = (const char *)f->data;
+  file->len = f->len;
+  file->index = f->len;
+  file->pextension = NULL;
+  file->http_header_included = f->http_header_included;
+#if HTTPD_FS_ETAG
+  file->etag = f->etag;
+  file->not_modified = f->not_modified;
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+  file->ssi_segs = f->ssi_segs;
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 #if HTTPD_PRECALCULATED_CHECKSUM
-      file->chksum_count = f->chksum_count;
-      file->chksum = f->chksum;
+  file->chksum_count = f->chksum_count;
+  file->chksum = f->chksum;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 #if LWIP_HTTPD_FILE_STATE
-      file->state = fs_state_init(file, name);
+  file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
-      return ERR_OK;
-    }
-  }
-  /* file not found */
-  return ERR_VAL;
+  return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+err_t
+fs_open(struct fs_file *file, const char *name)
+{
+  return fs_open_file(file, name, 0);
+}
+
+#if HTTPD_FS_GZIP
+/*-----------------------------------------------------------------------------------*/
+/** Like fs_open, but opens the gzip variant of the file if there is one. */
+err_t
+fs_open_gzip(struct fs_file *file, const char *name)
+{
+  return fs_open_file(file, name, 1);
 }
+#endif /* HTTPD_FS_GZIP */
 
 /*-----------------------------------------------------------------------------------*/
 void
@@ -68,6 +68,30 @@
 #define HTTPD_PRECALCULATED_CHECKSUM  0
 #endif
 
+/** HTTPD_FS_GZIP==1: files may have a gzip variant generated by makefsdata,
+ * fs_open_gzip() opens it if the client accepts it. */
+#ifndef HTTPD_FS_GZIP
+#define HTTPD_FS_GZIP                 0
+#endif
+
+/** HTTPD_FS_HASH==1: fs_open() looks files up in the perfect hash index
+ * generated by makefsdata instead of walking the file list. */
+#ifndef HTTPD_FS_HASH
+#define HTTPD_FS_HASH                 0
+#endif
+
+/** HTTPD_FS_SSI_SEGMENTS==1: SSI files come with the list of their tags
+ * parsed by makefsdata, httpd sends the text between them from the file. */
+#ifndef HTTPD_FS_SSI_SEGMENTS
+#define HTTPD_FS_SSI_SEGMENTS         0
+#endif
+
+/** HTTPD_FS_ETAG==1: files generated by makefsdata -11 carry an ETag and
+ * a prebuilt "304 Not Modified" response for conditional requests. */
+#ifndef HTTPD_FS_ETAG
+#define HTTPD_FS_ETAG                 0
+#endif
+
 /** LWIP_HTTPD_FS_ASYNC_READ==1: support asynchronous read operations
  * (fs_read_async returns FS_READ_DELAYED and calls a callback when finished).
  */
@@ -86,6 +110,16 @@ struct fsdata_chksum {
 };
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 
+#if HTTPD_FS_SSI_SEGMENTS
+/** A piece of an SSI file body: static text followed by a tag. The text of
+ * the next segment starts after the tag. */
+struct fsdata_ssi_seg {
+  u16_t text_len;  /* bytes of static text */
+  u16_t tag_len;   /* bytes of the "<!--#name-->" following the text */
+  const char *tag; /* tag name, NULL for the text at the end of the file */
+};
+#endif /* HTTPD_FS_SSI_SEGMENTS */
+
 struct fs_file {
   const char *data;
   int len;
@@ -96,6 +130,13 @@ struct fs_file {
   u16_t chksum_count;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
   u8_t http_header_included;
+#if HTTPD_FS_ETAG
+  const char *etag;         /* quoted entity tag or NULL */
+  const char *not_modified; /* complete 304 response for etag */
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+  const struct fsdata_ssi_seg *ssi_segs; /* tags of an SSI file or NULL */
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 #if LWIP_HTTPD_CUSTOM_FILES
   u8_t is_custom_file;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
@@ -104,11 +145,14 @@ struct fs_file {
 #endif /* LWIP_HTTPD_FILE_STATE */
 };
 
-#if LWIP_HTTPD_FS_ASYNC_READ
+#if LWIP_HTTPD_FS_ASYNC_READ || LWIP_HTTPD_ASYNC_HANDLERS
 typedef void (*fs_wait_cb)(void *arg);
-#endif /* LWIP_HTTPD_FS_ASYNC_READ */
+#endif /* LWIP_HTTPD_FS_ASYNC_READ || LWIP_HTTPD_ASYNC_HANDLERS */
 
 err_t fs_open(struct fs_file *file, const char *name);
+#if HTTPD_FS_GZIP
+err_t fs_open_gzip(struct fs_file *file, const char *name);
+#endif /* HTTPD_FS_GZIP */
 void fs_close(struct fs_file *file);
 #if LWIP_HTTPD_DYNAMIC_FILE_READ
 #if LWIP_HTTPD_FS_ASYNC_READ
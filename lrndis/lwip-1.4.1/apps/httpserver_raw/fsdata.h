@@ -41,6 +41,16 @@ struct fsdata_file {
   const unsigned char *data;
   int len;
   u8_t http_header_included;
+#if HTTPD_FS_GZIP
+  const struct fsdata_file *gzip; /* variant with "Content-Encoding: gzip" or NULL */
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+  const char *etag;         /* quoted entity tag or NULL */
+  const char *not_modified; /* complete 304 response for etag */
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+  const struct fsdata_ssi_seg *ssi_segs; /* tags of an SSI file or NULL */
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 #if HTTPD_PRECALCULATED_CHECKSUM
   u16_t chksum_count;
   const struct fsdata_chksum *chksum;
@@ -84,10 +84,14 @@
 #include "lwip/stats.h"
 #include "httpd_structs.h"
 #include "lwip/tcp.h"
+#include "lwip/sys.h"
 #include "fs.h"
+#include "arch/perf.h"
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
 
 #if LWIP_TCP
 
@@ -154,13 +158,31 @@
 #endif
 
 /** Set this to 1 to enable HTTP/1.1 persistent connections.
- * ATTENTION: If the generated file system includes HTTP headers, these must
- * include the "Connection: keep-alive" header (pass argument "-11" to makefsdata).
+ * A connection is kept open after a response to a HTTP/1.1 request without
+ * "Connection: close" if the response is a HTTP/1.1 response with a
+ * "Content-Length" header (pass argument "-11" to makefsdata). SSI files are
+ * rendered into the heap to calculate their length. Pipelined requests are
+ * queued and answered in order.
  */
 #ifndef LWIP_HTTPD_SUPPORT_11_KEEPALIVE
 #define LWIP_HTTPD_SUPPORT_11_KEEPALIVE     0
 #endif
 
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Number of polls (HTTPD_POLL_INTERVAL) a persistent connection may stay
+ * idle before it is closed. Idle connections are also the first ones killed
+ * by tcp_alloc() when running out of pcbs.
+ */
+#ifndef HTTPD_KEEPALIVE_TIMEOUT
+#define HTTPD_KEEPALIVE_TIMEOUT             2
+#endif
+
+/** Maximum number of requests answered on one connection */
+#ifndef HTTPD_MAX_KEEPALIVE_REQUESTS
+#define HTTPD_MAX_KEEPALIVE_REQUESTS        100
+#endif
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 /** Set this to 1 to support HTTP request coming in in multiple packets/pbufs */
 #ifndef LWIP_HTTPD_SUPPORT_REQUESTLIST
 #define LWIP_HTTPD_SUPPORT_REQUESTLIST      1
@@ -219,7 +241,7 @@
 #define MIN_REQ_LEN   7
 
 #define CRLF "\r\n"
-#define HTTP11_CONNECTIONKEEPALIVE "Connection: keep-alive"
+#define HTTP11_VERSION "HTTP/1.1"
 
 #if LWIP_HTTPD_SSI
 #define LWIP_HTTPD_IS_SSI(hs) ((hs)->ssi)
@@ -227,6 +249,27 @@
 #define LWIP_HTTPD_IS_SSI(hs) 0
 #endif /* LWIP_HTTPD_SSI */
 
+/** SSI files precompiled by makefsdata are sent as static text from the
+ * file and tag inserts rendered into the heap (multipart tags excluded). */
+#define HTTPD_SSI_SEGMENTS (LWIP_HTTPD_SSI && HTTPD_FS_SSI_SEGMENTS && !LWIP_HTTPD_SSI_MULTIPART)
+
+/** Rendered SSI responses are kept in http_cache_arena */
+#define HTTPD_RESPONSE_CACHE (LWIP_HTTPD_SSI && LWIP_HTTPD_RESPONSE_CACHE)
+#if HTTPD_RESPONSE_CACHE && !(LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS)
+#error "LWIP_HTTPD_RESPONSE_CACHE needs LWIP_HTTPD_SUPPORT_11_KEEPALIVE or HTTPD_FS_SSI_SEGMENTS"
+#endif
+
+#if HTTPD_SSI_SEGMENTS
+/** Sending from the heap: a rendered SSI response or the current piece of a
+ * precompiled one, the text pieces of the latter are sent from the file */
+#define LWIP_HTTPD_IS_RENDERED(hs) (((hs)->rendered != NULL) && ((hs)->seg == NULL || !(hs)->seg_flash))
+#elif LWIP_HTTPD_SSI && LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** SSI response rendered into the heap for a persistent connection */
+#define LWIP_HTTPD_IS_RENDERED(hs) ((hs)->rendered != NULL)
+#else /* LWIP_HTTPD_SSI && LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#define LWIP_HTTPD_IS_RENDERED(hs) 0
+#endif /* LWIP_HTTPD_SSI && LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 /** These defines check whether tcp_write has to copy data or not */
 
 /** This was TI's check whether to let TCP copy data or not
@@ -234,7 +277,7 @@
 #ifndef HTTP_IS_DATA_VOLATILE
 #if LWIP_HTTPD_SSI
 /* Copy for SSI files, no copy for non-SSI files */
-#define HTTP_IS_DATA_VOLATILE(hs)   ((hs)->ssi ? TCP_WRITE_FLAG_COPY : 0)
+#define HTTP_IS_DATA_VOLATILE(hs)   (((hs)->ssi || LWIP_HTTPD_IS_RENDERED(hs)) ? TCP_WRITE_FLAG_COPY : 0)
 #else /* LWIP_HTTPD_SSI */
 /** Default: don't copy if the data is sent from file-system directly */
 #define HTTP_IS_DATA_VOLATILE(hs) (((hs->file != NULL) && (hs->handle != NULL) && (hs->file == \
@@ -330,9 +373,25 @@ struct http_ssi_state {
   char tag_name[LWIP_HTTPD_MAX_TAG_NAME_LEN + 1]; /* Last tag name extracted */
   char tag_insert[LWIP_HTTPD_MAX_TAG_INSERT_LEN + 1]; /* Insert string for tag_name */
   enum tag_check_state tag_state; /* State of the tag processor */
+#if LWIP_HTTPD_ASYNC_HANDLERS
+  u8_t tag_pending; /* The handler has not answered for tag_name yet */
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 };
 #endif /* LWIP_HTTPD_SSI */
 
+#if LWIP_HTTPD_WEBSOCKET
+#define HTTP_WS_ACCEPT_LEN 28 /* base64 of a SHA-1 */
+#define HTTP_WS_HDR_MAX    8  /* header of a masked frame up to 64k */
+
+struct http_ws_state {
+  u16_t rx_len;     /* Received bytes of the frame not yet complete */
+  u8_t hdr_flash;   /* The handshake is sent from http_ws_header */
+  u8_t broken;      /* A frame was cut off, the connection has to be aborted */
+  char accept[HTTP_WS_ACCEPT_LEN + 4]; /* Sec-WebSocket-Accept and CRLFCRLF */
+  u8_t rx[HTTP_WS_HDR_MAX + LWIP_HTTPD_WS_MAX_MSG];
+};
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
 struct http_state {
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
   struct http_state *next;
@@ -354,14 +413,66 @@ struct http_state {
   u8_t retries;
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
   u8_t keepalive;
+  u16_t requests;   /* Number of requests received on this connection */
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  u16_t req_unrecved; /* Pipelined bytes queued while sending a response */
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SSI && (LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS)
+  char *rendered;   /* Heap buffer holding a rendered SSI response or inserts */
+#endif /* LWIP_HTTPD_SSI && (LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS) */
+#if HTTPD_RESPONSE_CACHE
+  struct http_cache_entry *cached; /* rendered is shared from the cache */
+  u8_t cache_rule;  /* Rule of the file (HTTP_CACHE_NO_RULE: not cached) */
+  u8_t cache_gen;   /* http_cache_gen when the file was opened */
+#endif /* HTTPD_RESPONSE_CACHE */
+#if HTTPD_SSI_SEGMENTS
+  const struct fsdata_ssi_seg *seg; /* Segment of a precompiled SSI file being sent */
+  const char *seg_text; /* Static text of seg in the file */
+  char *seg_insert; /* Next insert in rendered, preceded by its length */
+  u8_t seg_state;   /* Next piece of the response to send */
+  u8_t seg_flash;   /* The current piece is sent from the file */
+#endif /* HTTPD_SSI_SEGMENTS */
+#if HTTPD_FS_GZIP
+  u8_t accept_gzip; /* request allows "Content-Encoding: gzip" */
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+  const char *if_none_match; /* If-None-Match list of the request being parsed */
+  const char *if_none_match_end;
+#endif /* HTTPD_FS_ETAG */
 #if LWIP_HTTPD_SSI
   struct http_ssi_state *ssi;
 #endif /* LWIP_HTTPD_SSI */
+#if LWIP_HTTPD_WEBSOCKET
+  struct http_ws_state *ws; /* The connection has been upgraded to a WebSocket */
+  const char *ws_key; /* Sec-WebSocket-Key of the request being parsed */
+  const char *ws_key_end;
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_SSE
+  struct http_state *sse_next; /* Next client of the event stream */
+  u8_t sse;         /* The connection is a client of the event stream */
+  u8_t sse_pending; /* HTTP_SSE_EVENT and/or HTTP_SSE_PING to send */
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_CHUNKED
+  const tChunked *chunked; /* Generator of the response, NULL if none */
+  u32_t chunk_cursor; /* Kept for the generator between its chunks */
+  u8_t chunk_state; /* HTTP_CHUNK_*: next part of the response */
+  u8_t chunk_framed; /* The request is HTTP/1.1: the body is sent in chunks */
+#endif /* LWIP_HTTPD_CHUNKED */
 #if LWIP_HTTPD_CGI
   char *params[LWIP_HTTPD_MAX_CGI_PARAMETERS]; /* Params extracted from the request URI */
   char *param_vals[LWIP_HTTPD_MAX_CGI_PARAMETERS]; /* Values for each extracted param */
 #endif /* LWIP_HTTPD_CGI */
+#if LWIP_HTTPD_ASYNC_HANDLERS
+  struct http_state *pending_next; /* Next connection waiting for a handler */
+  u8_t pending;     /* HTTP_PENDING_*: a handler has not answered yet */
+  u8_t pending_09;  /* The waiting request is HTTP/0.9 */
+#if LWIP_HTTPD_CGI
+  int cgi_index;    /* The pending CGI, called again with params/param_vals */
+  int cgi_count;
+  char *cgi_params; /* Heap copy of the parameters of the pending CGI */
+#endif /* LWIP_HTTPD_CGI */
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 #if LWIP_HTTPD_DYNAMIC_HEADERS
   const char *hdrs[NUM_FILE_HDR_STRINGS]; /* HTTP headers to be sent. */
   u16_t hdr_pos;     /* The position of the first unsent header byte in the
@@ -384,11 +495,22 @@ struct http_state {
 static err_t http_close_conn(struct tcp_pcb *pcb, struct http_state *hs);
 static err_t http_close_or_abort_conn(struct tcp_pcb *pcb, struct http_state *hs, u8_t abort_conn);
 static err_t http_find_file(struct http_state *hs, const char *uri, int is_09);
+static err_t http_open_file(struct http_state *hs, const char *uri, int is_09);
 static err_t http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const char *uri, u8_t tag_check);
+#if HTTPD_SSI_SEGMENTS
+static u8_t http_ssi_seg_next(struct http_state *hs);
+#endif /* HTTPD_SSI_SEGMENTS */
 static err_t http_poll(void *arg, struct tcp_pcb *pcb);
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+static void http_process_request(struct pbuf *p, struct http_state *hs, struct tcp_pcb *pcb);
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
 #if LWIP_HTTPD_FS_ASYNC_READ
 static void http_continue(void *connection);
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
+#if LWIP_HTTPD_ASYNC_HANDLERS
+static void http_park(struct http_state *hs, u8_t pending);
+static void http_handler_continue(void *connection);
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 
 #if LWIP_HTTPD_SSI
 /* SSI insert handler function pointer. */
@@ -409,12 +531,260 @@ const tCGI *g_pCGIs;
 int g_iNumCGIs;
 #endif /* LWIP_HTTPD_CGI */
 
+#define HTTPD_HANDLER_HASH (LWIP_HTTPD_HANDLER_HASH_SIZE && (LWIP_HTTPD_CGI || LWIP_HTTPD_SSI))
+#if HTTPD_HANDLER_HASH
+#if LWIP_HTTPD_CGI
+/* 1 + index into g_pCGIs, 0 for a free slot */
+static u16_t g_cgi_hash[LWIP_HTTPD_HANDLER_HASH_SIZE];
+static u8_t g_cgi_hashed;
+#endif /* LWIP_HTTPD_CGI */
+#if LWIP_HTTPD_SSI
+/* 1 + index into g_ppcTags, 0 for a free slot */
+static u16_t g_tag_hash[LWIP_HTTPD_HANDLER_HASH_SIZE];
+static u8_t g_tag_hashed;
+#endif /* LWIP_HTTPD_SSI */
+
+/** Hash of a CGI name or SSI tag (FNV-1a). */
+static u32_t
+http_handler_hash(const char *name)
+{
+  u32_t h = 2166136261UL;
+  while (*name != 0) {
+    h = ((h ^ (u8_t)*name++) * 16777619UL) & 0xffffffffUL;
+  }
+  return h ^ (h >> 16);
+}
+
+/** Builds an open addressed (linear probing) table of names. Names are
+ * inserted in order, so a lookup meets the first of equal names first.
+ *
+ * @param table LWIP_HTTPD_HANDLER_HASH_SIZE slots
+ * @param name_at returns the name of a handler index
+ * @param num number of names
+ * @return 1 if the names were indexed, 0 if there are too many of them
+ */
+static u8_t
+http_hash_build(u16_t *table, const char *(*name_at)(int), int num)
+{
+  u32_t h;
+  int i;
+
+  memset(table, 0, LWIP_HTTPD_HANDLER_HASH_SIZE * sizeof(u16_t));
+  if (num >= LWIP_HTTPD_HANDLER_HASH_SIZE) {
+    /* keep a free slot to end the lookups */
+    return 0;
+  }
+  for (i = 0; i < num; i++) {
+    for (h = http_handler_hash(name_at(i)); table[h & (LWIP_HTTPD_HANDLER_HASH_SIZE - 1)] != 0; h++);
+    table[h & (LWIP_HTTPD_HANDLER_HASH_SIZE - 1)] = (u16_t)(i + 1);
+  }
+  return 1;
+}
+
+/** Looks a name up in a table built by http_hash_build.
+ * @return handler index or -1 if not found */
+static int
+http_hash_find(const u16_t *table, const char *(*name_at)(int), const char *name)
+{
+  u32_t h;
+  int i;
+
+  for (h = http_handler_hash(name); (i = table[h & (LWIP_HTTPD_HANDLER_HASH_SIZE - 1)]) != 0; h++) {
+    if (strcmp(name, name_at(i - 1)) == 0) {
+      return i - 1;
+    }
+  }
+  return -1;
+}
+#endif /* HTTPD_HANDLER_HASH */
+
+#if LWIP_HTTPD_CGI
+static const char *
+http_cgi_name(int index)
+{
+  return g_pCGIs[index].pcCGIName;
+}
+
+/** Finds the CGI handler of a base URI.
+ * @return index into g_pCGIs or -1 if the URI has no handler */
+static int
+http_find_cgi(const char *uri)
+{
+  int i;
+
+#if HTTPD_HANDLER_HASH
+  if (g_cgi_hashed) {
+    return http_hash_find(g_cgi_hash, http_cgi_name, uri);
+  }
+#endif /* HTTPD_HANDLER_HASH */
+  for (i = 0; i < g_iNumCGIs; i++) {
+    if (strcmp(uri, http_cgi_name(i)) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+#endif /* LWIP_HTTPD_CGI */
+
+#if LWIP_HTTPD_SSI
+static const char *
+http_tag_name(int index)
+{
+  return g_ppcTags[index];
+}
+
+/** Finds the index of an SSI tag.
+ * @return index into g_ppcTags or -1 if the tag is not known */
+static int
+http_find_tag(const char *tag)
+{
+  int i;
+
+#if HTTPD_HANDLER_HASH
+  if (g_tag_hashed) {
+    return http_hash_find(g_tag_hash, http_tag_name, tag);
+  }
+#endif /* HTTPD_HANDLER_HASH */
+  for (i = 0; i < g_iNumTags; i++) {
+    if (strcmp(tag, http_tag_name(i)) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+#endif /* LWIP_HTTPD_SSI */
+
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
 /** global list of active HTTP connections, use to kill the oldest when
     running out of memory */
 static struct http_state *http_connections;
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
 
+#if LWIP_HTTPD_WEBSOCKET
+#define HTTP_WS_FIN      0x80
+#define HTTP_WS_MASK     0x80
+#define HTTP_WS_CONT     0x0
+#define HTTP_WS_CLOSE    0x8
+#define HTTP_WS_PING     0x9
+#define HTTP_WS_PONG     0xA
+
+/* status codes of close frames */
+#define HTTP_WS_PROTOCOL_ERROR 1002
+#define HTTP_WS_UNSUPPORTED    1003
+#define HTTP_WS_TOO_BIG        1009
+
+#define HTTP_WS_KEY_LEN  24 /* base64 of 16 bytes */
+static const char http_ws_guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+static const char http_ws_header[] =
+  "HTTP/1.1 101 Switching Protocols\r\n"
+  "Server: "HTTPD_SERVER_AGENT"\r\n"
+  "Upgrade: websocket\r\n"
+  "Connection: Upgrade\r\n"
+  "Sec-WebSocket-Accept: ";
+
+/* WebSocket endpoint */
+static const tWSHandler *g_pWSHandler;
+
+/** Work area of the SHA-1 of a handshake, static to keep it off the stack
+ * of tcp_input */
+static struct http_sha1_ctx {
+  u32_t h[5];
+  u32_t w[16];       /* message schedule */
+  u8_t block[128];   /* the message, padded to one or two blocks */
+  u8_t digest[20];
+} http_sha1_ctx;
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+#if LWIP_HTTPD_ASYNC_HANDLERS
+/* What a parked connection waits for (http_state.pending) */
+#define HTTP_PENDING_CGI  1 /* the response URI of a CGI */
+#define HTTP_PENDING_SSI  2 /* an insert of the SSI parser */
+#define HTTP_PENDING_SEGS 3 /* an insert of a precompiled SSI file */
+
+#define HTTP_IS_PENDING(hs) ((hs)->pending != 0)
+
+const char httpd_cgi_pending[] = "";
+/** list of the connections waiting for a handler */
+static struct http_state *http_pending_conns;
+/** the connection whose handler is called */
+static struct http_state *http_handler_conn;
+/** the connection resumed by http_handler_continue, NULL once it is freed */
+static struct http_state *http_resumed;
+#else /* LWIP_HTTPD_ASYNC_HANDLERS */
+#define HTTP_IS_PENDING(hs) 0
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+/** set while http_process_request answers requests */
+static u8_t http_processing;
+/** the connection whose next pipelined request is answered by the loop in
+ * http_process_request, NULL once it is freed */
+static struct http_state *http_pipelined;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+
+#if LWIP_HTTPD_SSE
+#define HTTP_SSE_EVENT 1 /* the record of the last notification */
+#define HTTP_SSE_PING  2 /* a comment line to detect dead clients */
+
+#define HTTP_SSE_DATA_LEAD_IN  6 /* "data: " */
+#define HTTP_SSE_DATA_LEAD_OUT 2 /* "\n\n" */
+
+static const char http_sse_header[] =
+  "HTTP/1.1 200 OK\r\n"
+  "Server: "HTTPD_SERVER_AGENT"\r\n"
+  "Content-Type: text/event-stream\r\n"
+  "Cache-Control: no-cache\r\n"
+  "\r\n";
+static const char http_sse_ping[] = ":\n\n";
+
+/* SSE handler and the URI of the event stream */
+static tSSEHandler g_pfnSSEHandler;
+static const char *g_pcSSEURI;
+/** list of the clients of the event stream */
+static struct http_state *http_sse_conns;
+/** the event of the last notification, formatted on first use */
+static char http_sse_buf[HTTP_SSE_DATA_LEAD_IN + LWIP_HTTPD_SSE_MAX_LEN + HTTP_SSE_DATA_LEAD_OUT];
+static u16_t http_sse_len;
+static u8_t http_sse_formatted;
+#endif /* LWIP_HTTPD_SSE */
+
+#if LWIP_HTTPD_CHUNKED
+#define HTTP_CHUNK_HEADER 0 /* the header, Content-Type of the generator */
+#define HTTP_CHUNK_BODY   1 /* chunks of the generator */
+#define HTTP_CHUNK_LAST   2 /* the last chunk (empty), then the response is done */
+
+#define HTTP_CHUNK_LEAD_IN  6 /* size as 4 hex digits and CRLF */
+#define HTTP_CHUNK_LEAD_OUT 2 /* CRLF */
+
+#if (LWIP_HTTPD_CHUNK_SIZE > 0xffff) || \
+    (HTTP_CHUNK_LEAD_IN + LWIP_HTTPD_CHUNK_SIZE + HTTP_CHUNK_LEAD_OUT > TCP_SND_BUF)
+#error "LWIP_HTTPD_CHUNK_SIZE with its framing must fit into TCP_SND_BUF"
+#endif
+
+#define HTTP_IS_CHUNKED(hs) ((hs)->chunked != NULL)
+
+static const char http_chunked_header[] =
+  "HTTP/1.1 200 OK\r\n"
+  "Server: "HTTPD_SERVER_AGENT"\r\n"
+  "Transfer-Encoding: chunked\r\n"
+  "Cache-Control: no-cache\r\n";
+/* HTTP/1.0: no chunks, the body ends with the connection */
+static const char http_chunked_header_10[] =
+  "HTTP/1.0 200 OK\r\n"
+  "Server: "HTTPD_SERVER_AGENT"\r\n"
+  "Cache-Control: no-cache\r\n";
+static const char http_chunk_last[] = "0\r\n\r\n";
+
+/* Generators and the number of them */
+static const tChunked *g_pChunked;
+static int g_iNumChunked;
+/** the header or the chunk being written, tcp_write copies it */
+static char http_chunk_buf[HTTP_CHUNK_LEAD_IN + LWIP_HTTPD_CHUNK_SIZE + HTTP_CHUNK_LEAD_OUT];
+#else /* LWIP_HTTPD_CHUNKED */
+#define HTTP_IS_CHUNKED(hs) 0
+#endif /* LWIP_HTTPD_CHUNKED */
+
 #if LWIP_HTTPD_STRNSTR_PRIVATE
 /** Like strstr but does not need 'buffer' to be NULL-terminated */
 static char*
@@ -434,6 +804,222 @@ strnstr(const char* buffer, const char* token, size_t n)
 } 
 #endif /* LWIP_HTTPD_STRNSTR_PRIVATE */
 
+#if HTTPD_FS_GZIP || HTTPD_FS_ETAG || LWIP_HTTPD_SUPPORT_11_KEEPALIVE || LWIP_HTTPD_WEBSOCKET
+/** Compares n characters of a header with a lower case token. */
+static int
+http_header_eq(const char *data, const char *token, size_t n)
+{
+  for (; n > 0; n--, data++, token++) {
+    if (tolower((unsigned char)*data) != *token) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/** Checks if the list element [tok, tok_end) is the lower case token. */
+static int
+http_token_is(const char *tok, const char *tok_end, const char *token)
+{
+  size_t len = strlen(token);
+  if (((size_t)(tok_end - tok) < len) || !http_header_eq(tok, token, len)) {
+    return 0;
+  }
+  tok += len;
+  return (tok == tok_end) || (*tok == ';') || (*tok == ' ') || (*tok == '\t');
+}
+
+/** Finds a header line by its lower case name (including the ':').
+ *
+ * @param data message, starting with the request or status line
+ * @param data_len length of the message, the search stops at the empty line
+ * @param name header name
+ * @param eol receives the end of the header line
+ * @return the value of the header or NULL if not found
+ */
+static const char *
+http_find_header(const char *data, u16_t data_len, const char *name, const char **eol)
+{
+  const char *end = data + data_len;
+  const char *line;
+  size_t len = strlen(name);
+
+  /* skip the request or status line */
+  for (line = strnstr(data, CRLF, data_len); line != NULL; line = *eol) {
+    line += 2;
+    *eol = strnstr(line, CRLF, end - line);
+    if ((*eol == NULL) || (*eol == line)) {
+      return NULL;
+    }
+    if (((size_t)(*eol - line) > len) && http_header_eq(line, name, len)) {
+      return line + len;
+    }
+  }
+  return NULL;
+}
+#endif /* HTTPD_FS_GZIP || HTTPD_FS_ETAG || LWIP_HTTPD_SUPPORT_11_KEEPALIVE || LWIP_HTTPD_WEBSOCKET */
+
+#if HTTPD_FS_GZIP
+/** Checks the Accept-Encoding header of a request for gzip.
+ * "gzip", "x-gzip" or "*" are accepted unless their quality is q=0.
+ *
+ * @param data request, starting with the request line
+ * @param data_len length of the request up to the empty line
+ * @return 1 if a gzip encoded response is acceptable
+ */
+static u8_t
+http_accepts_gzip(const char *data, u16_t data_len)
+{
+  const char *eol, *tok, *tok_end, *param;
+  int gzip = -1, any = -1, q;
+
+  tok = http_find_header(data, data_len, "accept-encoding:", &eol);
+  if (tok == NULL) {
+    return 0;
+  }
+
+  /* 1#( codings [ ";" "q=" qvalue ] ) */
+  for (; tok < eol; tok = tok_end + 1) {
+    while ((tok < eol) && ((*tok == ' ') || (*tok == '\t'))) {
+      tok++;
+    }
+    for (tok_end = tok; (tok_end < eol) && (*tok_end != ','); tok_end++);
+    q = 1;
+    param = strnstr(tok, ";", tok_end - tok);
+    if (param != NULL) {
+      /* q=0, q=0.0 ... */
+      for (param++; (param < tok_end) && ((*param == ' ') || (*param == '\t')); param++);
+      if ((tok_end - param >= 3) && http_header_eq(param, "q=0", 3)) {
+        q = 0;
+        for (param += 3; param < tok_end; param++) {
+          if ((*param >= '1') && (*param <= '9')) {
+            q = 1;
+          }
+        }
+      }
+    }
+    if (http_token_is(tok, tok_end, "gzip") || http_token_is(tok, tok_end, "x-gzip")) {
+      gzip = q;
+    } else if (http_token_is(tok, tok_end, "*")) {
+      any = q;
+    }
+  }
+  return (u8_t)((gzip >= 0) ? gzip : (any > 0));
+}
+#endif /* HTTPD_FS_GZIP */
+
+#if HTTPD_FS_ETAG
+/** Checks an If-None-Match list against the entity tag of a file.
+ * Weak comparison: a "W/" prefix is ignored, "*" matches any tag.
+ *
+ * @param tok value of the If-None-Match header
+ * @param eol end of the header line
+ * @param etag quoted entity tag of the file
+ * @return 1 if the client has the file already
+ */
+static u8_t
+http_etag_match(const char *tok, const char *eol, const char *etag)
+{
+  const char *tok_end, *next;
+  size_t len = strlen(etag);
+
+  /* "*" / 1#entity-tag */
+  for (; tok < eol; tok = next + 1) {
+    while ((tok < eol) && ((*tok == ' ') || (*tok == '\t'))) {
+      tok++;
+    }
+    for (next = tok; (next < eol) && (*next != ','); next++);
+    for (tok_end = next; (tok_end > tok) && ((tok_end[-1] == ' ') || (tok_end[-1] == '\t')); tok_end--);
+    if ((tok_end - tok >= 2) && (tok[0] == 'W') && (tok[1] == '/')) {
+      tok += 2;
+    }
+    if (((tok_end - tok == 1) && (*tok == '*')) ||
+        (((size_t)(tok_end - tok) == len) && !strncmp(tok, etag, len))) {
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif /* HTTPD_FS_ETAG */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Checks if the connection may persist after the response to a request:
+ * HTTP/1.1 without "Connection: close" (HTTP/1.0 clients are not sent
+ * "Connection: keep-alive", so their connections are closed).
+ *
+ * @param data request, starting with the request line
+ * @param data_len length of the request up to the empty line
+ * @param version protocol version of the request line
+ * @return 1 if the connection may persist
+ */
+static u8_t
+http_wants_keepalive(const char *data, u16_t data_len, const char *version)
+{
+  const char *eol, *tok, *tok_end;
+
+  if (strncmp(version, HTTP11_VERSION CRLF, 10)) {
+    return 0;
+  }
+  tok = http_find_header(data, data_len, "connection:", &eol);
+  for (; (tok != NULL) && (tok < eol); tok = tok_end + 1) {
+    while ((tok < eol) && ((*tok == ' ') || (*tok == '\t'))) {
+      tok++;
+    }
+    for (tok_end = tok; (tok_end < eol) && (*tok_end != ','); tok_end++);
+    if (http_token_is(tok, tok_end, "close")) {
+      return 0;
+    }
+  }
+  return 1;
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+#if LWIP_HTTPD_WEBSOCKET
+/** Checks if a request asks for a WebSocket: "Upgrade: websocket" and
+ * "Sec-WebSocket-Key".
+ *
+ * @param data request, starting with the request line
+ * @param data_len length of the request up to the empty line
+ * @param key_end receives the end of the key
+ * @return the key or NULL if the request is not an upgrade
+ */
+static const char *
+http_ws_request(const char *data, u16_t data_len, const char **key_end)
+{
+  const char *eol, *tok, *tok_end, *key;
+
+  key = http_find_header(data, data_len, "sec-websocket-key:", key_end);
+  if (key == NULL) {
+    return NULL;
+  }
+  for (; (*key == ' ') || (*key == '\t'); key++);
+  for (; (*key_end > key) && (((*key_end)[-1] == ' ') || ((*key_end)[-1] == '\t')); (*key_end)--);
+  tok = http_find_header(data, data_len, "upgrade:", &eol);
+  for (; (tok != NULL) && (tok < eol); tok = tok_end + 1) {
+    while ((tok < eol) && ((*tok == ' ') || (*tok == '\t'))) {
+      tok++;
+    }
+    for (tok_end = tok; (tok_end < eol) && (*tok_end != ','); tok_end++);
+    if (http_token_is(tok, tok_end, "websocket")) {
+      return key;
+    }
+  }
+  return NULL;
+}
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+/** Opens a file of the request, the gzip variant if the client accepts it. */
+static err_t
+http_fs_open(struct http_state *hs, const char *name)
+{
+#if HTTPD_FS_GZIP
+  if (hs->accept_gzip) {
+    return fs_open_gzip(&hs->file_handle, name);
+  }
+#endif /* HTTPD_FS_GZIP */
+  return fs_open(&hs->file_handle, name);
+}
+
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
 static void
 http_kill_oldest_connection(u8_t ssi_required)
@@ -491,6 +1077,194 @@ http_ssi_state_free(struct http_ssi_state *ssi)
 }
 #endif /* LWIP_HTTPD_SSI */
 
+#if HTTPD_RESPONSE_CACHE
+/* Kinds of rendered responses (http_cache_entry.kind) */
+#define HTTP_CACHE_RESPONSE 0 /* header and body, see http_ssi_render */
+#define HTTP_CACHE_INSERTS  1 /* "Content-Length" and inserts, see http_ssi_segs_render */
+
+#define HTTP_CACHE_NO_RULE  0xff
+
+struct http_cache_entry {
+  const char *key;  /* Data of the file rendered, NULL if the entry is free */
+  u32_t time;       /* sys_now() when rendered */
+  u16_t offset;     /* Start of the response in http_cache_arena */
+  u16_t len;
+  u16_t refs;       /* Number of connections sending the response */
+  u8_t rule;        /* Index in http_cache_rules */
+  u8_t kind;
+  u8_t stale;       /* Expired or invalidated, freed when refs drops to 0 */
+};
+
+static const tCacheRule *http_cache_rules;
+static int http_cache_num_rules;
+/** Incremented by httpd_cache_invalidate, a response rendered across it is
+ * not cached */
+static u8_t http_cache_gen;
+static struct http_cache_entry http_cache[LWIP_HTTPD_CACHE_ENTRIES];
+static char http_cache_arena[LWIP_HTTPD_CACHE_SIZE];
+
+/** Find the rule of a file to send.
+ * @return its index or HTTP_CACHE_NO_RULE */
+static u8_t
+http_cache_rule(struct fs_file *file, const char *uri)
+{
+  int i;
+
+#if LWIP_HTTPD_CUSTOM_FILES
+  if (file->is_custom_file) {
+    /* the data may be freed when the file is closed */
+    return HTTP_CACHE_NO_RULE;
+  }
+#else /* LWIP_HTTPD_CUSTOM_FILES */
+  LWIP_UNUSED_ARG(file);
+#endif /* LWIP_HTTPD_CUSTOM_FILES */
+  if (uri != NULL) {
+    for (i = 0; (i < http_cache_num_rules) && (i < HTTP_CACHE_NO_RULE); i++) {
+      if (!strcmp(uri, http_cache_rules[i].pcURIName)) {
+        return (u8_t)i;
+      }
+    }
+  }
+  return HTTP_CACHE_NO_RULE;
+}
+
+/** Mark an entry stale and free it if no connection is sending it. */
+static void
+http_cache_drop(struct http_cache_entry *e)
+{
+  e->stale = 1;
+  if (e->refs == 0) {
+    e->key = NULL;
+  }
+}
+
+/** Check if the response of a used entry may be sent to new requests. */
+static u8_t
+http_cache_valid(struct http_cache_entry *e)
+{
+  if (!e->stale && ((u32_t)(sys_now() - e->time) >= http_cache_rules[e->rule].ttl)) {
+    http_cache_drop(e);
+  }
+  return !e->stale;
+}
+
+/** Let hs send the response of its file rendered for an earlier request if
+ * it is still valid (shared: hs->rendered points into the arena).
+ * @return 1 if found */
+static u8_t
+http_cache_get(struct http_state *hs, u8_t kind)
+{
+  struct http_cache_entry *e;
+
+  if (hs->cache_rule == HTTP_CACHE_NO_RULE) {
+    return 0;
+  }
+  for (e = http_cache; e < &http_cache[LWIP_HTTPD_CACHE_ENTRIES]; e++) {
+    if ((e->key == hs->handle->data) && (e->kind == kind) && http_cache_valid(e)) {
+      e->refs++;
+      hs->cached = e;
+      hs->rendered = &http_cache_arena[e->offset];
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/** Find room for len bytes in the arena (first fit), dropping expired and
+ * then the oldest responses nobody is sending.
+ * @return a free entry with its offset set, NULL if there is no room */
+static struct http_cache_entry *
+http_cache_alloc(u16_t len)
+{
+  struct http_cache_entry *e, *free_e, *oldest;
+  u32_t offset;
+  u8_t moved;
+
+  for (;;) {
+    free_e = oldest = NULL;
+    for (e = http_cache; e < &http_cache[LWIP_HTTPD_CACHE_ENTRIES]; e++) {
+      if ((e->key != NULL) && http_cache_valid(e) && (e->refs == 0) &&
+          ((oldest == NULL) || ((s32_t)(e->time - oldest->time) < 0))) {
+        oldest = e;
+      }
+      if ((e->key == NULL) && (free_e == NULL)) {
+        free_e = e;
+      }
+    }
+    if (free_e != NULL) {
+      offset = 0;
+      do {
+        moved = 0;
+        for (e = http_cache; e < &http_cache[LWIP_HTTPD_CACHE_ENTRIES]; e++) {
+          if ((e->key != NULL) && (offset < (u32_t)e->offset + e->len) && (e->offset < offset + len)) {
+            offset = (u32_t)e->offset + e->len;
+            moved = 1;
+          }
+        }
+      } while (moved && (offset + len <= LWIP_HTTPD_CACHE_SIZE));
+      if (offset + len <= LWIP_HTTPD_CACHE_SIZE) {
+        free_e->offset = (u16_t)offset;
+        return free_e;
+      }
+    }
+    if (oldest == NULL) {
+      return NULL;
+    }
+    oldest->key = NULL;
+  }
+}
+
+/** Copy the response just rendered for hs into the arena if its file has a
+ * rule. hs then sends the shared copy and the heap buffer is freed.
+ *
+ * @param data the response in hs->rendered
+ * @return 1 if hs->rendered points into the arena now
+ */
+static u8_t
+http_cache_put(struct http_state *hs, u8_t kind, const char *data, u32_t len)
+{
+  struct http_cache_entry *e;
+
+  if ((hs->cache_rule == HTTP_CACHE_NO_RULE) || (hs->cache_gen != http_cache_gen) ||
+      (len > LWIP_HTTPD_CACHE_SIZE)) {
+    return 0;
+  }
+  /* one rendered concurrently by another connection is replaced */
+  for (e = http_cache; e < &http_cache[LWIP_HTTPD_CACHE_ENTRIES]; e++) {
+    if ((e->key == hs->handle->data) && (e->kind == kind)) {
+      http_cache_drop(e);
+    }
+  }
+  e = http_cache_alloc((u16_t)len);
+  if (e == NULL) {
+    return 0;
+  }
+  MEMCPY(&http_cache_arena[e->offset], data, len);
+  e->key = hs->handle->data;
+  e->time = sys_now();
+  e->len = (u16_t)len;
+  e->refs = 1;
+  e->rule = hs->cache_rule;
+  e->kind = kind;
+  e->stale = 0;
+  mem_free(hs->rendered);
+  hs->cached = e;
+  hs->rendered = &http_cache_arena[e->offset];
+  return 1;
+}
+
+/** The connection is done with its shared response. */
+static void
+http_cache_release(struct http_cache_entry *e)
+{
+  LWIP_ASSERT("e->refs > 0", e->refs > 0);
+  e->refs--;
+  if (e->stale) {
+    http_cache_drop(e);
+  }
+}
+#endif /* HTTPD_RESPONSE_CACHE */
+
 /** Initialize a struct http_state.
  */
 static void
@@ -559,7 +1333,24 @@ http_state_eof(struct http_state *hs)
     http_ssi_state_free(hs->ssi);
     hs->ssi = NULL;
   }
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS
+  if (hs->rendered != NULL) {
+#if HTTPD_RESPONSE_CACHE
+    if (hs->cached != NULL) {
+      http_cache_release(hs->cached);
+      hs->cached = NULL;
+    } else
+#endif /* HTTPD_RESPONSE_CACHE */
+    {
+      mem_free(hs->rendered);
+    }
+    hs->rendered = NULL;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS */
 #endif /* LWIP_HTTPD_SSI */
+#if LWIP_HTTPD_CHUNKED
+  hs->chunked = NULL;
+#endif /* LWIP_HTTPD_CHUNKED */
 }
 
 /** Free a struct http_state.
@@ -570,6 +1361,58 @@ http_state_free(struct http_state *hs)
 {
   if (hs != NULL) {
     http_state_eof(hs);
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (hs->req != NULL) {
+      pbuf_free(hs->req);
+      hs->req = NULL;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_WEBSOCKET
+    if (hs->ws != NULL) {
+      if (g_pWSHandler->close != NULL) {
+        g_pWSHandler->close(hs);
+      }
+      mem_free(hs->ws);
+      hs->ws = NULL;
+    }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      struct http_state **prev;
+      for (prev = &http_sse_conns; *prev != NULL; prev = &(*prev)->sse_next) {
+        if (*prev == hs) {
+          *prev = hs->sse_next;
+          break;
+        }
+      }
+    }
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (hs == http_pipelined) {
+      http_pipelined = NULL;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_ASYNC_HANDLERS
+    if (hs == http_resumed) {
+      http_resumed = NULL;
+    }
+    if (hs->pending) {
+      /* a late continue callback finds nothing */
+      struct http_state **prev;
+      for (prev = &http_pending_conns; *prev != NULL; prev = &(*prev)->pending_next) {
+        if (*prev == hs) {
+          *prev = hs->pending_next;
+          break;
+        }
+      }
+    }
+#if LWIP_HTTPD_CGI
+    if (hs->cgi_params != NULL) {
+      mem_free(hs->cgi_params);
+      hs->cgi_params = NULL;
+    }
+#endif /* LWIP_HTTPD_CGI */
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
     /* take the connection off the list */
     if (http_connections) {
@@ -702,20 +1545,66 @@ http_close_conn(struct tcp_pcb *pcb, struct http_state *hs)
    return http_close_or_abort_conn(pcb, hs, 0);
 }
 
-/** End of file: either close the connection (Connection: close) or
- * close the file (Connection: keep-alive)
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Close the file of a persistent connection and prepare the state for the
+ * next request. The connection members (pcb, list entry, queued requests)
+ * are kept.
  */
 static void
-http_eof(struct tcp_pcb *pcb, struct http_state *hs)
+http_state_reuse(struct http_state *hs)
 {
-  /* HTTP/1.1 persistent connection? (Not supported for SSI) */
-#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-  if (hs->keepalive && !LWIP_HTTPD_IS_SSI(hs)) {
-    http_state_eof(hs);
-    http_state_init(hs);
-    hs->keepalive = 1;
-  } else
-#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  struct tcp_pcb *pcb = hs->pcb;
+  u16_t requests = hs->requests;
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  struct pbuf *req = hs->req;
+  u16_t req_unrecved = hs->req_unrecved;
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
+  struct http_state *next = hs->next;
+#endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+
+  http_state_eof(hs);
+  http_state_init(hs);
+  hs->pcb = pcb;
+  hs->requests = requests;
+  hs->keepalive = 1;
+#if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
+  hs->next = next;
+#endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  hs->req = req;
+  if (req_unrecved != 0) {
+    /* ready for the next request: open the window again */
+    tcp_recved(pcb, req_unrecved);
+  }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+/** End of file: either close the connection (Connection: close) or
+ * close the file (Connection: keep-alive)
+ */
+static void
+http_eof(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  /* HTTP/1.1 persistent connection? (SSI only if rendered) */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  if (hs->keepalive && !LWIP_HTTPD_IS_SSI(hs)) {
+    http_state_reuse(hs);
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (hs->req != NULL) {
+      /* Answer the next pipelined request. Inside http_process_request
+         (the response was sent at once) its loop does that, so the stack
+         does not grow with the number of requests. */
+      if (http_processing && (http_pipelined == NULL)) {
+        http_pipelined = hs;
+      } else {
+        http_process_request(NULL, hs, pcb);
+      }
+    }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  } else
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
   {
     http_close_conn(pcb, hs);
   }
@@ -813,23 +1702,40 @@ get_tag_insert(struct http_state *hs)
   u16_t current_tag_part = ssi->tag_part;
   ssi->tag_part = HTTPD_LAST_TAG_PART;
 #endif /* LWIP_HTTPD_SSI_MULTIPART */
+#if LWIP_HTTPD_ASYNC_HANDLERS
+  ssi->tag_pending = 0;
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 
   if(g_pfnSSIHandler && g_ppcTags && g_iNumTags) {
 
     /* Find this tag in the list we have been provided. */
-    for(loop = 0; loop < g_iNumTags; loop++) {
-      if(strcmp(ssi->tag_name, g_ppcTags[loop]) == 0) {
-        ssi->tag_insert_len = g_pfnSSIHandler(loop, ssi->tag_insert,
-           LWIP_HTTPD_MAX_TAG_INSERT_LEN
+    loop = http_find_tag(ssi->tag_name);
+    if(loop >= 0) {
+#if LWIP_HTTPD_ASYNC_HANDLERS
+      http_handler_conn = hs;
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+      ssi->tag_insert_len = g_pfnSSIHandler(loop, ssi->tag_insert,
+         LWIP_HTTPD_MAX_TAG_INSERT_LEN
 #if LWIP_HTTPD_SSI_MULTIPART
-           , current_tag_part, &ssi->tag_part
+         , current_tag_part, &ssi->tag_part
 #endif /* LWIP_HTTPD_SSI_MULTIPART */
 #if LWIP_HTTPD_FILE_STATE
-           , hs->handle->state
+         , hs->handle->state
 #endif /* LWIP_HTTPD_FILE_STATE */
-           );
-        return;
+         );
+#if LWIP_HTTPD_ASYNC_HANDLERS
+      http_handler_conn = NULL;
+      if (ssi->tag_insert_len == HTTPD_SSI_PENDING) {
+        /* nothing to insert until the handler is called again */
+        ssi->tag_pending = 1;
+        ssi->tag_insert_len = 0;
+#if LWIP_HTTPD_SSI_MULTIPART
+        ssi->tag_part = current_tag_part;
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+        http_park(hs, HTTP_PENDING_SSI);
       }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+      return;
     }
   }
 
@@ -851,6 +1757,300 @@ get_tag_insert(struct http_state *hs)
   LWIP_ASSERT("len <= 0xffff", len <= 0xffff);
   ssi->tag_insert_len = (u16_t)len;
 }
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS
+/** Space reserved for "Content-Length: 4294967295\r\n\r\n" */
+#define HTTP_CONTENT_LENGTH_MAX 32
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE || HTTPD_SSI_SEGMENTS */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Render the SSI file of hs into a heap buffer, so that the response can be
+ * sent with a "Content-Length" header on a persistent connection. The header
+ * of the file is copied in front of the body, extended by "Content-Length".
+ * Tags are parsed like in http_send_data_ssi (whole tags only).
+ * A response cached for the file (HTTPD_RESPONSE_CACHE) is sent instead.
+ *
+ * @param hs http connection state with file and SSI state set up
+ * @param hdr_end end of the header of the file (the empty line)
+ * @return ERR_OK if hs now sends the rendered response,
+ *         ERR_MEM if the response does not fit into the heap,
+ *         ERR_INPROGRESS if a handler answers later (hs is parked)
+ */
+static err_t
+http_ssi_render(struct http_state *hs, const char *hdr_end)
+{
+  struct http_ssi_state *ssi = hs->ssi;
+  const char *src = hdr_end + 4;
+  const char *end = hs->file + hs->left;
+  const char *tag, *name;
+  char *buf, *body, *dst, *dst_end, *start;
+  u16_t hdr_len = (u16_t)(hdr_end + 2 - hs->file);
+  u32_t size = hdr_len + HTTP_CONTENT_LENGTH_MAX + (u32_t)(end - src);
+  char content_len[HTTP_CONTENT_LENGTH_MAX + 1];
+  int cl_len;
+
+#if HTTPD_RESPONSE_CACHE
+  if (http_cache_get(hs, HTTP_CACHE_RESPONSE)) {
+    http_ssi_state_free(ssi);
+    hs->ssi = NULL;
+    hs->file = hs->rendered;
+    hs->left = hs->cached->len;
+    return ERR_OK;
+  }
+#endif /* HTTPD_RESPONSE_CACHE */
+
+  /* worst case size: each tag replaced by a full insert */
+  for (tag = src; (tag = strnstr(tag, g_pcTagLeadIn, end - tag)) != NULL; tag += LEN_TAG_LEAD_IN) {
+    size += LWIP_HTTPD_MAX_TAG_INSERT_LEN;
+  }
+  if (size > MEM_SIZE) {
+    return ERR_MEM;
+  }
+  buf = (char *)mem_malloc((mem_size_t)size);
+  if (buf == NULL) {
+    return ERR_MEM;
+  }
+  body = buf + hdr_len + HTTP_CONTENT_LENGTH_MAX;
+  dst = body;
+  dst_end = buf + size;
+
+  while (src < end) {
+    tag = strnstr(src, g_pcTagLeadIn, end - src);
+    if (tag == NULL) {
+      tag = end;
+    }
+    MEMCPY(dst, src, tag - src);
+    dst += tag - src;
+    src = tag;
+    if (tag == end) {
+      break;
+    }
+    /* "<!--#" [ws] name [ws] "-->" */
+    for (name = tag + LEN_TAG_LEAD_IN; (name < end) && ((*name == ' ') || (*name == '\t') ||
+         (*name == '\n') || (*name == '\r')); name++);
+    for (src = name; (src < end) && (src - name <= LWIP_HTTPD_MAX_TAG_NAME_LEN) && (*src != '-') &&
+         (*src != ' ') && (*src != '\t') && (*src != '\n') && (*src != '\r'); src++);
+    ssi->tag_name_len = (u8_t)(src - name);
+    for (; (src < end) && ((*src == ' ') || (*src == '\t') || (*src == '\n') || (*src == '\r')); src++);
+    if ((ssi->tag_name_len == 0) || (ssi->tag_name_len > LWIP_HTTPD_MAX_TAG_NAME_LEN) ||
+        (end - src < LEN_TAG_LEAD_OUT) || strncmp(src, g_pcTagLeadOut, LEN_TAG_LEAD_OUT)) {
+      /* not a tag, keep the lead-in as text */
+      MEMCPY(dst, tag, LEN_TAG_LEAD_IN);
+      dst += LEN_TAG_LEAD_IN;
+      src = tag + LEN_TAG_LEAD_IN;
+      continue;
+    }
+    src += LEN_TAG_LEAD_OUT;
+    MEMCPY(ssi->tag_name, name, ssi->tag_name_len);
+    ssi->tag_name[ssi->tag_name_len] = '\0';
+#if LWIP_HTTPD_SSI_INCLUDE_TAG
+    MEMCPY(dst, tag, src - tag);
+    dst += src - tag;
+#endif /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+#if LWIP_HTTPD_SSI_MULTIPART
+    ssi->tag_part = 0;
+    do
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+    {
+      get_tag_insert(hs);
+#if LWIP_HTTPD_ASYNC_HANDLERS
+      if (ssi->tag_pending) {
+        /* the parser sends the file when the handler has answered */
+        ssi->tag_pending = 0;
+        mem_free(buf);
+        return ERR_INPROGRESS;
+      }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+      if (ssi->tag_insert_len > dst_end - dst) {
+        mem_free(buf);
+        return ERR_MEM;
+      }
+      MEMCPY(dst, ssi->tag_insert, ssi->tag_insert_len);
+      dst += ssi->tag_insert_len;
+    }
+#if LWIP_HTTPD_SSI_MULTIPART
+    while (ssi->tag_part != HTTPD_LAST_TAG_PART);
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+  }
+
+  /* header right-aligned in front of the body */
+  cl_len = sprintf(content_len, "Content-Length: %lu" CRLF CRLF, (unsigned long)(dst - body));
+  start = body - cl_len;
+  MEMCPY(start, content_len, cl_len);
+  start -= hdr_len;
+  MEMCPY(start, hs->file, hdr_len);
+  buf = (char *)mem_trim(buf, (mem_size_t)(dst - buf));
+
+  http_ssi_state_free(ssi);
+  hs->ssi = NULL;
+  hs->rendered = buf;
+  hs->file = start;
+  hs->left = (u32_t)(dst - start);
+#if HTTPD_RESPONSE_CACHE
+  if (http_cache_put(hs, HTTP_CACHE_RESPONSE, start, hs->left)) {
+    hs->file = hs->rendered;
+  }
+#endif /* HTTPD_RESPONSE_CACHE */
+  return ERR_OK;
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+#if HTTPD_SSI_SEGMENTS
+/* Next piece of a precompiled SSI response (http_state.seg_state) */
+#define HTTP_SEG_LENGTH 0 /* "Content-Length" and the end of the header */
+#define HTTP_SEG_TEXT   1 /* static text of seg */
+#define HTTP_SEG_INSERT 2 /* insert of the tag of seg */
+#define HTTP_SEG_DONE   3
+
+/** Render the tags of a precompiled SSI file (fs_file.ssi_segs) into a heap
+ * buffer: "Content-Length" followed by the inserts, each preceded by its
+ * length (2 bytes). The handler is called once per tag, the text between
+ * the tags is later sent from the file.
+ * While rendering, hs->seg is the next tag and hs->seg_insert the end of the
+ * inserts, so that a pending handler can be called again to go on.
+ * Inserts cached for the file (HTTPD_RESPONSE_CACHE) are sent instead.
+ *
+ * @param hs http connection state with the file set up
+ * @param is_09 1 if the request is HTTP/0.9 (no HTTP headers in response)
+ * @return ERR_OK if hs now sends the precompiled response,
+ *         ERR_MEM if the inserts do not fit into the heap,
+ *         ERR_INPROGRESS if a handler answers later (hs is parked)
+ */
+static err_t
+http_ssi_segs_render(struct http_state *hs, int is_09)
+{
+  const struct fsdata_ssi_seg *seg;
+  struct http_ssi_state *ssi = hs->ssi;
+  char *buf;
+  u32_t body_len = 0, content_len = 0;
+  u16_t tags = 0, len;
+
+  for (seg = hs->handle->ssi_segs; ; seg++) {
+    body_len += seg->text_len + seg->tag_len;
+#if LWIP_HTTPD_SSI_INCLUDE_TAG
+    content_len += seg->text_len + seg->tag_len;
+#else /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+    content_len += seg->text_len;
+#endif /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+    if (seg->tag == NULL) {
+      break;
+    }
+    tags++;
+  }
+  LWIP_ASSERT("segments do not match the file", body_len <= (u32_t)hs->handle->len);
+
+#if HTTPD_RESPONSE_CACHE
+  if ((ssi == NULL) && http_cache_get(hs, HTTP_CACHE_INSERTS)) {
+    /* rendered for an earlier request */
+  } else
+#endif /* HTTPD_RESPONSE_CACHE */
+  {
+    if (ssi == NULL) {
+      buf = (char *)mem_malloc((mem_size_t)(HTTP_CONTENT_LENGTH_MAX + tags * (2 + LWIP_HTTPD_MAX_TAG_INSERT_LEN)));
+      if (buf == NULL) {
+        return ERR_MEM;
+      }
+      ssi = http_ssi_state_alloc();
+      if (ssi == NULL) {
+        mem_free(buf);
+        return ERR_MEM;
+      }
+      hs->ssi = ssi;
+      hs->rendered = buf;
+      hs->seg = hs->handle->ssi_segs;
+      hs->seg_insert = buf + HTTP_CONTENT_LENGTH_MAX;
+    }
+    for (; hs->seg->tag != NULL; hs->seg++) {
+      ssi->tag_name_len = (u8_t)strlen(hs->seg->tag);
+      LWIP_ASSERT("tag name too long", ssi->tag_name_len <= LWIP_HTTPD_MAX_TAG_NAME_LEN);
+      MEMCPY(ssi->tag_name, hs->seg->tag, ssi->tag_name_len + 1);
+      get_tag_insert(hs);
+#if LWIP_HTTPD_ASYNC_HANDLERS
+      if (ssi->tag_pending) {
+        /* http_handler_continue() renders the rest */
+        hs->pending = HTTP_PENDING_SEGS;
+        hs->pending_09 = (u8_t)is_09;
+        return ERR_INPROGRESS;
+      }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+      len = ssi->tag_insert_len;
+      hs->seg_insert[0] = (char)(len & 0xff);
+      hs->seg_insert[1] = (char)(len >> 8);
+      MEMCPY(hs->seg_insert + 2, ssi->tag_insert, len);
+      hs->seg_insert += 2 + len;
+    }
+    http_ssi_state_free(ssi);
+    hs->ssi = NULL;
+
+    /* the inserts without their lengths */
+    buf = hs->rendered;
+    content_len += (u32_t)(hs->seg_insert - (buf + HTTP_CONTENT_LENGTH_MAX)) - 2 * tags;
+    sprintf(buf, "Content-Length: %lu" CRLF CRLF, (unsigned long)content_len);
+    hs->rendered = (char *)mem_trim(buf, (mem_size_t)(hs->seg_insert - buf));
+#if HTTPD_RESPONSE_CACHE
+    http_cache_put(hs, HTTP_CACHE_INSERTS, hs->rendered, (u32_t)(hs->seg_insert - buf));
+#endif /* HTTPD_RESPONSE_CACHE */
+  }
+  hs->seg = hs->handle->ssi_segs;
+  hs->seg_text = hs->handle->data + hs->handle->len - body_len;
+  hs->seg_insert = hs->rendered + HTTP_CONTENT_LENGTH_MAX;
+  hs->seg_flash = 1;
+  if (hs->handle->http_header_included && !is_09) {
+    /* the header of the file without its empty line */
+    hs->file = (char *)hs->handle->data;
+    hs->left = (u32_t)(hs->seg_text - 2 - hs->file);
+    hs->seg_state = HTTP_SEG_LENGTH;
+  } else {
+    hs->left = 0;
+    hs->seg_state = HTTP_SEG_TEXT;
+    http_ssi_seg_next(hs);
+  }
+  return ERR_OK;
+}
+
+/** Set up hs->file and hs->left for the next non-empty piece of a
+ * precompiled SSI response.
+ *
+ * @return 1 if there is another piece to send, 0 if the response is complete
+ */
+static u8_t
+http_ssi_seg_next(struct http_state *hs)
+{
+  do {
+    switch (hs->seg_state) {
+    case HTTP_SEG_LENGTH:
+      hs->file = hs->rendered;
+      hs->left = (u32_t)strlen(hs->rendered);
+      hs->seg_flash = 0;
+      hs->seg_state = HTTP_SEG_TEXT;
+      break;
+    case HTTP_SEG_TEXT:
+      hs->file = (char *)hs->seg_text;
+#if LWIP_HTTPD_SSI_INCLUDE_TAG
+      hs->left = hs->seg->text_len + hs->seg->tag_len;
+#else /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+      hs->left = hs->seg->text_len;
+#endif /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+      hs->seg_text += hs->seg->text_len + hs->seg->tag_len;
+      hs->seg_flash = 1;
+      hs->seg_state = (hs->seg->tag != NULL) ? HTTP_SEG_INSERT : HTTP_SEG_DONE;
+      break;
+    case HTTP_SEG_INSERT:
+      hs->left = (u8_t)hs->seg_insert[0] | ((u32_t)(u8_t)hs->seg_insert[1] << 8);
+      hs->file = hs->seg_insert + 2;
+      hs->seg_insert += 2 + hs->left;
+      hs->seg_flash = 0;
+      hs->seg++;
+      hs->seg_state = HTTP_SEG_TEXT;
+      break;
+    default:
+      hs->left = 0;
+      return 0;
+    }
+  } while (hs->left == 0);
+  return 1;
+}
+#endif /* HTTPD_SSI_SEGMENTS */
 #endif /* LWIP_HTTPD_SSI */
 
 #if LWIP_HTTPD_DYNAMIC_HEADERS
@@ -991,152 +2191,711 @@ http_send_headers(struct tcp_pcb *pcb, struct http_state *hs)
       sendlen = 0;
     }
 
-    /* Fix up the header position for the next time round. */
-    hs->hdr_pos += sendlen;
-    len -= sendlen;
+    /* Fix up the header position for the next time round. */
+    hs->hdr_pos += sendlen;
+    len -= sendlen;
+
+    /* Have we finished sending this string? */
+    if(hs->hdr_pos == hdrlen) {
+      /* Yes - move on to the next one */
+      hs->hdr_index++;
+      hs->hdr_pos = 0;
+    }
+  }
+  /* If we get here and there are still header bytes to send, we send
+   * the header information we just wrote immediately. If there are no
+   * more headers to send, but we do have file data to send, drop through
+   * to try to send some file data too. */
+  if((hs->hdr_index < NUM_FILE_HDR_STRINGS) || !hs->file) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("tcp_output\n"));
+    return HTTP_DATA_TO_SEND_BREAK;
+  }
+  return data_to_send;
+}
+#endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
+
+/** Sub-function of http_send(): end-of-file (or block) is reached,
+ * either close the file or read the next block (if supported).
+ *
+ * @returns: 0 if the file is finished or no data has been read
+ *           1 if the file is not finished and data has been read
+ */
+static u8_t
+http_check_eof(struct tcp_pcb *pcb, struct http_state *hs)
+{
+#if LWIP_HTTPD_DYNAMIC_FILE_READ
+  int count;
+#endif /* LWIP_HTTPD_DYNAMIC_FILE_READ */
+
+  /* Do we have a valid file handle? */
+  if (hs->handle == NULL) {
+    /* No - close the connection. */
+    http_eof(pcb, hs);
+    return 0;
+  }
+  if (fs_bytes_left(hs->handle) <= 0) {
+    /* We reached the end of the file so this request is done. */
+    LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
+    http_eof(pcb, hs);
+    return 0;
+  }
+#if LWIP_HTTPD_DYNAMIC_FILE_READ
+  /* Do we already have a send buffer allocated? */
+  if(hs->buf) {
+    /* Yes - get the length of the buffer */
+    count = hs->buf_len;
+  } else {
+    /* We don't have a send buffer so allocate one up to 2mss bytes long. */
+    count = 2 * tcp_mss(pcb);
+    do {
+      hs->buf = (char*)mem_malloc((mem_size_t)count);
+      if (hs->buf != NULL) {
+        hs->buf_len = count;
+        break;
+      }
+      count = count / 2;
+    } while (count > 100);
+
+    /* Did we get a send buffer? If not, return immediately. */
+    if (hs->buf == NULL) {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("No buff\n"));
+      return 0;
+    }
+  }
+
+  /* Read a block of data from the file. */
+  LWIP_DEBUGF(HTTPD_DEBUG, ("Trying to read %d bytes.\n", count));
+
+#if LWIP_HTTPD_FS_ASYNC_READ
+  count = fs_read_async(hs->handle, hs->buf, count, http_continue, hs);
+#else /* LWIP_HTTPD_FS_ASYNC_READ */
+  count = fs_read(hs->handle, hs->buf, count);
+#endif /* LWIP_HTTPD_FS_ASYNC_READ */
+  if (count < 0) {
+    if (count == FS_READ_DELAYED) {
+      /* Delayed read, wait for FS to unblock us */
+      return 0;
+    }
+    /* We reached the end of the file so this request is done.
+     * @todo: don't close here for HTTP/1.1? */
+    LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
+    http_eof(pcb, hs);
+    return 0;
+  }
+
+  /* Set up to send the block of data we just read */
+  LWIP_DEBUGF(HTTPD_DEBUG, ("Read %d bytes.\n", count));
+  hs->left = count;
+  hs->file = hs->buf;
+#if LWIP_HTTPD_SSI
+  if (hs->ssi) {
+    hs->ssi->parse_left = count;
+    hs->ssi->parsed = hs->buf;
+  }
+#endif /* LWIP_HTTPD_SSI */
+#else /* LWIP_HTTPD_DYNAMIC_FILE_READ */
+  LWIP_ASSERT("SSI and DYNAMIC_HEADERS turned off but eof not reached", 0);
+#endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
+  return 1;
+}
+
+/** Sub-function of http_send(): This is the normal send-routine for non-ssi files
+ *
+ * @returns: - 1: data has been written (so call tcp_ouput)
+ *           - 0: no data has been written (no need to call tcp_output)
+ */
+static u8_t
+http_send_data_nonssi(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  err_t err;
+  u16_t len;
+  u16_t mss;
+  u8_t data_to_send = 0;
+
+  /* We are not processing an SHTML file so no tag checking is necessary.
+   * Just send the data as we received it from the file. */
+
+  /* We cannot send more data than space available in the send
+     buffer. */
+  if (tcp_sndbuf(pcb) < hs->left) {
+    len = tcp_sndbuf(pcb);
+  } else {
+    len = (u16_t)hs->left;
+    LWIP_ASSERT("hs->left did not fit into u16_t!", (len == hs->left));
+  }
+  mss = tcp_mss(pcb);
+  if (len > (2 * mss)) {
+    len = 2 * mss;
+  }
+
+  err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+  if (err == ERR_OK) {
+    data_to_send = 1;
+    hs->file += len;
+    hs->left -= len;
+  }
+
+  return data_to_send;
+}
+
+#if HTTPD_SSI_SEGMENTS
+/** Sub-function of http_send(): This is the send-routine for precompiled
+ * ssi files, the pieces are sent like non-ssi files one after the other.
+ *
+ * @returns: - 1: data has been written (so call tcp_ouput)
+ *           - 0: no data has been written (no need to call tcp_output)
+ */
+static u8_t
+http_send_data_segs(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  u8_t data_to_send = 0;
+
+  while (http_send_data_nonssi(pcb, hs)) {
+    data_to_send = 1;
+    if ((hs->left != 0) || !http_ssi_seg_next(hs)) {
+      /* send buffer full or response complete */
+      break;
+    }
+  }
+  return data_to_send;
+}
+#endif /* HTTPD_SSI_SEGMENTS */
+
+#if LWIP_HTTPD_SSE
+/** Subscribe a connection to the event stream: the header is sent like a
+ * file, the current record follows it.
+ */
+static err_t
+http_sse_subscribe(struct http_state *hs)
+{
+  LWIP_DEBUGF(HTTPD_DEBUG, ("http_sse_subscribe %p\n", (void*)hs->pcb));
+  hs->file = (char *)http_sse_header;
+  hs->left = sizeof(http_sse_header) - 1;
+  hs->retries = 0;
+  hs->sse = 1;
+  hs->sse_pending = HTTP_SSE_EVENT;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  /* the stream ends with the connection */
+  hs->keepalive = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  /* events are small and written as a whole, don't hold them back */
+  tcp_nagle_disable(hs->pcb);
+  hs->sse_next = http_sse_conns;
+  http_sse_conns = hs;
+  /* the new client gets the current state, not the last notification */
+  http_sse_formatted = 0;
+  return ERR_OK;
+}
+
+/** Format the event of the last notification once for all clients.
+ *
+ * @return length of the event in http_sse_buf, 0 if there is none
+ */
+static u16_t
+http_sse_event(void)
+{
+  u16_t len;
+
+  if (!http_sse_formatted) {
+    http_sse_formatted = 1;
+    http_sse_len = 0;
+    len = g_pfnSSEHandler(http_sse_buf + HTTP_SSE_DATA_LEAD_IN, LWIP_HTTPD_SSE_MAX_LEN);
+    if ((len > 0) && (len <= LWIP_HTTPD_SSE_MAX_LEN)) {
+      MEMCPY(http_sse_buf, "data: ", HTTP_SSE_DATA_LEAD_IN);
+      MEMCPY(http_sse_buf + HTTP_SSE_DATA_LEAD_IN + len, "\n\n", HTTP_SSE_DATA_LEAD_OUT);
+      http_sse_len = HTTP_SSE_DATA_LEAD_IN + len + HTTP_SSE_DATA_LEAD_OUT;
+    }
+  }
+  return http_sse_len;
+}
+
+/** Sub-function of http_send(): This is the send-routine for clients of the
+ * event stream. An event is copied into the send buffer of the pcb as a
+ * whole or not at all, a pending event is retried from http_sent/http_poll.
+ *
+ * @returns: - 1: data has been written (so call tcp_ouput)
+ *           - 0: no data has been written (no need to call tcp_output)
+ */
+static u8_t
+http_send_data_sse(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  u16_t len;
+  u8_t data_to_send = 0;
+
+  if (hs->left > 0) {
+    /* the rest of the header, from flash */
+    len = (u16_t)hs->left;
+    if (http_write(pcb, hs->file, &len, 0) == ERR_OK) {
+      data_to_send = 1;
+      hs->file += len;
+      hs->left -= len;
+    }
+    if (hs->left > 0) {
+      return data_to_send;
+    }
+  }
+  if (hs->sse_pending & HTTP_SSE_EVENT) {
+    len = http_sse_event();
+    if (len == 0) {
+      hs->sse_pending &= ~HTTP_SSE_EVENT;
+    } else if (tcp_write(pcb, http_sse_buf, len, TCP_WRITE_FLAG_COPY) == ERR_OK) {
+      /* an event does as well as a ping */
+      hs->sse_pending = 0;
+      data_to_send = 1;
+    }
+  }
+  if (hs->sse_pending & HTTP_SSE_PING) {
+    if (tcp_write(pcb, http_sse_ping, sizeof(http_sse_ping) - 1, 0) == ERR_OK) {
+      hs->sse_pending &= ~HTTP_SSE_PING;
+      data_to_send = 1;
+    }
+  }
+  return data_to_send;
+}
+#endif /* LWIP_HTTPD_SSE */
+
+#if LWIP_HTTPD_CHUNKED
+/** Find the generator of a URI.
+ *
+ * @return the generator, NULL if there is none
+ */
+static const tChunked *
+http_find_chunked(const char *uri)
+{
+  int i;
+
+  for (i = 0; i < g_iNumChunked; i++) {
+    if (!strcmp(uri, g_pChunked[i].pcURIName)) {
+      return &g_pChunked[i];
+    }
+  }
+  return NULL;
+}
+
+/** Start a generated response: there is no file, http_send_data_chunked
+ * writes the header and calls the generator as the send buffer drains.
+ */
+static err_t
+http_chunked_start(struct http_state *hs, const tChunked *chunked, int is_09)
+{
+  LWIP_DEBUGF(HTTPD_DEBUG, ("http_chunked_start %s\n", chunked->pcURIName));
+  hs->chunked = chunked;
+  hs->chunk_cursor = 0;
+  hs->chunk_state = is_09 ? HTTP_CHUNK_BODY : HTTP_CHUNK_HEADER;
+  hs->retries = 0;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  if (!hs->chunk_framed) {
+    /* the end of the body is signalled by closing the connection */
+    hs->keepalive = 0;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  return ERR_OK;
+}
+
+/** Sub-function of http_send(): This is the send-routine for generated
+ * responses. The generator is only called when a whole chunk fits into the
+ * send buffer of the pcb, a chunk tcp_write refuses is generated again.
+ *
+ * @returns: - 1: data has been written (so call tcp_ouput)
+ *           - 0: no data has been written (no need to call tcp_output)
+ */
+static u8_t
+http_send_data_chunked(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  static const char hex[] = "0123456789abcdef";
+  u32_t cursor;
+  u16_t len;
+  int i;
+  err_t err;
+  u8_t data_to_send = 0;
+
+  if (hs->chunk_state == HTTP_CHUNK_HEADER) {
+    i = snprintf(http_chunk_buf, sizeof(http_chunk_buf), "%sContent-Type: %s" CRLF CRLF,
+      hs->chunk_framed ? http_chunked_header : http_chunked_header_10, hs->chunked->pcContentType);
+    LWIP_ASSERT("header too long", (i > 0) && (i < (int)sizeof(http_chunk_buf)));
+    len = (u16_t)i;
+    if ((tcp_sndbuf(pcb) < len) || (tcp_write(pcb, http_chunk_buf, len, TCP_WRITE_FLAG_COPY) != ERR_OK)) {
+      return 0;
+    }
+    data_to_send = 1;
+    hs->chunk_state = HTTP_CHUNK_BODY;
+  }
+  while ((hs->chunk_state == HTTP_CHUNK_BODY) && (tcp_sndbuf(pcb) >= sizeof(http_chunk_buf))) {
+    cursor = hs->chunk_cursor;
+    len = hs->chunked->pfnHandler(&hs->chunk_cursor, http_chunk_buf + HTTP_CHUNK_LEAD_IN, LWIP_HTTPD_CHUNK_SIZE);
+    LWIP_ASSERT("chunk too long", len <= LWIP_HTTPD_CHUNK_SIZE);
+    if (len == 0) {
+      hs->chunk_state = HTTP_CHUNK_LAST;
+      break;
+    }
+    if (hs->chunk_framed) {
+      /* leading zeros of the size are allowed */
+      for (i = 0; i < 4; i++) {
+        http_chunk_buf[i] = hex[(len >> (12 - 4 * i)) & 0xf];
+      }
+      MEMCPY(http_chunk_buf + 4, CRLF, 2);
+      MEMCPY(http_chunk_buf + HTTP_CHUNK_LEAD_IN + len, CRLF, 2);
+      err = tcp_write(pcb, http_chunk_buf, HTTP_CHUNK_LEAD_IN + len + HTTP_CHUNK_LEAD_OUT, TCP_WRITE_FLAG_COPY);
+    } else {
+      err = tcp_write(pcb, http_chunk_buf + HTTP_CHUNK_LEAD_IN, len, TCP_WRITE_FLAG_COPY);
+    }
+    if (err != ERR_OK) {
+      /* out of segments: the same chunk is generated from http_sent/http_poll */
+      hs->chunk_cursor = cursor;
+      break;
+    }
+    data_to_send = 1;
+  }
+  if (hs->chunk_state == HTTP_CHUNK_LAST) {
+    if (hs->chunk_framed &&
+        (tcp_write(pcb, http_chunk_last, sizeof(http_chunk_last) - 1, 0) != ERR_OK)) {
+      return data_to_send;
+    }
+    LWIP_DEBUGF(HTTPD_DEBUG, ("End of generated response.\n"));
+    http_eof(pcb, hs);
+    return 0;
+  }
+  return data_to_send;
+}
+#endif /* LWIP_HTTPD_CHUNKED */
+
+#if LWIP_HTTPD_WEBSOCKET
+#define HTTP_SHA1_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/** SHA-1 (FIPS 180-1) compression of one 64 byte block. */
+static void
+http_sha1_block(struct http_sha1_ctx *ctx, const u8_t *block)
+{
+  u32_t *h = ctx->h;
+  u32_t *w = ctx->w;
+  u32_t a, b, c, d, e, f, k, t;
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    w[i] = ((u32_t)block[4 * i] << 24) | ((u32_t)block[4 * i + 1] << 16) |
+           ((u32_t)block[4 * i + 2] << 8) | (u32_t)block[4 * i + 3];
+  }
+  a = h[0];
+  b = h[1];
+  c = h[2];
+  d = h[3];
+  e = h[4];
+  for (i = 0; i < 80; i++) {
+    if (i >= 16) {
+      /* the message schedule, 16 words at a time */
+      w[i & 15] = HTTP_SHA1_ROL(w[(i + 13) & 15] ^ w[(i + 8) & 15] ^ w[(i + 2) & 15] ^ w[i & 15], 1);
+    }
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    t = HTTP_SHA1_ROL(a, 5) + f + e + k + w[i & 15];
+    e = d;
+    d = c;
+    c = HTTP_SHA1_ROL(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+}
+
+/** SHA-1 of the message of up to 119 bytes in ctx->block (two blocks with
+ * the padding) into ctx->digest. */
+static void
+http_sha1(struct http_sha1_ctx *ctx, u8_t len)
+{
+  u8_t blocks;
+  int i;
 
-    /* Have we finished sending this string? */
-    if(hs->hdr_pos == hdrlen) {
-      /* Yes - move on to the next one */
-      hs->hdr_index++;
-      hs->hdr_pos = 0;
-    }
+  LWIP_ASSERT("message too long", len <= sizeof(ctx->block) - 9);
+  ctx->h[0] = 0x67452301;
+  ctx->h[1] = 0xEFCDAB89;
+  ctx->h[2] = 0x98BADCFE;
+  ctx->h[3] = 0x10325476;
+  ctx->h[4] = 0xC3D2E1F0;
+  /* message, 0x80, zeros and the length in bits */
+  blocks = (len + 9 > 64) ? 2 : 1;
+  memset(ctx->block + len, 0, sizeof(ctx->block) - len);
+  ctx->block[len] = 0x80;
+  ctx->block[blocks * 64 - 2] = (u8_t)(len >> 5);
+  ctx->block[blocks * 64 - 1] = (u8_t)(len << 3);
+  for (i = 0; i < blocks; i++) {
+    http_sha1_block(ctx, ctx->block + i * 64);
   }
-  /* If we get here and there are still header bytes to send, we send
-   * the header information we just wrote immediately. If there are no
-   * more headers to send, but we do have file data to send, drop through
-   * to try to send some file data too. */
-  if((hs->hdr_index < NUM_FILE_HDR_STRINGS) || !hs->file) {
-    LWIP_DEBUGF(HTTPD_DEBUG, ("tcp_output\n"));
-    return HTTP_DATA_TO_SEND_BREAK;
+  for (i = 0; i < 20; i++) {
+    ctx->digest[i] = (u8_t)(ctx->h[i >> 2] >> (24 - 8 * (i & 3)));
   }
-  return data_to_send;
 }
-#endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
 
-/** Sub-function of http_send(): end-of-file (or block) is reached,
- * either close the file or read the next block (if supported).
+/** Base64 (RFC 4648) of len bytes, dst receives 4 * ((len + 2) / 3) chars. */
+static void
+http_base64(const u8_t *src, u8_t len, char *dst)
+{
+  static const char alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  u32_t v;
+  int i;
+
+  for (i = 0; i < len; i += 3) {
+    v = (u32_t)src[i] << 16;
+    if (i + 1 < len) {
+      v |= (u32_t)src[i + 1] << 8;
+    }
+    if (i + 2 < len) {
+      v |= src[i + 2];
+    }
+    *dst++ = alphabet[(v >> 18) & 0x3f];
+    *dst++ = alphabet[(v >> 12) & 0x3f];
+    *dst++ = (i + 1 < len) ? alphabet[(v >> 6) & 0x3f] : '=';
+    *dst++ = (i + 2 < len) ? alphabet[v & 0x3f] : '=';
+  }
+}
+
+/** Upgrade the connection to a WebSocket: the key of the request is
+ * answered with its Sec-WebSocket-Accept, the handshake is sent like a file.
  *
- * @returns: 0 if the file is finished or no data has been read
- *           1 if the file is not finished and data has been read
+ * @return ERR_OK or ERR_ARG if the request or the handler refuses it
  */
-static u8_t
-http_check_eof(struct tcp_pcb *pcb, struct http_state *hs)
+static err_t
+http_ws_upgrade(struct http_state *hs)
 {
-#if LWIP_HTTPD_DYNAMIC_FILE_READ
-  int count;
-#endif /* LWIP_HTTPD_DYNAMIC_FILE_READ */
+  struct http_ws_state *ws;
 
-  /* Do we have a valid file handle? */
-  if (hs->handle == NULL) {
-    /* No - close the connection. */
-    http_eof(pcb, hs);
-    return 0;
+  if (hs->ws_key_end - hs->ws_key != HTTP_WS_KEY_LEN) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("http_ws_upgrade: invalid key\n"));
+    return ERR_ARG;
   }
-  if (fs_bytes_left(hs->handle) <= 0) {
-    /* We reached the end of the file so this request is done. */
-    LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
-    http_eof(pcb, hs);
+  ws = (struct http_ws_state *)mem_malloc(sizeof(struct http_ws_state));
+  if (ws == NULL) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("http_ws_upgrade: out of memory\n"));
+    return ERR_ARG;
+  }
+  if ((g_pWSHandler->open != NULL) && (g_pWSHandler->open(hs) != ERR_OK)) {
+    mem_free(ws);
+    return ERR_ARG;
+  }
+  /* SHA-1 of the key and the GUID of RFC 6455 */
+  MEMCPY(http_sha1_ctx.block, hs->ws_key, HTTP_WS_KEY_LEN);
+  MEMCPY(http_sha1_ctx.block + HTTP_WS_KEY_LEN, http_ws_guid, sizeof(http_ws_guid) - 1);
+  http_sha1(&http_sha1_ctx, HTTP_WS_KEY_LEN + sizeof(http_ws_guid) - 1);
+  http_base64(http_sha1_ctx.digest, sizeof(http_sha1_ctx.digest), ws->accept);
+  MEMCPY(ws->accept + HTTP_WS_ACCEPT_LEN, CRLF CRLF, 4);
+  ws->rx_len = 0;
+  ws->hdr_flash = 1;
+  ws->broken = 0;
+
+  hs->ws = ws;
+  hs->file = (char *)http_ws_header;
+  hs->left = sizeof(http_ws_header) - 1;
+  hs->retries = 0;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  /* no more HTTP on this connection */
+  hs->keepalive = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  /* messages are written as a whole, don't hold them back */
+  tcp_nagle_disable(hs->pcb);
+  return ERR_OK;
+}
+
+/** Returns the length of the largest frame payload that fits into the send
+ * buffer now: the header and each mss of the payload may need a pbuf of the
+ * send queue, the payload may start in the oversize of the last one. */
+static u16_t
+http_ws_room(struct tcp_pcb *pcb)
+{
+  u16_t room = tcp_sndbuf(pcb);
+  u16_t segs;
+
+  if ((room <= 4) || (tcp_sndqueuelen(pcb) + 3 > TCP_SND_QUEUELEN)) {
     return 0;
   }
-#if LWIP_HTTPD_DYNAMIC_FILE_READ
-  /* Do we already have a send buffer allocated? */
-  if(hs->buf) {
-    /* Yes - get the length of the buffer */
-    count = hs->buf_len;
-  } else {
-    /* We don't have a send buffer so allocate one up to 2mss bytes long. */
-    count = 2 * tcp_mss(pcb);
-    do {
-      hs->buf = (char*)mem_malloc((mem_size_t)count);
-      if (hs->buf != NULL) {
-        hs->buf_len = count;
-        break;
-      }
-      count = count / 2;
-    } while (count > 100);
+  room -= 4;
+  segs = TCP_SND_QUEUELEN - tcp_sndqueuelen(pcb) - 2;
+  if (room / tcp_mss(pcb) >= segs) {
+    room = segs * tcp_mss(pcb) - 1;
+  }
+  return room;
+}
 
-    /* Did we get a send buffer? If not, return immediately. */
-    if (hs->buf == NULL) {
-      LWIP_DEBUGF(HTTPD_DEBUG, ("No buff\n"));
-      return 0;
+/** Writes an unmasked frame into the send buffer, as a whole or not at all.
+ *
+ * @return ERR_OK, ERR_MEM if it does not fit
+ */
+static err_t
+http_ws_write(struct tcp_pcb *pcb, struct http_ws_state *ws, u8_t opcode, const void *data, u16_t len)
+{
+  u8_t hdr[4];
+  u16_t hdr_len = 2;
+  err_t err;
+
+  if (len > http_ws_room(pcb)) {
+    return ERR_MEM;
+  }
+  hdr[0] = HTTP_WS_FIN | opcode;
+  if (len < 126) {
+    hdr[1] = (u8_t)len;
+  } else {
+    hdr[1] = 126;
+    hdr[2] = (u8_t)(len >> 8);
+    hdr[3] = (u8_t)len;
+    hdr_len = 4;
+  }
+  err = tcp_write(pcb, hdr, hdr_len, TCP_WRITE_FLAG_COPY | (len > 0 ? TCP_WRITE_FLAG_MORE : 0));
+  if ((err == ERR_OK) && (len > 0)) {
+    err = tcp_write(pcb, data, len, TCP_WRITE_FLAG_COPY);
+    if (err != ERR_OK) {
+      /* out of pbufs with the header queued: the stream can't go on */
+      LWIP_DEBUGF(HTTPD_DEBUG, ("http_ws_write: frame cut off\n"));
+      ws->broken = 1;
     }
   }
+  return err;
+}
 
-  /* Read a block of data from the file. */
-  LWIP_DEBUGF(HTTPD_DEBUG, ("Trying to read %d bytes.\n", count));
+/** Sends a close frame with a status code and closes the connection. */
+static void
+http_ws_close(struct tcp_pcb *pcb, struct http_state *hs, u16_t status)
+{
+  u8_t payload[2];
 
-#if LWIP_HTTPD_FS_ASYNC_READ
-  count = fs_read_async(hs->handle, hs->buf, count, http_continue, hs);
-#else /* LWIP_HTTPD_FS_ASYNC_READ */
-  count = fs_read(hs->handle, hs->buf, count);
-#endif /* LWIP_HTTPD_FS_ASYNC_READ */
-  if (count < 0) {
-    if (count == FS_READ_DELAYED) {
-      /* Delayed read, wait for FS to unblock us */
-      return 0;
+  payload[0] = (u8_t)(status >> 8);
+  payload[1] = (u8_t)status;
+  http_ws_write(pcb, hs->ws, HTTP_WS_CLOSE, payload, status != 0 ? 2 : 0);
+  http_close_conn(pcb, hs);
+}
+
+/** Handles the complete frames received so far.
+ *
+ * @return ERR_OK or ERR_CLSD if the connection has been closed
+ */
+static err_t
+http_ws_parse(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  struct http_ws_state *ws = hs->ws;
+  u8_t *frame, *payload, opcode;
+  u16_t hdr_len, len, i;
+
+  while (ws->rx_len >= 2) {
+    frame = ws->rx;
+    opcode = frame[0] & 0x0f;
+    len = frame[1] & 0x7f;
+    hdr_len = 6;
+    if (!(frame[1] & HTTP_WS_MASK)) {
+      /* frames from clients are masked */
+      http_ws_close(pcb, hs, HTTP_WS_PROTOCOL_ERROR);
+      return ERR_CLSD;
     }
-    /* We reached the end of the file so this request is done.
-     * @todo: don't close here for HTTP/1.1? */
-    LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
-    http_eof(pcb, hs);
-    return 0;
+    if (!(frame[0] & HTTP_WS_FIN) || (opcode == HTTP_WS_CONT)) {
+      /* messages are not reassembled */
+      http_ws_close(pcb, hs, HTTP_WS_UNSUPPORTED);
+      return ERR_CLSD;
+    }
+    if (len == 126) {
+      if (ws->rx_len < 4) {
+        break;
+      }
+      len = ((u16_t)frame[2] << 8) | frame[3];
+      hdr_len = 8;
+    }
+    if ((len > LWIP_HTTPD_WS_MAX_MSG) || (frame[1] & 0x7f) == 127) {
+      http_ws_close(pcb, hs, HTTP_WS_TOO_BIG);
+      return ERR_CLSD;
+    }
+    if (ws->rx_len < hdr_len + len) {
+      break;
+    }
+    payload = frame + hdr_len;
+    for (i = 0; i < len; i++) {
+      payload[i] ^= frame[hdr_len - 4 + (i & 3)];
+    }
+    switch (opcode) {
+    case HTTPD_WS_TEXT:
+    case HTTPD_WS_BINARY:
+      g_pWSHandler->recv(hs, opcode, payload, len);
+      break;
+    case HTTP_WS_CLOSE:
+      /* echo the status code and close */
+      http_ws_close(pcb, hs, len >= 2 ? (((u16_t)payload[0] << 8) | payload[1]) : 0);
+      return ERR_CLSD;
+    case HTTP_WS_PING:
+      /* a pong which does not fit is left out */
+      http_ws_write(pcb, ws, HTTP_WS_PONG, payload, len);
+      break;
+    case HTTP_WS_PONG:
+      break;
+    default:
+      http_ws_close(pcb, hs, HTTP_WS_PROTOCOL_ERROR);
+      return ERR_CLSD;
+    }
+    ws->rx_len -= hdr_len + len;
+    memmove(ws->rx, ws->rx + hdr_len + len, ws->rx_len);
   }
+  return ERR_OK;
+}
 
-  /* Set up to send the block of data we just read */
-  LWIP_DEBUGF(HTTPD_DEBUG, ("Read %d bytes.\n", count));
-  hs->left = count;
-  hs->file = hs->buf;
-#if LWIP_HTTPD_SSI
-  if (hs->ssi) {
-    hs->ssi->parse_left = count;
-    hs->ssi->parsed = hs->buf;
+/** Data received on a WebSocket: collect the frames in the receive buffer
+ * of the connection and handle each one when it is complete. */
+static void
+http_ws_recv(struct tcp_pcb *pcb, struct http_state *hs, struct pbuf *p)
+{
+  u16_t off, len;
+
+  tcp_recved(pcb, p->tot_len);
+  hs->retries = 0;
+  for (off = 0; off < p->tot_len; off += len) {
+    len = LWIP_MIN(p->tot_len - off, sizeof(hs->ws->rx) - hs->ws->rx_len);
+    pbuf_copy_partial(p, hs->ws->rx + hs->ws->rx_len, len, off);
+    hs->ws->rx_len += len;
+    if (http_ws_parse(pcb, hs) != ERR_OK) {
+      break;
+    }
   }
-#endif /* LWIP_HTTPD_SSI */
-#else /* LWIP_HTTPD_DYNAMIC_FILE_READ */
-  LWIP_ASSERT("SSI and DYNAMIC_HEADERS turned off but eof not reached", 0);
-#endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
-  return 1;
+  pbuf_free(p);
 }
 
-/** Sub-function of http_send(): This is the normal send-routine for non-ssi files
+/** Sub-function of http_send(): This is the send-routine for WebSockets,
+ * it sends the handshake. The messages are sent by httpd_ws_send.
  *
  * @returns: - 1: data has been written (so call tcp_ouput)
  *           - 0: no data has been written (no need to call tcp_output)
  */
 static u8_t
-http_send_data_nonssi(struct tcp_pcb *pcb, struct http_state *hs)
+http_send_data_ws(struct tcp_pcb *pcb, struct http_state *hs)
 {
-  err_t err;
   u16_t len;
-  u16_t mss;
   u8_t data_to_send = 0;
 
-  /* We are not processing an SHTML file so no tag checking is necessary.
-   * Just send the data as we received it from the file. */
-
-  /* We cannot send more data than space available in the send
-     buffer. */
-  if (tcp_sndbuf(pcb) < hs->left) {
-    len = tcp_sndbuf(pcb);
-  } else {
+  while (hs->left > 0) {
     len = (u16_t)hs->left;
-    LWIP_ASSERT("hs->left did not fit into u16_t!", (len == hs->left));
-  }
-  mss = tcp_mss(pcb);
-  if (len > (2 * mss)) {
-    len = 2 * mss;
-  }
-
-  err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
-  if (err == ERR_OK) {
+    if (http_write(pcb, hs->file, &len, hs->ws->hdr_flash ? 0 : TCP_WRITE_FLAG_COPY) != ERR_OK) {
+      break;
+    }
     data_to_send = 1;
     hs->file += len;
     hs->left -= len;
+    if ((hs->left == 0) && hs->ws->hdr_flash) {
+      /* the accept value ends the handshake */
+      hs->ws->hdr_flash = 0;
+      hs->file = hs->ws->accept;
+      hs->left = sizeof(hs->ws->accept);
+    }
   }
-
   return data_to_send;
 }
+#endif /* LWIP_HTTPD_WEBSOCKET */
 
 #if LWIP_HTTPD_SSI
 /** Sub-function of http_send(): This is the send-routine for ssi files
@@ -1417,6 +3176,18 @@ http_send_data_ssi(struct tcp_pcb *pcb, struct http_state *hs)
             hs->left -= len;
           }
         } else {
+#if LWIP_HTTPD_ASYNC_HANDLERS
+          if (ssi->tag_pending) {
+            if (!HTTP_IS_PENDING(hs)) {
+              /* the handler has answered: ask it again */
+              get_tag_insert(hs);
+            }
+            if (ssi->tag_pending) {
+              /* the text before the tag is sent, wait for the insert */
+              return data_to_send;
+            }
+          }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
 #if LWIP_HTTPD_SSI_MULTIPART
           if(ssi->tag_index >= ssi->tag_insert_len) {
             /* Did the last SSIHandler have more to send? */
@@ -1496,13 +3267,13 @@ http_send_data_ssi(struct tcp_pcb *pcb, struct http_state *hs)
 #endif /* LWIP_HTTPD_SSI */
 
 /**
- * Try to send more data on this pcb.
+ * Try to send more data on this pcb (implementation of http_send).
  *
  * @param pcb the pcb to send data
  * @param hs connection state
  */
 static u8_t
-http_send(struct tcp_pcb *pcb, struct http_state *hs)
+http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
 {
   u8_t data_to_send = HTTP_NO_DATA_TO_SEND;
 
@@ -1520,6 +3291,29 @@ http_send(struct tcp_pcb *pcb, struct http_state *hs)
     return 0;
   }
 
+#if LWIP_HTTPD_ASYNC_HANDLERS
+  if (HTTP_IS_PENDING(hs)) {
+    /* a handler has not answered yet, http_handler_continue() goes on */
+    return 0;
+  }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+
+#if LWIP_HTTPD_SSE
+  if (hs->sse) {
+    return http_send_data_sse(pcb, hs);
+  }
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_WEBSOCKET
+  if (hs->ws != NULL) {
+    return http_send_data_ws(pcb, hs);
+  }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_CHUNKED
+  if (hs->chunked != NULL) {
+    return http_send_data_chunked(pcb, hs);
+  }
+#endif /* LWIP_HTTPD_CHUNKED */
+
 #if LWIP_HTTPD_FS_ASYNC_READ
   /* Check if we are allowed to read from this file.
      (e.g. SSI might want to delay sending until data is available) */
@@ -1546,6 +3340,11 @@ http_send(struct tcp_pcb *pcb, struct http_state *hs)
     }
   }
 
+#if HTTPD_SSI_SEGMENTS
+  if(hs->seg != NULL) {
+    data_to_send = http_send_data_segs(pcb, hs);
+  } else
+#endif /* HTTPD_SSI_SEGMENTS */
 #if LWIP_HTTPD_SSI
   if(hs->ssi) {
     data_to_send = http_send_data_ssi(pcb, hs);
@@ -1566,6 +3365,23 @@ http_send(struct tcp_pcb *pcb, struct http_state *hs)
   return data_to_send;
 }
 
+/**
+ * Try to send more data on this pcb.
+ *
+ * @param pcb the pcb to send data
+ * @param hs connection state
+ */
+static u8_t
+http_send(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  u8_t ret;
+
+  PROBE_BEGIN(PROBE_HTTP_SEND);
+  ret = http_send_data(pcb, hs);
+  PROBE_END(PROBE_HTTP_SEND);
+  return ret;
+}
+
 #if LWIP_HTTPD_SUPPORT_EXTSTATUS
 /** Initialize a http connection with a file to send for an error message
  *
@@ -1850,7 +3666,178 @@ http_continue(void *connection)
     }
   }
 }
-#endif /* LWIP_HTTPD_FS_ASYNC_READ */
+#endif /* LWIP_HTTPD_FS_ASYNC_READ */
+
+#if LWIP_HTTPD_ASYNC_HANDLERS
+/** Park a connection until its handler calls the continue callback.
+ *
+ * @param hs the connection state
+ * @param pending HTTP_PENDING_* what the connection waits for
+ */
+static void
+http_park(struct http_state *hs, u8_t pending)
+{
+  if (!hs->pending) {
+    hs->pending_next = http_pending_conns;
+    http_pending_conns = hs;
+  }
+  hs->pending = pending;
+}
+
+void
+httpd_get_continue(fs_wait_cb *callback_fn, void **callback_arg)
+{
+  LWIP_ASSERT("httpd_get_continue: not called by a handler", http_handler_conn != NULL);
+  *callback_fn = http_handler_continue;
+  *callback_arg = http_handler_conn;
+}
+
+#if LWIP_HTTPD_CGI
+/** A CGI has returned HTTPD_CGI_PENDING: keep its parameters for the next
+ * call, they point into the request which is gone by then.
+ *
+ * @param hs the connection state
+ * @param index the CGI
+ * @param count number of parameters in hs->params and hs->param_vals
+ * @param is_09 1 if the request is HTTP/0.9 (no HTTP headers in response)
+ * @return ERR_OK if the connection is parked, ERR_ARG if out of memory
+ */
+static err_t
+http_cgi_park(struct http_state *hs, int index, int count, int is_09)
+{
+  char *start = NULL, *end = NULL, *str;
+  int i;
+
+  for (i = 0; i < 2 * count; i++) {
+    str = (i < count) ? hs->params[i] : hs->param_vals[i - count];
+    if (str != NULL) {
+      if ((start == NULL) || (str < start)) {
+        start = str;
+      }
+      str += strlen(str) + 1;
+      if (str > end) {
+        end = str;
+      }
+    }
+  }
+  if (start != NULL) {
+    hs->cgi_params = (char *)mem_malloc((mem_size_t)(end - start));
+    if (hs->cgi_params == NULL) {
+      return ERR_ARG;
+    }
+    MEMCPY(hs->cgi_params, start, end - start);
+    for (i = 0; i < count; i++) {
+      hs->params[i] = hs->cgi_params + (hs->params[i] - start);
+      if (hs->param_vals[i] != NULL) {
+        hs->param_vals[i] = hs->cgi_params + (hs->param_vals[i] - start);
+      }
+    }
+  }
+  hs->cgi_index = index;
+  hs->cgi_count = count;
+  hs->pending_09 = (u8_t)is_09;
+  http_park(hs, HTTP_PENDING_CGI);
+  return ERR_OK;
+}
+#endif /* LWIP_HTTPD_CGI */
+
+/** Resume a connection parked for a handler.
+ * This is the callback function got by httpd_get_continue().
+ */
+static void
+http_handler_continue(void *connection)
+{
+  struct http_state *hs, **prev;
+  struct tcp_pcb *pcb;
+#if LWIP_HTTPD_CGI
+  const char *uri;
+#endif /* LWIP_HTTPD_CGI */
+  u8_t pending;
+
+  for (prev = &http_pending_conns; *prev != connection; prev = &(*prev)->pending_next) {
+    if (*prev == NULL) {
+      /* closed meanwhile or already resumed */
+      return;
+    }
+  }
+  hs = *prev;
+  *prev = hs->pending_next;
+  pending = hs->pending;
+  hs->pending = 0;
+  LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_handler_continue: handler %d answered\n", (int)pending));
+
+#if LWIP_HTTPD_CGI
+  if (pending == HTTP_PENDING_CGI) {
+    http_handler_conn = hs;
+    uri = g_pCGIs[hs->cgi_index].pfnCGIHandler(hs->cgi_index, hs->cgi_count,
+                                               hs->params, hs->param_vals);
+    http_handler_conn = NULL;
+    if (uri == HTTPD_CGI_PENDING) {
+      http_park(hs, HTTP_PENDING_CGI);
+      return;
+    }
+    if (hs->cgi_params != NULL) {
+      mem_free(hs->cgi_params);
+      hs->cgi_params = NULL;
+    }
+    if (http_open_file(hs, uri, hs->pending_09) != ERR_OK) {
+      http_close_conn(hs->pcb, hs);
+      return;
+    }
+  }
+#endif /* LWIP_HTTPD_CGI */
+#if HTTPD_SSI_SEGMENTS
+  if (pending == HTTP_PENDING_SEGS) {
+    /* the rest of the inserts, nothing is allocated any more */
+    http_ssi_segs_render(hs, hs->pending_09);
+  }
+#endif /* HTTPD_SSI_SEGMENTS */
+
+  pcb = hs->pcb;
+  if (pcb != NULL) {
+    /* not called by tcp: output what has been written, the whole response
+       may be written (and hs closed or ready for the next request) */
+    http_resumed = hs;
+    http_send(pcb, hs);
+    if (http_resumed != NULL) {
+      tcp_output(pcb);
+    }
+    http_resumed = NULL;
+  }
+}
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+/** Remove a parsed request from the queue of received pbufs, keeping the
+ * pipelined requests that follow it.
+ *
+ * @param hs the connection state
+ * @param len length of the request
+ */
+static void
+http_req_consume(struct http_state *hs, u16_t len)
+{
+  struct pbuf *q;
+
+  while ((hs->req != NULL) && (len >= hs->req->len)) {
+    q = hs->req;
+    len -= q->len;
+    hs->req = q->next;
+    if (hs->req != NULL) {
+      /* free only the first pbuf of the chain */
+      pbuf_ref(hs->req);
+    }
+    pbuf_free(q);
+  }
+  if (hs->req != NULL) {
+    pbuf_header(hs->req, -(s16_t)len);
+    if (hs->req->tot_len == 0) {
+      pbuf_free(hs->req);
+      hs->req = NULL;
+    }
+  }
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
 
 /**
  * When data has been received in the correct state, try to parse it
@@ -1878,7 +3865,6 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
 #endif /* LWIP_HTTPD_SUPPORT_POST */
 
   LWIP_UNUSED_ARG(pcb); /* only used for post */
-  LWIP_ASSERT("p != NULL", p != NULL);
   LWIP_ASSERT("hs != NULL", hs != NULL);
 
   if ((hs->handle != NULL) || (hs->file != NULL)) {
@@ -1889,25 +3875,32 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
   }
 
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  /* p is NULL to parse pipelined requests already queued */
+  LWIP_ASSERT("p != NULL", (p != NULL) || (hs->req != NULL));
 
-  LWIP_DEBUGF(HTTPD_DEBUG, ("Received %"U16_F" bytes\n", p->tot_len));
+  if (p != NULL) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("Received %"U16_F" bytes\n", p->tot_len));
 
-  /* first check allowed characters in this pbuf? */
+    /* first check allowed characters in this pbuf? */
 
-  /* enqueue the pbuf */
-  if (hs->req == NULL) {
-    LWIP_DEBUGF(HTTPD_DEBUG, ("First pbuf\n"));
-    hs->req = p;
-  } else {
-    LWIP_DEBUGF(HTTPD_DEBUG, ("pbuf enqueued\n"));
-    pbuf_cat(hs->req, p);
+    /* enqueue the pbuf */
+    if (hs->req == NULL) {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("First pbuf\n"));
+      hs->req = p;
+    } else {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("pbuf enqueued\n"));
+      pbuf_cat(hs->req, p);
+    }
   }
+  p = hs->req;
 
   if (hs->req->next != NULL) {
     data_len = LWIP_MIN(hs->req->tot_len, LWIP_HTTPD_MAX_REQ_LENGTH);
     pbuf_copy_partial(hs->req, httpd_req_buf, data_len, 0);
     data = httpd_req_buf;
   } else
+#else /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  LWIP_ASSERT("p != NULL", p != NULL);
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
   {
     data = (char *)p->payload;
@@ -1969,13 +3962,33 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
       uri_len = sp2 - (sp1 + 1);
       if ((sp2 != 0) && (sp2 > sp1)) {
         /* wait for CRLFCRLF (indicating end of HTTP headers) before parsing anything */
-        if (strnstr(data, CRLF CRLF, data_len) != NULL) {
+        char *hdr_end = strnstr(data, CRLF CRLF, data_len);
+        if (hdr_end != NULL) {
           char *uri = sp1 + 1;
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-          if (!is_09 && strnstr(data, HTTP11_CONNECTIONKEEPALIVE, data_len)) {
-            hs->keepalive = 1;
+          hs->requests++;
+          hs->keepalive = !is_09 && (hs->requests < HTTPD_MAX_KEEPALIVE_REQUESTS) &&
+            http_wants_keepalive(data, data_len, sp2 + 1);
+#if LWIP_HTTPD_SUPPORT_POST
+          if (is_post) {
+            /* the request body is not delimited for the next request */
+            hs->keepalive = 0;
           }
+#endif /* LWIP_HTTPD_SUPPORT_POST */
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if HTTPD_FS_GZIP
+          hs->accept_gzip = !is_09 && http_accepts_gzip(data, data_len);
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+          hs->if_none_match = is_09 ? NULL :
+            http_find_header(data, data_len, "if-none-match:", &hs->if_none_match_end);
+#endif /* HTTPD_FS_ETAG */
+#if LWIP_HTTPD_WEBSOCKET
+          hs->ws_key = is_09 ? NULL : http_ws_request(data, data_len, &hs->ws_key_end);
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_CHUNKED
+          hs->chunk_framed = !is_09 && !strncmp(sp2 + 1, HTTP11_VERSION, sizeof(HTTP11_VERSION) - 1);
+#endif /* LWIP_HTTPD_CHUNKED */
           /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
           *sp1 = 0;
           uri[uri_len] = 0;
@@ -2002,7 +4015,21 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
           } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
           {
-            return http_find_file(hs, uri, is_09);
+            err_t found = http_find_file(hs, uri, is_09);
+#if HTTPD_FS_ETAG
+            /* points into the request */
+            hs->if_none_match = NULL;
+#endif /* HTTPD_FS_ETAG */
+#if LWIP_HTTPD_WEBSOCKET
+            hs->ws_key = NULL;
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+            if (hs->keepalive) {
+              /* keep the pipelined requests following this one */
+              http_req_consume(hs, (u16_t)(hdr_end + 4 - data));
+            }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+            return found;
           }
         }
       } else {
@@ -2061,7 +4088,7 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
        that exists. */
     for (loop = 0; loop < NUM_DEFAULT_FILENAMES; loop++) {
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Looking for %s...\n", g_psDefaultFilenames[loop].name));
-      err = fs_open(&hs->file_handle, (char *)g_psDefaultFilenames[loop].name);
+      err = http_fs_open(hs, (char *)g_psDefaultFilenames[loop].name);
       uri = (char *)g_psDefaultFilenames[loop].name;
       if(err == ERR_OK) {
         file = &hs->file_handle;
@@ -2089,49 +4116,144 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
       params++;
     }
 
+#if LWIP_HTTPD_SSE
+    if ((g_pcSSEURI != NULL) && !is_09 && !strcmp(uri, g_pcSSEURI)) {
+      /* no file: the response goes on as long as the connection */
+      return http_sse_subscribe(hs);
+    }
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_WEBSOCKET
+    if ((g_pWSHandler != NULL) && (hs->ws_key != NULL) && !strcmp(uri, g_pWSHandler->uri)) {
+      if (http_ws_upgrade(hs) != ERR_OK) {
+        return http_find_error_file(hs, 400);
+      }
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
 #if LWIP_HTTPD_CGI
     /* Does the base URI we have isolated correspond to a CGI handler? */
     if (g_iNumCGIs && g_pCGIs) {
-      for (i = 0; i < g_iNumCGIs; i++) {
-        if (strcmp(uri, g_pCGIs[i].pcCGIName) == 0) {
-          /*
-           * We found a CGI that handles this URI so extract the
-           * parameters and call the handler.
-           */
-           count = extract_uri_parameters(hs, params);
-           uri = g_pCGIs[i].pfnCGIHandler(i, count, hs->params,
-                                          hs->param_vals);
-           break;
-        }
+      i = http_find_cgi(uri);
+      if (i >= 0) {
+        /*
+         * We found a CGI that handles this URI so extract the
+         * parameters and call the handler.
+         */
+         count = extract_uri_parameters(hs, params);
+#if LWIP_HTTPD_ASYNC_HANDLERS
+         http_handler_conn = hs;
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
+         uri = g_pCGIs[i].pfnCGIHandler(i, count, hs->params,
+                                        hs->param_vals);
+#if LWIP_HTTPD_ASYNC_HANDLERS
+         http_handler_conn = NULL;
+         if (uri == HTTPD_CGI_PENDING) {
+           return http_cgi_park(hs, i, count, is_09);
+         }
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS */
       }
     }
 #endif /* LWIP_HTTPD_CGI */
 
-    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opening %s\n", uri));
+    return http_open_file(hs, uri, is_09);
+  }
+  return http_init_file(hs, file, is_09, uri, tag_check);
+}
 
-    err = fs_open(&hs->file_handle, uri);
-    if (err == ERR_OK) {
-       file = &hs->file_handle;
-    } else {
-      file = http_get_404_file(hs, &uri);
-    }
+/** Open the file of a URI (or the 404 page) and initialize hs to send it,
+ * with SSI tag checking for the SSI extensions. A URI of a generator
+ * (also one returned by a CGI handler) starts the generated response.
+ *
+ * @param hs the connection state
+ * @param uri the file name (without parameters)
+ * @param is_09 1 if the request is HTTP/0.9 (no HTTP headers in response)
+ * @return ERR_OK if file was found and hs has been initialized correctly
+ *         another err_t otherwise
+ */
+static err_t
+http_open_file(struct http_state *hs, const char *uri, int is_09)
+{
+  struct fs_file *file;
 #if LWIP_HTTPD_SSI
-    if (file != NULL) {
-      /* See if we have been asked for an shtml file and, if so,
-         enable tag checking. */
-      tag_check = 0;
-      for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
-        if (strstr(uri, g_pcSSIExtensions[loop])) {
-          tag_check = 1;
-          break;
-        }
+  size_t loop;
+#else /* LWIP_HTTPD_SSI */
+  const
+#endif /* LWIP_HTTPD_SSI */
+  u8_t tag_check = 0;
+#if LWIP_HTTPD_CHUNKED
+  const tChunked *chunked;
+
+  chunked = http_find_chunked(uri);
+  if (chunked != NULL) {
+    /* no file: the body is generated while it is sent */
+    return http_chunked_start(hs, chunked, is_09);
+  }
+#endif /* LWIP_HTTPD_CHUNKED */
+
+  LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opening %s\n", uri));
+
+  if (http_fs_open(hs, uri) == ERR_OK) {
+     file = &hs->file_handle;
+  } else {
+    file = http_get_404_file(hs, &uri);
+  }
+#if LWIP_HTTPD_SSI
+  if (file != NULL) {
+    /* See if we have been asked for an shtml file and, if so,
+       enable tag checking. */
+    for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
+      if (strstr(uri, g_pcSSIExtensions[loop])) {
+        tag_check = 1;
+        break;
       }
     }
-#endif /* LWIP_HTTPD_SSI */
   }
+#endif /* LWIP_HTTPD_SSI */
   return http_init_file(hs, file, is_09, uri, tag_check);
 }
 
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Check if another response may follow the response of hs on the
+ * connection: the client must know where it ends, so it has to be a HTTP/1.1
+ * response with a "Content-Length" header or without a body (304).
+ * SSI responses are rendered first.
+ *
+ * @param hs http connection state with the file to send set up
+ * @return 1 if the connection may persist after this response
+ */
+static u8_t
+http_check_keepalive(struct http_state *hs)
+{
+  const char *hdr_end, *eol;
+
+  if ((hs->handle == NULL) || !hs->handle->http_header_included ||
+      (hs->left < sizeof(HTTP11_VERSION)) || strncmp(hs->file, HTTP11_VERSION " ", sizeof(HTTP11_VERSION))) {
+    return 0;
+  }
+#if HTTPD_SSI_SEGMENTS
+  if (hs->seg != NULL) {
+    /* "Content-Length" is sent after the header of the file */
+    return 1;
+  }
+#endif /* HTTPD_SSI_SEGMENTS */
+  hdr_end = strnstr(hs->file, CRLF CRLF, hs->left);
+  if (hdr_end == NULL) {
+    return 0;
+  }
+  if (!strncmp(hs->file + sizeof(HTTP11_VERSION), "304 ", 4)) {
+    /* never has a body, the header ends it */
+    return 1;
+  }
+#if LWIP_HTTPD_SSI
+  if (hs->ssi != NULL) {
+    return http_ssi_render(hs, hdr_end) == ERR_OK;
+  }
+#endif /* LWIP_HTTPD_SSI */
+  return http_find_header(hs->file, (u16_t)(hdr_end + 4 - hs->file), "content-length:", &eol) != NULL;
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 /** Initialize a http connection with a file to send (if found).
  * Called by http_find_file and http_find_error_file.
  *
@@ -2148,21 +4270,6 @@ http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const cha
 {
   if (file != NULL) {
     /* file opened, initialise struct http_state */
-#if LWIP_HTTPD_SSI
-    if (tag_check) {
-      struct http_ssi_state *ssi = http_ssi_state_alloc();
-      if (ssi != NULL) {
-        ssi->tag_index = 0;
-        ssi->tag_state = TAG_NONE;
-        ssi->parsed = file->data;
-        ssi->parse_left = file->len;
-        ssi->tag_end = file->data;
-        hs->ssi = ssi;
-      }
-    }
-#else /* LWIP_HTTPD_SSI */
-    LWIP_UNUSED_ARG(tag_check);
-#endif /* LWIP_HTTPD_SSI */
     hs->handle = file;
     hs->file = (char*)file->data;
     LWIP_ASSERT("File length must be positive!", (file->len >= 0));
@@ -2186,12 +4293,52 @@ http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const cha
       }
     }
 #endif /* LWIP_HTTPD_SUPPORT_V09*/
+#if HTTPD_FS_ETAG
+    if (!is_09 && (file->etag != NULL) && (hs->if_none_match != NULL) &&
+        http_etag_match(hs->if_none_match, hs->if_none_match_end, file->etag)) {
+      /* the client's copy is current: send the prebuilt 304 header only */
+      hs->file = (char *)file->not_modified;
+      hs->left = (u32_t)strlen(file->not_modified);
+    }
+#endif /* HTTPD_FS_ETAG */
+#if LWIP_HTTPD_SSI
+#if HTTPD_RESPONSE_CACHE
+    hs->cache_rule = tag_check ? http_cache_rule(file, uri) : HTTP_CACHE_NO_RULE;
+    hs->cache_gen = http_cache_gen;
+#endif /* HTTPD_RESPONSE_CACHE */
+#if HTTPD_SSI_SEGMENTS
+    if (tag_check && (file->ssi_segs != NULL) && (http_ssi_segs_render(hs, is_09) != ERR_MEM)) {
+      /* precompiled by makefsdata: no parser needed (the inserts may still
+         be rendered when a pending handler answers) */
+      tag_check = 0;
+    }
+#endif /* HTTPD_SSI_SEGMENTS */
+    if (tag_check) {
+      struct http_ssi_state *ssi = http_ssi_state_alloc();
+      if (ssi != NULL) {
+        ssi->tag_index = 0;
+        ssi->tag_state = TAG_NONE;
+        ssi->parsed = file->data;
+        ssi->parse_left = file->len;
+        ssi->tag_end = file->data;
+        hs->ssi = ssi;
+      }
+    }
+#else /* LWIP_HTTPD_SSI */
+    LWIP_UNUSED_ARG(tag_check);
+#endif /* LWIP_HTTPD_SSI */
   } else {
     hs->handle = NULL;
     hs->file = NULL;
     hs->left = 0;
     hs->retries = 0;
   }
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  if (hs->keepalive && !http_check_keepalive(hs)) {
+    /* the end of the response is signalled by closing the connection */
+    hs->keepalive = 0;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 #if LWIP_HTTPD_DYNAMIC_HEADERS
     /* Determine the HTTP headers to send based on the file extension of
    * the requested URI. */
@@ -2249,6 +4396,10 @@ http_sent(void *arg, struct tcp_pcb *pcb, u16_t len)
  * The poll function is called every 2nd second.
  * If there has been no data sent (which resets the retries) in 8 seconds, close.
  * If the last portion of a file has not been sent in 2 seconds, close.
+ * An idle persistent connection is closed after HTTPD_KEEPALIVE_TIMEOUT polls.
+ * A connection waiting for a CGI or SSI handler is not idle: it sends nothing
+ * and is closed when the retries run out. A generated response is continued
+ * like a file.
  *
  * This could be increased, but we don't want to waste resources for bad connections.
  */
@@ -2279,11 +4430,46 @@ http_poll(void *arg, struct tcp_pcb *pcb)
       http_close_conn(pcb, hs);
       return ERR_OK;
     }
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      if (hs->retries == HTTPD_MAX_RETRIES - 1) {
+        /* nothing acknowledged for a while: is the client still there? */
+        hs->sse_pending |= HTTP_SSE_PING;
+      }
+      if (http_send(pcb, hs)) {
+        tcp_output(pcb);
+      }
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_WEBSOCKET
+    if (hs->ws != NULL) {
+      if (hs->ws->broken) {
+        http_close_or_abort_conn(pcb, hs, 1);
+        return ERR_ABRT;
+      }
+      if (http_send(pcb, hs) ||
+          ((hs->left == 0) && (hs->retries == HTTPD_MAX_RETRIES - 1) &&
+           (http_ws_write(pcb, hs->ws, HTTP_WS_PING, NULL, 0) == ERR_OK))) {
+        /* nothing received for a while: the pong tells the client is there */
+        tcp_output(pcb);
+      }
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if ((hs->requests != 0) && (hs->handle == NULL) && !HTTP_IS_PENDING(hs) && !HTTP_IS_CHUNKED(hs) &&
+        (hs->retries >= HTTPD_KEEPALIVE_TIMEOUT)) {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("http_poll: persistent connection idle, close\n"));
+      http_close_conn(pcb, hs);
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 
     /* If this connection has a file open, try to send some more data. If
      * it has not yet received a GET request, don't do this since it will
      * cause the connection to close immediately. */
-    if(hs && (hs->handle)) {
+    if(hs && ((hs->handle) || HTTP_IS_CHUNKED(hs))) {
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_poll: try to send more data\n"));
       if(http_send(pcb, hs)) {
         /* If we wrote anything to be sent, go ahead and send it now. */
@@ -2296,6 +4482,79 @@ http_poll(void *arg, struct tcp_pcb *pcb)
   return ERR_OK;
 }
 
+/**
+ * Parse the request received so far and start sending the response.
+ *
+ * @param p the received pbuf, NULL to parse the queued pipelined requests
+ * @param hs the connection state
+ * @param pcb the tcp_pcb which received the request
+ */
+static void
+http_process_one_request(struct pbuf *p, struct http_state *hs, struct tcp_pcb *pcb)
+{
+  err_t parsed = http_parse_request(&p, hs, pcb);
+  LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
+    || parsed == ERR_INPROGRESS ||parsed == ERR_ARG || parsed == ERR_USE);
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+  if ((parsed != ERR_INPROGRESS) && (hs->req != NULL)
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+      /* pipelined requests stay queued on a persistent connection */
+      && ((parsed != ERR_OK) || !hs->keepalive)
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+     ) {
+    /* request fully parsed or error */
+    pbuf_free(hs->req);
+    hs->req = NULL;
+  }
+#else /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  if (p != NULL) {
+    /* pbuf not passed to application, free it now */
+    pbuf_free(p);
+  }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  if (parsed == ERR_OK) {
+#if LWIP_HTTPD_SUPPORT_POST
+    if (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+    {
+      LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", hs->file, hs->left));
+      http_send(pcb, hs);
+    }
+  } else if (parsed == ERR_ARG) {
+    /* @todo: close on ERR_USE? */
+    http_close_conn(pcb, hs);
+  }
+}
+
+/**
+ * Answer the request received so far and, as long as each response is sent
+ * at once, the pipelined requests behind it (see http_eof).
+ */
+static void
+http_process_request(struct pbuf *p, struct http_state *hs, struct tcp_pcb *pcb)
+{
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+  u8_t outer = !http_processing;
+
+  http_processing = 1;
+  while (1) {
+    http_process_one_request(p, hs, pcb);
+    if (!outer || (http_pipelined == NULL)) {
+      break;
+    }
+    hs = http_pipelined;
+    http_pipelined = NULL;
+    pcb = hs->pcb;
+    p = NULL;
+  }
+  if (outer) {
+    http_processing = 0;
+  }
+#else /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+  http_process_one_request(p, hs, pcb);
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+}
+
 /**
  * Data has been received on this pcb.
  * For HTTP 1.0, this should normally only happen once (if the request fits in one packet).
@@ -2303,7 +4562,6 @@ http_poll(void *arg, struct tcp_pcb *pcb)
 static err_t
 http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
 {
-  err_t parsed = ERR_ABRT;
   struct http_state *hs = (struct http_state *)arg;
   LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: pcb=%p pbuf=%p err=%s\n", (void*)pcb,
     (void*)p, lwip_strerr(err)));
@@ -2323,6 +4581,30 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
     return ERR_OK;
   }
 
+  LAT_APP(LAT_APP_HTTP);
+
+#if LWIP_HTTPD_WEBSOCKET
+  if (hs->ws != NULL) {
+    http_ws_recv(pcb, hs, p);
+    return ERR_OK;
+  }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST
+  if (hs->keepalive && ((hs->handle != NULL) || HTTP_IS_PENDING(hs) || HTTP_IS_CHUNKED(hs))) {
+    /* Pipelined request while sending a response: queue it and keep it
+       in the receive window until the response is done (http_state_reuse) */
+    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: pipelined request queued\n"));
+    hs->req_unrecved += p->tot_len;
+    if (hs->req == NULL) {
+      hs->req = p;
+    } else {
+      pbuf_cat(hs->req, p);
+    }
+    return ERR_OK;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SUPPORT_REQUESTLIST */
+
 #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
   if (hs->no_auto_wnd) {
      hs->unrecved_bytes += p->tot_len;
@@ -2348,39 +4630,18 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
   } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
   {
-    if (hs->handle == NULL) {
-      parsed = http_parse_request(&p, hs, pcb);
-      LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
-        || parsed == ERR_INPROGRESS ||parsed == ERR_ARG || parsed == ERR_USE);
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      /* nothing more is expected from a client of the event stream */
+      pbuf_free(p);
+    } else
+#endif /* LWIP_HTTPD_SSE */
+    if ((hs->handle == NULL) && !HTTP_IS_PENDING(hs) && !HTTP_IS_CHUNKED(hs)) {
+      http_process_request(p, hs, pcb);
     } else {
       LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: already sending data\n"));
-    }
-#if LWIP_HTTPD_SUPPORT_REQUESTLIST
-    if (parsed != ERR_INPROGRESS) {
-      /* request fully parsed or error */
-      if (hs->req != NULL) {
-        pbuf_free(hs->req);
-        hs->req = NULL;
-      }
-    }
-#else /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-    if (p != NULL) {
-      /* pbuf not passed to application, free it now */
       pbuf_free(p);
     }
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-    if (parsed == ERR_OK) {
-#if LWIP_HTTPD_SUPPORT_POST
-      if (hs->post_content_len_left == 0)
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-      {
-        LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", hs->file, hs->left));
-        http_send(pcb, hs);
-      }
-    } else if (parsed == ERR_ARG) {
-      /* @todo: close on ERR_USE? */
-      http_close_conn(pcb, hs);
-    }
   }
   return ERR_OK;
 }
@@ -2482,6 +4743,9 @@ http_set_ssi_handler(tSSIHandler ssi_handler, const char **tags, int num_tags)
   g_pfnSSIHandler = ssi_handler;
   g_ppcTags = tags;
   g_iNumTags = num_tags;
+#if HTTPD_HANDLER_HASH
+  g_tag_hashed = http_hash_build(g_tag_hash, http_tag_name, num_tags);
+#endif /* HTTPD_HANDLER_HASH */
 }
 #endif /* LWIP_HTTPD_SSI */
 
@@ -2500,7 +4764,165 @@ http_set_cgi_handlers(const tCGI *cgis, int num_handlers)
   
   g_pCGIs = cgis;
   g_iNumCGIs = num_handlers;
+#if HTTPD_HANDLER_HASH
+  g_cgi_hashed = http_hash_build(g_cgi_hash, http_cgi_name, num_handlers);
+#endif /* HTTPD_HANDLER_HASH */
 }
 #endif /* LWIP_HTTPD_CGI */
 
+#if HTTPD_RESPONSE_CACHE
+/**
+ * Set the SSI files whose rendered responses are cached.
+ *
+ * @param rules an array of files and their time to live, must stay valid
+ * @param num_rules number of elements in the 'rules' array
+ */
+void
+http_set_cache_rules(const tCacheRule *rules, int num_rules)
+{
+  LWIP_ASSERT("no rules given", rules != NULL);
+  LWIP_ASSERT("invalid number of rules", (num_rules > 0) && (num_rules < HTTP_CACHE_NO_RULE));
+
+  httpd_cache_invalidate(NULL);
+  http_cache_rules = rules;
+  http_cache_num_rules = num_rules;
+}
+
+/**
+ * Drop the cached responses of an SSI file. Connections sending one go on,
+ * it is freed when they are done.
+ *
+ * @param uri the file as given in the rules, NULL for all files
+ */
+void
+httpd_cache_invalidate(const char *uri)
+{
+  struct http_cache_entry *e;
+
+  http_cache_gen++;
+  for (e = http_cache; e < &http_cache[LWIP_HTTPD_CACHE_ENTRIES]; e++) {
+    if ((e->key != NULL) && !e->stale && ((uri == NULL) || !strcmp(uri, http_cache_rules[e->rule].pcURIName))) {
+      http_cache_drop(e);
+    }
+  }
+}
+#endif /* HTTPD_RESPONSE_CACHE */
+
+#if LWIP_HTTPD_CHUNKED
+/**
+ * Set the array of generators and the URIs of their responses.
+ *
+ * @param chunked an array of generators, must stay valid
+ * @param num_handlers number of elements in the 'chunked' array
+ */
+void
+http_set_chunked_handlers(const tChunked *chunked, int num_handlers)
+{
+  LWIP_ASSERT("no generators given", chunked != NULL);
+  LWIP_ASSERT("invalid number of generators", num_handlers > 0);
+
+  g_pChunked = chunked;
+  g_iNumChunked = num_handlers;
+}
+#endif /* LWIP_HTTPD_CHUNKED */
+
+#if LWIP_HTTPD_SSE
+/**
+ * Set the SSE handler function and the URI of the event stream.
+ *
+ * @param uri URI of the event stream, e.g. "/events"
+ * @param sse_handler the function formatting a record
+ */
+void
+http_set_sse_handler(const char *uri, tSSEHandler sse_handler)
+{
+  LWIP_ASSERT("no uri given", uri != NULL);
+  LWIP_ASSERT("no sse_handler given", sse_handler != NULL);
+
+  g_pfnSSEHandler = sse_handler;
+  g_pcSSEURI = uri;
+}
+
+/**
+ * Push a new record to all clients of the event stream. The record is
+ * formatted once, when the first client has room for it.
+ */
+void
+httpd_sse_notify(void)
+{
+  struct http_state *hs;
+
+  http_sse_formatted = 0;
+  for (hs = http_sse_conns; hs != NULL; hs = hs->sse_next) {
+    hs->sse_pending |= HTTP_SSE_EVENT;
+    if (http_send(hs->pcb, hs)) {
+      tcp_output(hs->pcb);
+    }
+  }
+}
+
+/** Returns 1 if at least one client is connected to the event stream. */
+u8_t
+httpd_sse_subscribed(void)
+{
+  return http_sse_conns != NULL;
+}
+#endif /* LWIP_HTTPD_SSE */
+
+#if LWIP_HTTPD_WEBSOCKET
+/**
+ * Set the WebSocket endpoint.
+ *
+ * @param ws_handler URI and callbacks of the endpoint
+ */
+void
+http_set_ws_handler(const tWSHandler *ws_handler)
+{
+  LWIP_ASSERT("no ws_handler given", ws_handler != NULL);
+  LWIP_ASSERT("no recv callback given", ws_handler->recv != NULL);
+
+  g_pWSHandler = ws_handler;
+}
+
+/**
+ * Send a message to a WebSocket client in one frame.
+ *
+ * @param connection the client as passed to the callbacks
+ * @param opcode HTTPD_WS_TEXT or HTTPD_WS_BINARY
+ * @param data message, copied into the send buffer
+ * @param len length of the message
+ * @return ERR_OK, ERR_MEM if it doesn't fit now, ERR_INPROGRESS while the
+ *         handshake is sent
+ */
+err_t
+httpd_ws_send(void *connection, u8_t opcode, const void *data, u16_t len)
+{
+  struct http_state *hs = (struct http_state *)connection;
+  err_t err;
+
+  LWIP_ASSERT("not a websocket", (hs != NULL) && (hs->ws != NULL));
+  if ((hs->left > 0) || hs->ws->broken) {
+    return ERR_INPROGRESS;
+  }
+  err = http_ws_write(hs->pcb, hs->ws, opcode, data, len);
+  if (err == ERR_OK) {
+    tcp_output(hs->pcb);
+  }
+  return err;
+}
+
+/** Returns the length of the largest message httpd_ws_send accepts now. */
+u16_t
+httpd_ws_sndbuf(void *connection)
+{
+  struct http_state *hs = (struct http_state *)connection;
+
+  LWIP_ASSERT("not a websocket", (hs != NULL) && (hs->ws != NULL));
+  if ((hs->left > 0) || hs->ws->broken) {
+    return 0;
+  }
+  return http_ws_room(hs->pcb);
+}
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
 #endif /* LWIP_TCP */
@@ -51,6 +51,20 @@
 #define LWIP_HTTPD_SSI            0
 #endif
 
+/** Number of slots (a power of two) of the hash tables indexing the
+ * registered CGI names and SSI tags, 0 to search them linearly. Handlers
+ * which do not fit (more than slots - 1) are searched linearly, too. */
+#ifndef LWIP_HTTPD_HANDLER_HASH_SIZE
+#define LWIP_HTTPD_HANDLER_HASH_SIZE 0
+#endif
+
+/** Set this to 1 to let CGI and SSI handlers answer later: a handler
+ * returning HTTPD_CGI_PENDING or HTTPD_SSI_PENDING parks the connection
+ * until the callback got from httpd_get_continue() is called. */
+#ifndef LWIP_HTTPD_ASYNC_HANDLERS
+#define LWIP_HTTPD_ASYNC_HANDLERS 0
+#endif
+
 /** Set this to 1 to support HTTP POST */
 #ifndef LWIP_HTTPD_SUPPORT_POST
 #define LWIP_HTTPD_SUPPORT_POST   0
@@ -172,8 +186,72 @@ void http_set_ssi_handler(tSSIHandler pfnSSIHandler,
 #define LWIP_HTTPD_MAX_TAG_INSERT_LEN 192
 #endif
 
+/** Set this to 1 to cache rendered SSI responses in a fixed arena: a page
+ * set with http_set_cache_rules is rendered once per time to live (or
+ * httpd_cache_invalidate) and shared by all clients asking in the meantime.
+ * Needs rendered responses (persistent connections or precompiled files). */
+#ifndef LWIP_HTTPD_RESPONSE_CACHE
+#define LWIP_HTTPD_RESPONSE_CACHE 0
+#endif
+
+#if LWIP_HTTPD_RESPONSE_CACHE
+
+/* Size of the arena in bytes */
+#ifndef LWIP_HTTPD_CACHE_SIZE
+#define LWIP_HTTPD_CACHE_SIZE     512
+#endif
+
+/* The maximum number of responses in the arena */
+#ifndef LWIP_HTTPD_CACHE_ENTRIES
+#define LWIP_HTTPD_CACHE_ENTRIES  4
+#endif
+
+/*
+ * Structure defining an SSI file whose rendered response is cached and for
+ * how long (ms). A response still being sent when it expires stays valid for
+ * the clients sending it, new requests render it again.
+ */
+typedef struct
+{
+    const char *pcURIName;
+    u32_t ttl;
+} tCacheRule;
+
+void http_set_cache_rules(const tCacheRule *pRules, int iNumRules);
+
+/** Drop the cached responses of an SSI file (NULL: of all files) whose
+ * inserts changed, e.g. after a CGI handler changed the state shown.
+ * Responses being rendered meanwhile are not cached. */
+void httpd_cache_invalidate(const char *pcURI);
+
+#endif /* LWIP_HTTPD_RESPONSE_CACHE */
+
 #endif /* LWIP_HTTPD_SSI */
 
+#if LWIP_HTTPD_ASYNC_HANDLERS && (LWIP_HTTPD_CGI || LWIP_HTTPD_SSI)
+#include "fs.h"
+
+/* Returned by a CGI handler whose response is not known yet */
+extern const char httpd_cgi_pending[];
+#define HTTPD_CGI_PENDING         httpd_cgi_pending
+
+/* Returned by an SSI handler whose insert is not ready yet */
+#define HTTPD_SSI_PENDING         0xfffe
+
+/** Called by a CGI or SSI handler before it returns HTTPD_CGI_PENDING or
+ * HTTPD_SSI_PENDING. The handler calls callback_fn(callback_arg) later from
+ * the main loop (not from an interrupt) when its result is ready; httpd then
+ * calls it again with the same arguments (CGI parameters, tag) and goes on
+ * sending the response. A callback for a connection closed meanwhile (the
+ * poll timeout closes a connection waiting too long) does nothing.
+ * An SSI file which is not precompiled (HTTPD_SSI_SEGMENTS) cannot be
+ * rendered in advance with a pending handler: it is sent without
+ * "Content-Length" and closes a persistent connection.
+ */
+void httpd_get_continue(fs_wait_cb *callback_fn, void **callback_arg);
+
+#endif /* LWIP_HTTPD_ASYNC_HANDLERS && (LWIP_HTTPD_CGI || LWIP_HTTPD_SSI) */
+
 #if LWIP_HTTPD_SUPPORT_POST
 
 /* These functions must be implemented by the application */
@@ -231,6 +309,129 @@ void httpd_post_data_recved(void *connection, u16_t recved_len);
 
 #endif /* LWIP_HTTPD_SUPPORT_POST */
 
+/** Set this to 1 to support Server-Sent Events: a GET of the URI set with
+ * http_set_sse_handler keeps the connection open as a "text/event-stream"
+ * and every httpd_sse_notify() pushes a record to it. */
+#ifndef LWIP_HTTPD_SSE
+#define LWIP_HTTPD_SSE            0
+#endif
+
+#if LWIP_HTTPD_SSE
+
+/* The maximum length of a record returned by the SSE handler */
+#ifndef LWIP_HTTPD_SSE_MAX_LEN
+#define LWIP_HTTPD_SSE_MAX_LEN    192
+#endif
+
+/*
+ * Function pointer for the SSE record handler callback.
+ *
+ * Called once per httpd_sse_notify() (not once per client) to format the
+ * record sent as the "data:" field of the event. The record must be a single
+ * line. The handler returns its length or 0 to send nothing.
+ */
+typedef u16_t (*tSSEHandler)(char *pcRecord, u16_t iRecordLen);
+
+void http_set_sse_handler(const char *pcURI, tSSEHandler pfnSSEHandler);
+
+/** Push a new record to all clients. A client whose send buffer is full gets
+ * the latest record as soon as there is room again, so slow clients skip
+ * records instead of queueing them. */
+void httpd_sse_notify(void);
+
+/** Returns 1 if at least one client is connected to the event stream. */
+u8_t httpd_sse_subscribed(void);
+
+#endif /* LWIP_HTTPD_SSE */
+
+/** Set this to 1 to support WebSocket (RFC 6455): a GET of the URI of the
+ * handler set with http_set_ws_handler is upgraded to a WebSocket. */
+#ifndef LWIP_HTTPD_WEBSOCKET
+#define LWIP_HTTPD_WEBSOCKET      0
+#endif
+
+#if LWIP_HTTPD_WEBSOCKET
+
+/* The maximum length of a message received from a client. Longer and
+ * fragmented messages close the connection. */
+#ifndef LWIP_HTTPD_WS_MAX_MSG
+#define LWIP_HTTPD_WS_MAX_MSG     125
+#endif
+
+/* Opcodes of data messages */
+#define HTTPD_WS_TEXT             1
+#define HTTPD_WS_BINARY           2
+
+/*
+ * Callbacks of a WebSocket endpoint, 'connection' identifies the client.
+ *
+ * open is called with the upgrade request, a return value other than ERR_OK
+ * refuses it. recv is called for each text or binary message. close is
+ * called when the connection is gone, 'connection' is invalid afterwards.
+ */
+typedef struct
+{
+    const char *uri;
+    err_t (*open)(void *connection);
+    void (*recv)(void *connection, u8_t opcode, const u8_t *data, u16_t len);
+    void (*close)(void *connection);
+} tWSHandler;
+
+void http_set_ws_handler(const tWSHandler *pWSHandler);
+
+/** Send a message in one frame. The data is copied into the send buffer of
+ * the connection as a whole or not at all.
+ * @return ERR_OK, ERR_MEM if it doesn't fit now (see httpd_ws_sndbuf),
+ *         ERR_INPROGRESS while the handshake is sent */
+err_t httpd_ws_send(void *connection, u8_t opcode, const void *data, u16_t len);
+
+/** Returns the length of the largest message httpd_ws_send accepts now. */
+u16_t httpd_ws_sndbuf(void *connection);
+
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+/** Set this to 1 to support responses of unknown length: the generator of a
+ * URI set with http_set_chunked_handlers is called whenever a chunk fits
+ * into the send buffer, so the body is never held as a whole. HTTP/1.1
+ * clients get "Transfer-Encoding: chunked" (the connection may persist),
+ * older ones a body ended by closing the connection. */
+#ifndef LWIP_HTTPD_CHUNKED
+#define LWIP_HTTPD_CHUNKED        0
+#endif
+
+#if LWIP_HTTPD_CHUNKED
+
+/* The maximum length of a chunk, must fit into TCP_SND_BUF with its framing */
+#ifndef LWIP_HTTPD_CHUNK_SIZE
+#define LWIP_HTTPD_CHUNK_SIZE     512
+#endif
+
+/*
+ * Function pointer for a chunk generator.
+ *
+ * Called with a buffer of iBufLen (LWIP_HTTPD_CHUNK_SIZE) bytes to fill
+ * with the next part of the body. *pulCursor is 0 for the first chunk of a
+ * response and is kept for the generator between the calls. The generator
+ * returns the length written, 0 ends the body. If the chunk cannot be
+ * queued, it is called again later with the cursor it got before.
+ */
+typedef u16_t (*tChunkedHandler)(u32_t *pulCursor, char *pcBuf, u16_t iBufLen);
+
+/*
+ * Structure defining the URI of a generated response, its Content-Type and
+ * the generator.
+ */
+typedef struct
+{
+    const char *pcURIName;
+    const char *pcContentType;
+    tChunkedHandler pfnHandler;
+} tChunked;
+
+void http_set_chunked_handlers(const tChunked *pChunked, int iNumHandlers);
+
+#endif /* LWIP_HTTPD_CHUNKED */
+
 void httpd_init(void);
 
 #endif /* __HTTPD_H__ */
@@ -58,7 +58,13 @@ static const char * const g_psHTTPHeaderStrings[] =
  "Server: "HTTPD_SERVER_AGENT"\r\n",
  "\r\n<html><body><h2>404: The requested file cannot be found.</h2></body></html>\r\n",
 
- "Content-type: image/svg+xml\r\n\r\n"
+ "Content-type: image/svg+xml\r\n\r\n",
+ "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n",
+ "Vary: Accept-Encoding\r\n",
+ "HTTP/1.1 304 Not Modified\r\n",
+ "ETag: ",
+ "Cache-Control: no-cache\r\n",
+ "Cache-Control: max-age="
 };
 
 /* Indexes into the g_psHTTPHeaderStrings array */
@@ -92,6 +98,12 @@ static const char * const g_psHTTPHeaderStrings[] =
 
 /* added by FSE: */
 #define HTTP_HDR_SVG            27  /* image/svg+xml */
+#define HTTP_HDR_GZIP           28  /* Content-Encoding: gzip, Vary */
+#define HTTP_HDR_VARY           29  /* Vary: Accept-Encoding */
+#define HTTP_HDR_NOT_MODIFIED_11 30 /* 304 Not Modified */
+#define HTTP_HDR_ETAG           31  /* ETag: (validator of the file) */
+#define HTTP_HDR_NO_CACHE       32  /* Cache-Control: no-cache */
+#define HTTP_HDR_MAX_AGE        33  /* Cache-Control: max-age= */
 
 
 /** A list of extension-to-HTTP header strings */
@@ -571,7 +571,10 @@ ip_input(struct pbuf *p, struct netif *inp)
 #if LWIP_TCP
     case IP_PROTO_TCP:
       snmp_inc_ipindelivers();
+      TRACE(TR_TCP_INPUT, p->tot_len, 0);
+      PROBE_BEGIN(PROBE_TCP_INPUT);
       tcp_input(p, inp);
+      PROBE_END(PROBE_TCP_INPUT);
       break;
 #endif /* LWIP_TCP */
 #if LWIP_ICMP
@@ -79,4 +79,8 @@ typedef u32_t mem_ptr_t;
 
 #define LWIP_PLATFORM_ASSERT(x) do { if(!(x)) while(1); } while(0)
 
+/* igmp report delays */
+#include <stdlib.h>
+#define LWIP_RAND() ((u32_t)rand())
+
 #endif /* __CC_H__ */
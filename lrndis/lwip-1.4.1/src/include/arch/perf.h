@@ -32,6 +32,10 @@
 #ifndef __PERF_H__
 #define __PERF_H__
 
+#include "probe.h"
+#include "trace.h"
+#include "latency.h"
+
 #define PERF_START    /* null definition */
 #define PERF_STOP(x)  /* null definition */
 
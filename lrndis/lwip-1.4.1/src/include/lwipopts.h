@@ -41,6 +41,7 @@
 #define LWIP_DHCP                       0
 #define LWIP_ICMP                       1
 #define LWIP_UDP                        1
+#define LWIP_IGMP                       1
 #define LWIP_TCP                        1
 #define ETH_PAD_SIZE                    0
 #define LWIP_IP_ACCEPT_UDP_PORT(p)      ((p) == PP_NTOHS(67))
@@ -54,5 +55,20 @@
 #define LWIP_HTTPD_CGI                  1
 #define LWIP_HTTPD_SSI                  1
 #define LWIP_HTTPD_SSI_INCLUDE_TAG      0
+#define LWIP_HTTPD_CUSTOM_FILES         1
+#define HTTPD_FS_GZIP                   1
+#define HTTPD_FS_ETAG                   1
+#define HTTPD_FS_HASH                   1
+#define HTTPD_FS_SSI_SEGMENTS           1
+#define LWIP_HTTPD_HANDLER_HASH_SIZE    16
+#define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 1
+#define LWIP_HTTPD_SSE                  1
+#define LWIP_HTTPD_WEBSOCKET            1
+#define LWIP_HTTPD_ASYNC_HANDLERS       1
+#define LWIP_HTTPD_RESPONSE_CACHE       1
+#define LWIP_HTTPD_CHUNKED              1
+/* SSI responses rendered into the heap are freed on close, before the data
+   is acked */
+#define HTTP_IS_DATA_VOLATILE(hs)       (((hs)->ssi || LWIP_HTTPD_IS_RENDERED(hs)) ? TCP_WRITE_FLAG_COPY : 0)
 
 #endif /* __LWIPOPTS_H__ */
@@ -0,0 +1,448 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   tiny mdns/dns-sd responder using lwip (pcb)
+ */
+
+#include "mdserver.h"
+#include "lwip/sys.h"
+
+#define MDNS_MAX_NAME    96
+#define MDNS_MAX_MESSAGE 512
+#define MDNS_MAX_HOPS    16   /* compression pointers followed per name */
+
+#define CLASS_IN     1
+#define CLASS_ANY    255
+#define CLASS_FLUSH  0x8000   /* cache flush bit of unique records */
+#define CLASS_QU     0x8000   /* unicast response requested */
+
+/* records of the responder */
+enum
+{
+	REC_HOST,     /* <host>.local A */
+	REC_SERVICES, /* _services._dns-sd._udp.local PTR _http._tcp.local */
+	REC_PTR,      /* _http._tcp.local PTR <instance>._http._tcp.local */
+	REC_SRV,      /* <instance>._http._tcp.local SRV <host>.local */
+	REC_TXT,      /* <instance>._http._tcp.local TXT */
+	REC_COUNT
+};
+
+/* wanted records */
+#define WANT_ANSWER     1
+#define WANT_ADDITIONAL 2
+
+static const char service_name[] = "_http._tcp.local";
+static const char services_name[] = "_services._dns-sd._udp.local";
+
+static struct udp_pcb *pcb = NULL;
+static struct netif *mdns_netif = NULL;
+static char host_name[MDNS_MAX_NAME];
+static char instance_name[MDNS_MAX_NAME];
+static dns_record_t records[REC_COUNT];
+static uint32_t records_ttl[REC_COUNT];
+static int num_records;
+static uint32_t last_multicast[REC_COUNT]; /* sys_now() of the last multicast */
+static uint32_t rate_time;
+static int rate_count;
+static uint8_t message[MDNS_MAX_MESSAGE];  /* chained queries */
+
+static bool same_name(const char *a, const char *b)
+{
+	char ca, cb;
+	do
+	{
+		ca = *a++;
+		cb = *b++;
+		if (ca >= 'A' && ca <= 'Z') ca += 'a' - 'A';
+		if (cb >= 'A' && cb <= 'Z') cb += 'a' - 'A';
+		if (ca != cb) return false;
+	} while (ca != 0);
+	return true;
+}
+
+/* reads a possibly compressed name as a dotted string, returns the
+ * offset behind it or -1 */
+static int read_name(const uint8_t *msg, int size, int offset, char *name)
+{
+	int len, hops, end, n;
+	len = 0;
+	hops = 0;
+	end = -1;
+	while (true)
+	{
+		if (offset >= size) return -1;
+		n = msg[offset];
+		if ((n & 0xC0) == 0xC0)
+		{
+			if (offset + 1 >= size || ++hops > MDNS_MAX_HOPS) return -1;
+			if (end < 0) end = offset + 2;
+			offset = ((n & 0x3F) << 8) | msg[offset + 1];
+			continue;
+		}
+		if (n > 63) return -1;
+		offset++;
+		if (n == 0) break;
+		if (offset + n > size || len + n + 1 >= MDNS_MAX_NAME) return -1;
+		if (len > 0) name[len++] = '.';
+		memcpy(&name[len], &msg[offset], n);
+		len += n;
+		offset += n;
+	}
+	name[len] = 0;
+	return end < 0 ? offset : end;
+}
+
+static uint16_t get16(const uint8_t *ptr)
+{
+	return (ptr[0] << 8) | ptr[1];
+}
+
+static uint8_t *put16(uint8_t *ptr, uint16_t value)
+{
+	*ptr++ = value >> 8;
+	*ptr++ = value & 0xFF;
+	return ptr;
+}
+
+static uint8_t *put32(uint8_t *ptr, uint32_t value)
+{
+	ptr = put16(ptr, value >> 16);
+	return put16(ptr, value & 0xFFFF);
+}
+
+static uint8_t *put_name(uint8_t *ptr, const char *name)
+{
+	uint8_t *label;
+	while (*name != 0)
+	{
+		label = ptr++;
+		while (*name != 0 && *name != '.')
+			*ptr++ = *name++;
+		*label = ptr - label - 1;
+		if (*name == '.') name++;
+	}
+	*ptr++ = 0;
+	return ptr;
+}
+
+static int name_size(const char *name)
+{
+	return *name == 0 ? 1 : strlen(name) + 2;
+}
+
+static int record_size(const dns_record_t *rec)
+{
+	int size = name_size(rec->name) + 10;
+	switch (rec->type)
+	{
+	case DNS_TYPE_A:   return size + 4;
+	case DNS_TYPE_PTR: return size + name_size(rec->target);
+	case DNS_TYPE_TXT: return size + strlen(rec->target) + 1;
+	case DNS_TYPE_SRV: return size + 6 + name_size(rec->target);
+	}
+	return size;
+}
+
+static uint8_t *put_record(uint8_t *ptr, int index, bool legacy)
+{
+	const dns_record_t *rec = &records[index];
+	uint8_t *len;
+	ptr = put_name(ptr, rec->name);
+	ptr = put16(ptr, rec->type);
+	/* PTR records are shared, the rest is unique to this host */
+	ptr = put16(ptr, CLASS_IN | (rec->type != DNS_TYPE_PTR && !legacy ? CLASS_FLUSH : 0));
+	ptr = put32(ptr, legacy && records_ttl[index] > 10 ? 10 : records_ttl[index]);
+	len = ptr;
+	ptr += 2;
+	switch (rec->type)
+	{
+	case DNS_TYPE_A:
+		memcpy(ptr, &mdns_netif->ip_addr, 4);
+		ptr += 4;
+		break;
+	case DNS_TYPE_PTR:
+		ptr = put_name(ptr, rec->target);
+		break;
+	case DNS_TYPE_TXT:
+		*ptr = strlen(rec->target);
+		memcpy(ptr + 1, rec->target, *ptr);
+		ptr += *ptr + 1;
+		break;
+	case DNS_TYPE_SRV:
+		ptr = put16(ptr, rec->priority);
+		ptr = put16(ptr, rec->weight);
+		ptr = put16(ptr, rec->port);
+		ptr = put_name(ptr, rec->target);
+		break;
+	}
+	put16(len, ptr - len - 2);
+	return ptr;
+}
+
+/* marks the records answering a question */
+static void match_question(const char *name, uint16_t type, uint8_t *want)
+{
+	int i;
+	for (i = 0; i < num_records; i++)
+		if ((type == records[i].type || type == DNS_TYPE_ANY) && same_name(name, records[i].name))
+			want[i] |= WANT_ANSWER;
+}
+
+/* Known-answer suppression, RFC 6762 7.1: records the querier already
+ * holds with at least half of their ttl are not sent again. */
+static void match_known(const uint8_t *msg, int size, int offset, const char *name, uint16_t type, uint32_t ttl, uint8_t *want)
+{
+	int i;
+	static char target[MDNS_MAX_NAME];
+	for (i = 0; i < num_records; i++)
+	{
+		if (type != records[i].type || ttl < records_ttl[i] / 2) continue;
+		if (!same_name(name, records[i].name)) continue;
+		if (type == DNS_TYPE_PTR)
+			if (read_name(msg, size, offset, target) < 0 || !same_name(target, records[i].target))
+				continue;
+		want[i] = 0;
+	}
+}
+
+static bool rate_limited(uint32_t now)
+{
+	if (now - rate_time >= 1000)
+	{
+		rate_time = now;
+		rate_count = 0;
+	}
+	return ++rate_count > MDNS_MAX_RATE;
+}
+
+static void send_response(struct udp_pcb *upcb, const uint8_t *msg, int qend, uint8_t *want, bool legacy, struct ip_addr *addr, u16_t port)
+{
+	int i, size, n_answer, n_additional;
+	struct pbuf *out;
+	uint8_t *ptr;
+	ip_addr_t group;
+
+	/* legacy unicast responses repeat the questions */
+	size = 12 + (legacy ? qend - 12 : 0);
+	for (i = 0; i < num_records; i++)
+		if (want[i] != 0) size += record_size(&records[i]);
+	if (size > MDNS_MAX_MESSAGE) return;
+
+	out = pbuf_alloc(PBUF_TRANSPORT, size, PBUF_RAM);
+	if (out == NULL) return;
+	ptr = (uint8_t *)out->payload;
+	ptr = put16(ptr, legacy ? get16(msg) : 0); /* id */
+	ptr = put16(ptr, 0x8400);                  /* response, authoritative */
+	ptr = put16(ptr, legacy ? get16(msg + 4) : 0);
+	n_answer = 0;
+	n_additional = 0;
+	for (i = 0; i < num_records; i++)
+	{
+		if (want[i] & WANT_ANSWER) n_answer++; else
+		if (want[i] & WANT_ADDITIONAL) n_additional++;
+	}
+	ptr = put16(ptr, n_answer);
+	ptr = put16(ptr, 0);
+	ptr = put16(ptr, n_additional);
+	if (legacy)
+	{
+		memcpy(ptr, msg + 12, qend - 12);
+		ptr += qend - 12;
+	}
+	for (i = 0; i < num_records; i++)
+		if (want[i] & WANT_ANSWER)
+			ptr = put_record(ptr, i, legacy);
+	for (i = 0; i < num_records; i++)
+		if (want[i] == WANT_ADDITIONAL)
+			ptr = put_record(ptr, i, legacy);
+
+	if (addr != NULL)
+		udp_sendto(upcb, out, addr, port);
+	else
+	{
+		IP4_ADDR(&group, 224, 0, 0, 251);
+		udp_sendto(upcb, out, &group, MDNS_PORT);
+	}
+	pbuf_free(out);
+}
+
+static void process_query(struct udp_pcb *upcb, const uint8_t *msg, int size, struct ip_addr *addr, u16_t port)
+{
+	static char name[MDNS_MAX_NAME];
+	uint8_t want[REC_COUNT];
+	int i, n, offset, qend;
+	uint16_t type, Class;
+	uint32_t now, ttl;
+	bool legacy, multicast;
+
+	if (size < 12 || (msg[2] & 0x80) != 0) return; /* responses are ignored */
+	legacy = port != MDNS_PORT;
+	multicast = false;
+	memset(want, 0, sizeof(want));
+
+	/* questions */
+	offset = 12;
+	n = get16(msg + 4);
+	for (i = 0; i < n; i++)
+	{
+		offset = read_name(msg, size, offset, name);
+		if (offset < 0 || offset + 4 > size) return;
+		type = get16(msg + offset);
+		Class = get16(msg + offset + 2);
+		offset += 4;
+		if ((Class & ~CLASS_QU) != CLASS_IN && (Class & ~CLASS_QU) != CLASS_ANY) continue;
+		if ((Class & CLASS_QU) == 0) multicast = true;
+		match_question(name, type, want);
+	}
+	qend = offset;
+
+	/* known answers */
+	n = get16(msg + 6);
+	for (i = 0; i < n; i++)
+	{
+		offset = read_name(msg, size, offset, name);
+		if (offset < 0 || offset + 10 > size) break;
+		type = get16(msg + offset);
+		ttl = ((uint32_t)get16(msg + offset + 4) << 16) | get16(msg + offset + 6);
+		offset += 10;
+		if (offset + get16(msg + offset - 2) > size) break;
+		match_known(msg, size, offset, name, type, ttl, want);
+		offset += get16(msg + offset - 2);
+	}
+
+	/* additional records for DNS-SD, RFC 6763 12 */
+	if (want[REC_PTR] & WANT_ANSWER)
+	{
+		want[REC_SRV] |= WANT_ADDITIONAL;
+		want[REC_TXT] |= WANT_ADDITIONAL;
+		want[REC_HOST] |= WANT_ADDITIONAL;
+	}
+	if (want[REC_SRV] & WANT_ANSWER)
+		want[REC_HOST] |= WANT_ADDITIONAL;
+
+	/* a record is multicast at most once per second, RFC 6762 6 */
+	now = sys_now();
+	n = 0;
+	for (i = 0; i < num_records; i++)
+	{
+		if (want[i] == 0) continue;
+		if (multicast && !legacy)
+		{
+			if (last_multicast[i] != 0 && now - last_multicast[i] < 1000)
+			{
+				want[i] = 0;
+				continue;
+			}
+			last_multicast[i] = now | 1;
+		}
+		if (want[i] & WANT_ANSWER) n++;
+	}
+	if (n == 0 || rate_limited(now)) return;
+
+	send_response(upcb, msg, qend, want, legacy, multicast && !legacy ? NULL : addr, port);
+}
+
+static void udp_recv_proc(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+	if (p->tot_len == p->len)
+		process_query(upcb, (const uint8_t *)p->payload, p->len, addr, port);
+	else if (p->tot_len <= MDNS_MAX_MESSAGE)
+	{
+		pbuf_copy_partial(p, message, p->tot_len, 0);
+		process_query(upcb, message, p->tot_len, addr, port);
+	}
+	pbuf_free(p);
+}
+
+static void set_record(int index, const char *name, uint16_t type, const char *target, uint32_t ttl)
+{
+	records[index].name = name;
+	records[index].type = type;
+	records[index].target = target;
+	records_ttl[index] = ttl;
+}
+
+err_t mdserv_init(struct netif *netif, const mdns_config_t *config)
+{
+	err_t err;
+	ip_addr_t group;
+
+	if (strlen(config->host) + 7 > MDNS_MAX_NAME) return ERR_ARG;
+	strcpy(host_name, config->host);
+	strcat(host_name, ".local");
+	memset(records, 0, sizeof(records));
+	memset(last_multicast, 0, sizeof(last_multicast));
+	set_record(REC_HOST, host_name, DNS_TYPE_A, NULL, MDNS_HOST_TTL);
+	num_records = 1;
+	if (config->instance != NULL)
+	{
+		if (strlen(config->instance) + sizeof(service_name) + 1 > MDNS_MAX_NAME) return ERR_ARG;
+		strcpy(instance_name, config->instance);
+		strcat(instance_name, ".");
+		strcat(instance_name, service_name);
+		set_record(REC_SERVICES, services_name, DNS_TYPE_PTR, service_name, MDNS_SERVICE_TTL);
+		set_record(REC_PTR, service_name, DNS_TYPE_PTR, instance_name, MDNS_SERVICE_TTL);
+		set_record(REC_SRV, instance_name, DNS_TYPE_SRV, host_name, MDNS_HOST_TTL);
+		set_record(REC_TXT, instance_name, DNS_TYPE_TXT, config->txt != NULL ? config->txt : "", MDNS_SERVICE_TTL);
+		records[REC_SRV].port = config->port;
+		num_records = REC_COUNT;
+	}
+
+	udp_init();
+	mdserv_free();
+	pcb = udp_new();
+	if (pcb == NULL)
+		return ERR_MEM;
+	pcb->ttl = 255; /* RFC 6762 11 */
+	err = udp_bind(pcb, IP_ADDR_ANY, MDNS_PORT);
+	if (err != ERR_OK)
+	{
+		udp_remove(pcb);
+		pcb = NULL;
+		return err;
+	}
+	IP4_ADDR(&group, 224, 0, 0, 251);
+	err = igmp_joingroup(&netif->ip_addr, &group);
+	if (err != ERR_OK)
+	{
+		udp_remove(pcb);
+		pcb = NULL;
+		return err;
+	}
+	udp_recv(pcb, udp_recv_proc, NULL);
+	mdns_netif = netif;
+	return ERR_OK;
+}
+
+void mdserv_free(void)
+{
+	ip_addr_t group;
+	if (pcb == NULL) return;
+	udp_remove(pcb);
+	pcb = NULL;
+	IP4_ADDR(&group, 224, 0, 0, 251);
+	igmp_leavegroup(&mdns_netif->ip_addr, &group);
+}
@@ -0,0 +1,72 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   tiny mdns/dns-sd responder using lwip (pcb)
+ */
+
+#ifndef MDSERVER
+#define MDSERVER
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "lwip/def.h"
+#include "lwip/err.h"
+#include "lwip/udp.h"
+#include "lwip/igmp.h"
+#include "dnserver.h"
+
+#define MDNS_PORT 5353
+
+/* ttl of the host address and of the service records, RFC 6762 10 */
+#ifndef MDNS_HOST_TTL
+#define MDNS_HOST_TTL    120
+#endif
+#ifndef MDNS_SERVICE_TTL
+#define MDNS_SERVICE_TTL 4500
+#endif
+
+/* responses per second, queries above the limit are dropped */
+#ifndef MDNS_MAX_RATE
+#define MDNS_MAX_RATE 20
+#endif
+
+/* Names are single labels without dots. The host is "<host>.local",
+ * the service "<instance>._http._tcp.local". Requires LWIP_IGMP and
+ * NETIF_FLAG_IGMP on the netif; igmp_tmr() must be called by the
+ * application. */
+typedef struct mdns_config
+{
+	const char *host;     /* host name */
+	const char *instance; /* service instance name, NULL for none */
+	uint16_t    port;     /* http port */
+	const char *txt;      /* service TXT, e.g. "path=/" */
+} mdns_config_t;
+
+err_t mdserv_init(struct netif *netif, const mdns_config_t *config);
+void  mdserv_free(void);
+
+#endif
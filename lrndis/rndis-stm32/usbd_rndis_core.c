@@ -25,6 +25,9 @@
 #include "usbd_rndis_core.h"
 #include "usbd_desc.h"
 #include "usbd_req.h"
+#include "probe.h"
+#include "trace.h"
+#include "latency.h"
 
 /*********************************************
    RNDIS Device library callbacks
@@ -585,6 +588,8 @@ static uint8_t usbd_rndis_data_in(void *pdev, uint8_t epnum)
 				return USBD_OK;
 			}
 			tx.state = TX_STATE_READY;
+			TRACE(TR_RNDIS_TX_DONE, 0, 0);
+			LAT_TX_DONE();
 			return USBD_OK;
 		}
 
@@ -597,12 +602,16 @@ static uint8_t usbd_rndis_data_in(void *pdev, uint8_t epnum)
 				return USBD_OK;
 			}
 			tx.state = TX_STATE_READY;
+			TRACE(TR_RNDIS_TX_DONE, 0, 0);
+			LAT_TX_DONE();
 			return USBD_OK;
 		}
 		
 		if (tx.state == TX_STATE_SENDING_PADDING)
 		{
 			tx.state = TX_STATE_READY;
+			TRACE(TR_RNDIS_TX_DONE, 0, 0);
+			LAT_TX_DONE();
 			return USBD_OK;
 		}
 	}
@@ -618,9 +627,12 @@ static void handle_packet(const char *data, int size)
 	if (p->DataOffset + offsetof(rndis_data_packet_t, DataOffset) + p->DataLength != size)
 	{
 		usb_eth_stat.rxbad++;
+		TRACE(TR_RNDIS_RX_BAD, size, 0);
 		return;
 	}
 	usb_eth_stat.rxok++;
+	TRACE(TR_RNDIS_RX, p->DataLength, 0);
+	LAT_RX_DONE();
 	if (rndis_rxproc != NULL)
 		rndis_rxproc(&rndis_rx_buffer[p->DataOffset + offsetof(rndis_data_packet_t, DataOffset)], p->DataLength);
 }
@@ -631,6 +643,7 @@ static uint8_t usbd_rndis_data_out(void *pdev, uint8_t epnum)
 	static int rndis_received = 0;
 	static int rndis_MessageLength = 0;
 
+	PROBE_BEGIN(PROBE_RNDIS_RX);
 	if (epnum == RNDIS_DATA_OUT_EP)
 	{
 		PUSB_OTG_EP ep = &((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum];
@@ -666,6 +679,7 @@ static uint8_t usbd_rndis_data_out(void *pdev, uint8_t epnum)
 		}
 		DCD_EP_PrepareRx(pdev, RNDIS_DATA_OUT_EP, (uint8_t*)usb_rx_buffer, RNDIS_DATA_OUT_SZ);
 	}
+	PROBE_END(PROBE_RNDIS_RX);
   return USBD_OK;
 }
 
@@ -706,6 +720,7 @@ bool rndis_send(const void *data, int size)
 		size > ETH_MAX_PACKET_SIZE ||
 		tx.state != TX_STATE_READY) return false;
 
+	TRACE(TR_RNDIS_TX, size, 0);
 	__disable_irq();
 	tx.ptr = (uint8_t *)data;
 	tx.size = size;
@@ -0,0 +1,502 @@
+/**
+ * deflate: minimal gzip (RFC 1951/1952) encoder for makefsdata.
+ *
+ * Files of the web site are compressed once on the build host, so the
+ * encoder prefers ratio over speed: long hash chains, lazy matching and
+ * a dynamic Huffman block per BLOCK_TOKENS symbols.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "deflate.h"
+
+#define WINDOW_SIZE  32768
+#define HASH_BITS    15
+#define HASH_SIZE    (1 << HASH_BITS)
+#define MIN_MATCH    3
+#define MAX_MATCH    258
+#define MAX_CHAIN    4096
+#define NICE_MATCH   258
+#define BLOCK_TOKENS 16384
+
+#define NUM_LITLEN   286
+#define NUM_DIST     30
+#define NUM_CLEN     19
+#define END_OF_BLOCK 256
+
+/* token: literal if dist == 0, otherwise a match */
+struct token {
+  unsigned short len;
+  unsigned short dist;
+};
+
+struct bitbuf {
+  unsigned char *data;
+  int size;
+  int len;
+  unsigned long bits;
+  int count;
+  int failed;
+};
+
+static const unsigned short len_base[29] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const unsigned char len_extra[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const unsigned short dist_base[30] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const unsigned char dist_extra[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+static const unsigned char clen_order[NUM_CLEN] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/*-----------------------------------------------------------------------------------*/
+/* bit output */
+
+static void
+put_byte(struct bitbuf *b, unsigned char c)
+{
+  unsigned char *p;
+  if (b->len == b->size) {
+    p = (unsigned char *)realloc(b->data, b->size * 2 + 1024);
+    if (p == NULL) {
+      b->failed = 1;
+      return;
+    }
+    b->data = p;
+    b->size = b->size * 2 + 1024;
+  }
+  b->data[b->len++] = c;
+}
+
+/* LSB first, as deflate packs everything but Huffman codes */
+static void
+put_bits(struct bitbuf *b, unsigned long value, int n)
+{
+  b->bits |= value << b->count;
+  b->count += n;
+  while (b->count >= 8) {
+    put_byte(b, (unsigned char)b->bits);
+    b->bits >>= 8;
+    b->count -= 8;
+  }
+}
+
+static void
+flush_bits(struct bitbuf *b)
+{
+  if (b->count > 0) {
+    put_byte(b, (unsigned char)b->bits);
+  }
+  b->bits = 0;
+  b->count = 0;
+}
+
+static void
+put_le32(struct bitbuf *b, unsigned long value)
+{
+  put_byte(b, (unsigned char)value);
+  put_byte(b, (unsigned char)(value >> 8));
+  put_byte(b, (unsigned char)(value >> 16));
+  put_byte(b, (unsigned char)(value >> 24));
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Huffman codes */
+
+/* code lengths for freq[0..n), no longer than limit; a code has at least
+ * two symbols so that the decoder always sees a complete tree */
+static void
+build_lengths(const unsigned long *freq, int n, int limit, unsigned char *lens)
+{
+  unsigned long weight[2 * NUM_LITLEN];
+  int parent[2 * NUM_LITLEN];
+  int active[2 * NUM_LITLEN];
+  int i, j, nodes, leaves, a, b, depth, max;
+  unsigned long shift;
+
+  for (shift = 0; ; shift++) {
+    leaves = 0;
+    for (i = 0; i < n; i++) {
+      weight[i] = freq[i] == 0 ? 0 : (freq[i] >> shift) + 1;
+      if (weight[i] != 0) {
+        leaves++;
+      }
+    }
+    /* pad to two symbols */
+    for (i = 0; leaves < 2 && i < n; i++) {
+      if (weight[i] == 0) {
+        weight[i] = 1;
+        leaves++;
+      }
+    }
+    nodes = n;
+    for (i = 0; i < n; i++) {
+      active[i] = weight[i] != 0;
+      parent[i] = -1;
+    }
+    /* join the two lightest active nodes until one is left */
+    for (j = 1; j < leaves; j++) {
+      a = b = -1;
+      for (i = 0; i < nodes; i++) {
+        if (!active[i]) {
+          continue;
+        }
+        if (a < 0 || weight[i] < weight[a]) {
+          b = a;
+          a = i;
+        } else if (b < 0 || weight[i] < weight[b]) {
+          b = i;
+        }
+      }
+      weight[nodes] = weight[a] + weight[b];
+      active[nodes] = 1;
+      parent[nodes] = -1;
+      active[a] = active[b] = 0;
+      parent[a] = parent[b] = nodes;
+      nodes++;
+    }
+    max = 0;
+    for (i = 0; i < n; i++) {
+      depth = 0;
+      if (weight[i] != 0) {
+        for (j = i; parent[j] >= 0; j = parent[j]) {
+          depth++;
+        }
+      }
+      lens[i] = (unsigned char)depth;
+      if (depth > max) {
+        max = depth;
+      }
+    }
+    if (max <= limit) {
+      return;
+    }
+    /* too deep: flatten the distribution and retry */
+  }
+}
+
+/* canonical codes (RFC 1951 3.2.2), stored bit reversed for put_bits */
+static void
+build_codes(const unsigned char *lens, int n, unsigned short *codes)
+{
+  int count[16], next[16];
+  int i, bits, code, rev;
+
+  memset(count, 0, sizeof(count));
+  for (i = 0; i < n; i++) {
+    count[lens[i]]++;
+  }
+  count[0] = 0;
+  code = 0;
+  for (bits = 1; bits < 16; bits++) {
+    code = (code + count[bits - 1]) << 1;
+    next[bits] = code;
+  }
+  for (i = 0; i < n; i++) {
+    if (lens[i] == 0) {
+      continue;
+    }
+    code = next[lens[i]]++;
+    rev = 0;
+    for (bits = 0; bits < lens[i]; bits++) {
+      rev = (rev << 1) | ((code >> bits) & 1);
+    }
+    codes[i] = (unsigned short)rev;
+  }
+}
+
+static int
+len_code(int len)
+{
+  int i;
+  for (i = 28; len_base[i] > len; i--);
+  return i;
+}
+
+static int
+dist_code(int dist)
+{
+  int i;
+  for (i = 29; dist_base[i] > dist; i--);
+  return i;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* blocks */
+
+/* run length encoding of the code lengths with the symbols 16, 17, 18;
+ * returns the number of entries in sym/extra */
+static int
+encode_lengths(const unsigned char *lens, int n, unsigned char *sym, unsigned char *extra)
+{
+  int i, run, count;
+
+  count = 0;
+  for (i = 0; i < n; i += run) {
+    for (run = 1; i + run < n && lens[i + run] == lens[i]; run++);
+    if (lens[i] == 0 && run >= 11) {
+      if (run > 138) {
+        run = 138;
+      }
+      sym[count] = 18;
+      extra[count++] = (unsigned char)(run - 11);
+    } else if (lens[i] == 0 && run >= 3) {
+      sym[count] = 17;
+      extra[count++] = (unsigned char)(run - 3);
+    } else if (run >= 4) {
+      /* the first one literally, then repeat 3..6 times */
+      if (run > 7) {
+        run = 7;
+      }
+      sym[count] = lens[i];
+      extra[count++] = 0;
+      sym[count] = 16;
+      extra[count++] = (unsigned char)(run - 4);
+    } else {
+      run = 1;
+      sym[count] = lens[i];
+      extra[count++] = 0;
+    }
+  }
+  return count;
+}
+
+static void
+write_block(struct bitbuf *b, const struct token *tokens, int count, int last)
+{
+  unsigned long lit_freq[NUM_LITLEN], dist_freq[NUM_DIST], clen_freq[NUM_CLEN];
+  unsigned char lens[NUM_LITLEN + NUM_DIST];
+  unsigned char lit_lens[NUM_LITLEN], dist_lens[NUM_DIST], clen_lens[NUM_CLEN];
+  unsigned short lit_codes[NUM_LITLEN], dist_codes[NUM_DIST], clen_codes[NUM_CLEN];
+  unsigned char sym[NUM_LITLEN + NUM_DIST], extra[NUM_LITLEN + NUM_DIST];
+  int i, c, nlit, ndist, nclen, nsym;
+
+  memset(lit_freq, 0, sizeof(lit_freq));
+  memset(dist_freq, 0, sizeof(dist_freq));
+  memset(clen_freq, 0, sizeof(clen_freq));
+  for (i = 0; i < count; i++) {
+    if (tokens[i].dist == 0) {
+      lit_freq[tokens[i].len]++;
+    } else {
+      lit_freq[257 + len_code(tokens[i].len)]++;
+      dist_freq[dist_code(tokens[i].dist)]++;
+    }
+  }
+  lit_freq[END_OF_BLOCK] = 1;
+
+  build_lengths(lit_freq, NUM_LITLEN, 15, lit_lens);
+  build_lengths(dist_freq, NUM_DIST, 15, dist_lens);
+  build_codes(lit_lens, NUM_LITLEN, lit_codes);
+  build_codes(dist_lens, NUM_DIST, dist_codes);
+
+  for (nlit = NUM_LITLEN; nlit > 257 && lit_lens[nlit - 1] == 0; nlit--);
+  for (ndist = NUM_DIST; ndist > 1 && dist_lens[ndist - 1] == 0; ndist--);
+  memcpy(lens, lit_lens, nlit);
+  memcpy(lens + nlit, dist_lens, ndist);
+  nsym = encode_lengths(lens, nlit + ndist, sym, extra);
+  for (i = 0; i < nsym; i++) {
+    clen_freq[sym[i]]++;
+  }
+  build_lengths(clen_freq, NUM_CLEN, 7, clen_lens);
+  build_codes(clen_lens, NUM_CLEN, clen_codes);
+  for (nclen = NUM_CLEN; nclen > 4 && clen_lens[clen_order[nclen - 1]] == 0; nclen--);
+
+  /* header: BFINAL, BTYPE=10 */
+  put_bits(b, last ? 1 : 0, 1);
+  put_bits(b, 2, 2);
+  put_bits(b, nlit - 257, 5);
+  put_bits(b, ndist - 1, 5);
+  put_bits(b, nclen - 4, 4);
+  for (i = 0; i < nclen; i++) {
+    put_bits(b, clen_lens[clen_order[i]], 3);
+  }
+  for (i = 0; i < nsym; i++) {
+    put_bits(b, clen_codes[sym[i]], clen_lens[sym[i]]);
+    switch (sym[i]) {
+      case 16: put_bits(b, extra[i], 2); break;
+      case 17: put_bits(b, extra[i], 3); break;
+      case 18: put_bits(b, extra[i], 7); break;
+    }
+  }
+
+  for (i = 0; i < count; i++) {
+    if (tokens[i].dist == 0) {
+      put_bits(b, lit_codes[tokens[i].len], lit_lens[tokens[i].len]);
+      continue;
+    }
+    c = len_code(tokens[i].len);
+    put_bits(b, lit_codes[257 + c], lit_lens[257 + c]);
+    put_bits(b, tokens[i].len - len_base[c], len_extra[c]);
+    c = dist_code(tokens[i].dist);
+    put_bits(b, dist_codes[c], dist_lens[c]);
+    put_bits(b, tokens[i].dist - dist_base[c], dist_extra[c]);
+  }
+  put_bits(b, lit_codes[END_OF_BLOCK], lit_lens[END_OF_BLOCK]);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* LZ77 */
+
+static int
+hash3(const unsigned char *p)
+{
+  return ((p[0] << 10) ^ (p[1] << 5) ^ p[2]) & (HASH_SIZE - 1);
+}
+
+static void
+insert(const unsigned char *src, int len, int pos, int *head, int *prev)
+{
+  int h;
+  if (pos + MIN_MATCH > len) {
+    return;
+  }
+  h = hash3(src + pos);
+  prev[pos] = head[h];
+  head[h] = pos;
+}
+
+/* longest match for pos among the earlier positions of its hash chain */
+static int
+find_match(const unsigned char *src, int len, int pos, const int *prev, int *dist)
+{
+  int cand, best, n, max, chain;
+
+  best = 0;
+  max = len - pos;
+  if (max > MAX_MATCH) {
+    max = MAX_MATCH;
+  }
+  if (max < MIN_MATCH) {
+    return 0;
+  }
+  chain = MAX_CHAIN;
+  for (cand = prev[pos]; cand >= 0 && pos - cand <= WINDOW_SIZE && chain-- > 0; cand = prev[cand]) {
+    if (src[cand + best] != src[pos + best]) {
+      continue;
+    }
+    for (n = 0; n < max && src[cand + n] == src[pos + n]; n++);
+    if (n > best) {
+      best = n;
+      *dist = pos - cand;
+      if (n >= NICE_MATCH || n == max) {
+        break;
+      }
+    }
+  }
+  return best >= MIN_MATCH ? best : 0;
+}
+
+unsigned long
+crc32(const unsigned char *data, int len)
+{
+  unsigned long crc = 0xFFFFFFFFUL;
+  int i, k;
+  for (i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+    }
+  }
+  return crc ^ 0xFFFFFFFFUL;
+}
+
+int
+deflate_gzip(const unsigned char *src, int len, unsigned char **dst)
+{
+  static const unsigned char gzip_header[10] = {
+    0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 2, 255 /* deflate, no mtime, best, unknown OS */
+  };
+  struct bitbuf b;
+  struct token *tokens;
+  int *head, *prev;
+  int i, pos, count, mlen, dist, next_len, next_dist;
+
+  memset(&b, 0, sizeof(b));
+  head = (int *)malloc(HASH_SIZE * sizeof(int));
+  prev = (int *)malloc((len + 1) * sizeof(int));
+  tokens = (struct token *)calloc(BLOCK_TOKENS, sizeof(struct token));
+  if (head == NULL || prev == NULL || tokens == NULL) {
+    free(head);
+    free(prev);
+    free(tokens);
+    return -1;
+  }
+  for (i = 0; i < HASH_SIZE; i++) {
+    head[i] = -1;
+  }
+
+  for (i = 0; i < (int)sizeof(gzip_header); i++) {
+    put_byte(&b, gzip_header[i]);
+  }
+
+  count = 0;
+  pos = 0;
+  dist = 0;
+  if (len > 0) {
+    insert(src, len, 0, head, prev);
+  }
+  mlen = len > 0 ? find_match(src, len, 0, prev, &dist) : 0;
+  while (pos < len) {
+    if (mlen > 0) {
+      /* lazy evaluation: a longer match at the next byte wins */
+      insert(src, len, pos + 1, head, prev);
+      next_dist = 0;
+      next_len = find_match(src, len, pos + 1, prev, &next_dist);
+      if (next_len > mlen) {
+        tokens[count].len = src[pos];
+        tokens[count++].dist = 0;
+        pos++;
+        mlen = next_len;
+        dist = next_dist;
+      } else {
+        tokens[count].len = (unsigned short)mlen;
+        tokens[count++].dist = (unsigned short)dist;
+        for (i = pos + 2; i < pos + mlen; i++) {
+          insert(src, len, i, head, prev);
+        }
+        pos += mlen;
+        if (pos < len) {
+          insert(src, len, pos, head, prev);
+        }
+        mlen = pos < len ? find_match(src, len, pos, prev, &dist) : 0;
+      }
+    } else {
+      tokens[count].len = src[pos];
+      tokens[count++].dist = 0;
+      pos++;
+      if (pos < len) {
+        insert(src, len, pos, head, prev);
+      }
+      mlen = pos < len ? find_match(src, len, pos, prev, &dist) : 0;
+    }
+    if (count == BLOCK_TOKENS) {
+      write_block(&b, tokens, count, 0);
+      count = 0;
+    }
+  }
+  write_block(&b, tokens, count, 1);
+  flush_bits(&b);
+
+  put_le32(&b, crc32(src, len));
+  put_le32(&b, (unsigned long)len);
+
+  free(head);
+  free(prev);
+  free(tokens);
+  if (b.failed) {
+    free(b.data);
+    return -1;
+  }
+  *dst = b.data;
+  return b.len;
+}
@@ -0,0 +1,19 @@
+/**
+ * deflate: minimal gzip (RFC 1951/1952) encoder for makefsdata.
+ *
+ * LZ77 with hash chains and lazy matching, dynamic Huffman blocks.
+ * The output is deterministic (no time stamp, no file name).
+ */
+
+#ifndef __DEFLATE_H__
+#define __DEFLATE_H__
+
+/** Compresses len bytes of src into a gzip member.
+ * @param dst receives a malloc'ed buffer, free it with free()
+ * @return length of *dst or -1 if out of memory */
+int deflate_gzip(const unsigned char *src, int len, unsigned char **dst);
+
+/** CRC-32 (IEEE 802.3) of len bytes, as used in the gzip trailer. */
+unsigned long crc32(const unsigned char *data, int len);
+
+#endif /* __DEFLATE_H__ */
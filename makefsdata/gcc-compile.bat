@@ -1 +1 @@
-gcc -I..\lrndis\lwip-1.4.1\apps\httpserver_raw -I..\lrndis\lwip-1.4.1\src\include -I..\lrndis\lwip-1.4.1\src\include\ipv4 ./makefsdata.c -o htmlgen.exe
+gcc -I..\lrndis\lwip-1.4.1\apps\httpserver_raw -I..\lrndis\lwip-1.4.1\src\include -I..\lrndis\lwip-1.4.1\src\include\ipv4 ./makefsdata.c ./deflate.c -o htmlgen.exe
@@ -17,12 +17,15 @@
 #define WIN32_LEAN_AND_MEAN
 #include "windows.h"
 #else
-#include <dir.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
-#include <dos.h>
 #include <string.h>
 
-/* Compatibility defines Win32 vs. DOS */
+#include "deflate.h"
+
+/* Compatibility defines Win32 vs. POSIX */
 #ifdef WIN32
 
 #define FIND_T                        WIN32_FIND_DATAA
@@ -42,22 +45,88 @@
 #define NEWLINE     "\r\n"
 #define NEWLINE_LEN 2
 
+#define DEFAULT_PATH   "..\\www"
+#define DEFAULT_TARGET "..\\project\\fsdata.c"
+
+#define COMMENT(str)   (str)
+
 #else
 
-#define FIND_T                        struct ffblk
-#define FIND_T_FILENAME(fInfo)        (fInfo.ff_name)
-#define FIND_T_IS_DIR(fInfo)          ((fInfo.ff_attrib & FA_DIREC) == FA_DIREC)
-#define FIND_T_IS_FILE(fInfo)         (1)
+/* directory listing in the order of FindFirstFile/FindNextFile on NTFS,
+ * so that both builds produce the same fsdata.c */
+typedef struct {
+  struct dirent **list;
+  int count;
+  int index;
+} FIND_T;
+
+static int find_first(const char *path, FIND_T *f)
+{
+  struct stat st;
+  f->list = NULL;
+  f->count = 0;
+  f->index = 0;
+  if ((strcmp(path, "*") != 0) && (strcmp(path, "*.*") != 0)) {
+    /* only checks for existence of a directory */
+    return ((stat(path, &st) == 0) && S_ISDIR(st.st_mode)) ? 0 : -1;
+  }
+  f->count = scandir(".", &f->list, NULL, alphasort);
+  return (f->count > 0) ? 0 : -1;
+}
+
+static int find_next(FIND_T *f)
+{
+  if (++f->index < f->count) {
+    return 0;
+  }
+  while (f->count > 0) {
+    free(f->list[--f->count]);
+  }
+  free(f->list);
+  f->list = NULL;
+  return -1;
+}
+
+static int find_is_dir(const char *name)
+{
+  struct stat st;
+  return (stat(name, &st) == 0) && S_ISDIR(st.st_mode);
+}
+
+#define FIND_T_FILENAME(fInfo)        (fInfo.list[fInfo.index]->d_name)
+#define FIND_T_IS_DIR(fInfo)          find_is_dir(FIND_T_FILENAME(fInfo))
+#define FIND_T_IS_FILE(fInfo)         (!find_is_dir(FIND_T_FILENAME(fInfo)))
 #define FIND_RET_T                    int
-#define FINDFIRST_FILE(path, result)  findfirst(path, result, FA_ARCH)
-#define FINDFIRST_DIR(path, result)   findfirst(path, result, FA_DIREC)
-#define FINDNEXT(ff_res, result)      FindNextFileA(ff_res, result)
+#define FINDFIRST_FILE(path, result)  find_first(path, result)
+#define FINDFIRST_DIR(path, result)   find_first(path, result)
+#define FINDNEXT(ff_res, result)      find_next(result)
 #define FINDFIRST_SUCCEEDED(ret)      (ret == 0)
 #define FINDNEXT_SUCCEEDED(ret)       (ret == 0)
 
 #define GETCWD(path, len)             getcwd(path, len)
 #define CHDIR(path)                   chdir(path)
 
+#define NEWLINE     "\n"
+#define NEWLINE_LEN 1
+
+#define DEFAULT_PATH   "../www"
+#define DEFAULT_TARGET "../project/fsdata.c"
+
+/* header strings quoted in comments, without the CR of their CRLFs */
+static const char *comment_str(const char *str)
+{
+  static char buf[1024];
+  size_t len = 0;
+  for (; (*str != 0) && (len < sizeof(buf) - 1); str++) {
+    if (*str != '\r') {
+      buf[len++] = *str;
+    }
+  }
+  buf[len] = 0;
+  return buf;
+}
+#define COMMENT(str)   comment_str(str)
+
 #endif
 
 /* define this to get the header variables we use to build HTTP headers */
@@ -87,11 +156,13 @@ static int payload_alingment_dummy_counter = 0;
 
 int process_sub(FILE *data_file, FILE *struct_file);
 int process_file(FILE *data_file, FILE *struct_file, const char *filename);
-int file_write_http_header(FILE *data_file, const char *filename, int file_size,
+int file_write_http_header(FILE *data_file, const char *filename, int file_size, int encoding,
+                           const char *etag, const char *cache_control,
                            u16_t *http_hdr_len, u16_t *http_hdr_chksum);
 int file_put_ascii(FILE *file, const char *ascii_string, int len, int *i);
 int s_put_ascii(char *buf, const char *ascii_string, int len, int *i);
 void concat_files(const char *file1, const char *file2, const char *targetfile);
+void write_hash_index(FILE *struct_file);
 
 static unsigned char file_buffer_raw[COPY_BUFSIZE];
 /* 5 bytes per char + 3 bytes per line */
@@ -106,6 +177,18 @@ unsigned char includeHttpHeader = 1;
 unsigned char useHttp11 = 0;
 unsigned char supportSsi = 1;
 unsigned char precalcChksum = 0;
+unsigned char supportGzip = 1;
+int cacheMaxAge = 3600;
+
+/* names and variables of the files in the list, for the hash index */
+char **fileNames = NULL;
+char **fileVars = NULL;
+int fileCount = 0;
+
+/* encoding argument of file_write_http_header */
+#define ENCODING_NONE 0 /* no variant, plain header */
+#define ENCODING_VARY 1 /* raw copy of a file which has a gzip variant */
+#define ENCODING_GZIP 2 /* the gzip variant */
 
 int main(int argc, char *argv[])
 {
@@ -118,7 +201,7 @@ int main(int argc, char *argv[])
   int filesProcessed;
   int i;
   char targetfile[MAX_PATH_LEN];
-  strcpy(targetfile, "..\\project\\fsdata.c");
+  strcpy(targetfile, DEFAULT_TARGET);
 
   memset(path, 0, sizeof(path));
   memset(appPath, 0, sizeof(appPath));
@@ -127,7 +210,7 @@ int main(int argc, char *argv[])
   printf("     by Jim Pettinato               - circa 2003 " NEWLINE);
   printf("     extended by Simon Goldschmidt  - 2009 " NEWLINE NEWLINE);
 
-  strcpy(path, "..\\www");
+  strcpy(path, DEFAULT_PATH);
   for(i = 1; i < argc; i++) {
     if (argv[i][0] == '-') {
       if (strstr(argv[i], "-s")) {
@@ -140,6 +223,10 @@ int main(int argc, char *argv[])
         supportSsi = 0;
       } else if (strstr(argv[i], "-c")) {
         precalcChksum = 1;
+      } else if (strstr(argv[i], "-nogz")) {
+        supportGzip = 0;
+      } else if (strstr(argv[i], "-maxage:") == argv[i]) {
+        cacheMaxAge = atoi(&argv[i][8]);
       } else if((argv[i][1] == 'f') && (argv[i][2] == ':')) {
         strcpy(targetfile, &argv[i][3]);
         printf("Writing to file \"%s\"\n", targetfile);
@@ -158,9 +245,11 @@ int main(int argc, char *argv[])
     printf("   targetdir: relative or absolute path to files to convert" NEWLINE);
     printf("   switch -s: toggle processing of subdirectories (default is on)" NEWLINE);
     printf("   switch -e: exclude HTTP header from file (header is created at runtime, default is off)" NEWLINE);
-    printf("   switch -11: include HTTP 1.1 header (1.0 is default)" NEWLINE);
+    printf("   switch -11: include HTTP 1.1 header with Content-Length (1.0 is default)" NEWLINE);
     printf("   switch -nossi: no support for SSI (cannot calculate Content-Length for SSI)" NEWLINE);
     printf("   switch -c: precalculate checksums for all pages (default is off)" NEWLINE);
+    printf("   switch -nogz: no gzip variants of text files (default is on)" NEWLINE);
+    printf("   switch -maxage:<s>: Cache-Control max-age of non-html files with -11 (default 3600)" NEWLINE);
     printf("   switch -f: target filename (default is \"fsdata.c\")" NEWLINE);
     printf("   if targetdir not specified, htmlgen will attempt to" NEWLINE);
     printf("   process files in subdirectory 'fs'" NEWLINE);
@@ -206,6 +295,7 @@ int main(int argc, char *argv[])
   /* data_file now contains all of the raw data.. now append linked list of
    * file header structs to allow embedded app to search for a file name */
   fprintf(data_file, NEWLINE NEWLINE);
+  write_hash_index(struct_file);
   fprintf(struct_file, "#define FS_ROOT file_%s" NEWLINE, lastFileVar);
   fprintf(struct_file, "#define FS_NUMFILES %d" NEWLINE NEWLINE, filesProcessed);
 
@@ -303,34 +393,40 @@ int process_sub(FILE *data_file, FILE *struct_file)
   return filesProcessed;
 }
 
-int get_file_size(const char* filename)
+unsigned char *read_file(const char *filename, int *file_size)
 {
   FILE *inFile;
-  int file_size = -1;
+  unsigned char *data;
   inFile = fopen(filename, "rb");
   if (inFile == NULL) {
     printf("Failed to open file \"%s\"\n", filename);
     exit(-1);
   }
   fseek(inFile, 0, SEEK_END);
-  file_size = ftell(inFile);
+  *file_size = ftell(inFile);
+  fseek(inFile, 0, SEEK_SET);
+  data = (unsigned char *)malloc(*file_size + 1);
+  if ((data == NULL) || (fread(data, 1, *file_size, inFile) != (size_t)*file_size)) {
+    printf("Failed to read file \"%s\"\n", filename);
+    exit(-1);
+  }
   fclose(inFile);
-  return file_size;
+  return data;
 }
 
-void process_file_data(const char *filename, FILE *data_file)
+void process_file_data(const unsigned char *data, int file_size, FILE *data_file)
 {
-  FILE *source_file;
   size_t len, written, i, src_off=0;
 
-  source_file = fopen(filename, "rb");
-
   do {
     size_t off = 0;
-    len = fread(file_buffer_raw, 1, COPY_BUFSIZE, source_file);
+    len = file_size - src_off;
+    if (len > COPY_BUFSIZE) {
+      len = COPY_BUFSIZE;
+    }
     if (len > 0) {
       for (i = 0; i < len; i++) {
-        sprintf(&file_buffer_c[off], "0x%02.2x,", file_buffer_raw[i]);
+        sprintf(&file_buffer_c[off], "0x%02.2x,", data[src_off]);
         off += 5;
         if ((++src_off % HEX_BYTES_PER_LINE) == 0) {
           memcpy(&file_buffer_c[off], NEWLINE, NEWLINE_LEN);
@@ -340,17 +436,15 @@ void process_file_data(const char *filename, FILE *data_file)
       written = fwrite(file_buffer_c, 1, off, data_file);
     }
   } while(len > 0);
-  fclose(source_file);
 }
 
-int write_checksums(FILE *struct_file, const char *filename, const char *varname,
+int write_checksums(FILE *struct_file, const unsigned char *data, int file_size, const char *varname,
                     u16_t hdr_len, u16_t hdr_chksum)
 {
   int chunk_size = TCP_MSS;
   int offset;
   size_t len;
   int i = 0;
-  FILE *f;
 #if LWIP_TCP_TIMESTAMPS
   /* when timestamps are used, usable space is 12 bytes less per segment */
   chunk_size -= 12;
@@ -359,52 +453,250 @@ int write_checksums(FILE *struct_file, const char *filename, const char *varname
   fprintf(struct_file, "#if HTTPD_PRECALCULATED_CHECKSUM" NEWLINE);
   fprintf(struct_file, "const struct fsdata_chksum chksums_%s[] = {" NEWLINE, varname);
 
-  memset(file_buffer_raw, 0xab, sizeof(file_buffer_raw));
-  f = fopen(filename, "rb");
-  if (f == INVALID_HANDLE_VALUE) {
-    printf("Failed to open file \"%s\"\n", filename);
-    exit(-1);
-  }
   if (hdr_len > 0) {
     /* add checksum for HTTP header */
     fprintf(struct_file, "{%d, 0x%04x, %d}," NEWLINE, 0, hdr_chksum, hdr_len);
     i++;
   }
-  for (offset = hdr_len; ; offset += len) {
+  for (offset = 0; offset < file_size; offset += len) {
     unsigned short chksum;
-    len = fread(file_buffer_raw, 1, chunk_size, f);
-    if (len == 0) {
-      break;
+    len = file_size - offset;
+    if (len > (size_t)chunk_size) {
+      len = chunk_size;
     }
+    memcpy(file_buffer_raw, data + offset, len);
     chksum = ~inet_chksum(file_buffer_raw, (u16_t)len);
     /* add checksum for data */
-    fprintf(struct_file, "{%d, 0x%04x, %d}," NEWLINE, offset, chksum, len);
+    fprintf(struct_file, "{%d, 0x%04x, %d}," NEWLINE, hdr_len + offset, chksum, len);
     i++;
   }
-  fclose(f);
   fprintf(struct_file, "};" NEWLINE);
   fprintf(struct_file, "#endif /* HTTPD_PRECALCULATED_CHECKSUM */" NEWLINE);
   return i;
 }
 
-int process_file(FILE *data_file, FILE *struct_file, const char *filename)
+/** Text files are worth a gzip variant. SSI files are parsed at runtime
+ * and error pages are opened without Accept-Encoding, so they are not. */
+static int is_compressible(const char *filename)
+{
+  static const char * const extensions[] = {
+    ".html", ".htm", ".js", ".css", ".svg", ".xsl", ".txt", ".json"
+  };
+  size_t loop, len, ext_len;
+
+  for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
+    if (strstr(filename, g_pcSSIExtensions[loop])) {
+      return 0;
+    }
+  }
+  if ((strstr(filename, "404") == filename) || (strstr(filename, "400") == filename) ||
+      (strstr(filename, "501") == filename)) {
+    return 0;
+  }
+  len = strlen(filename);
+  for (loop = 0; loop < sizeof(extensions) / sizeof(extensions[0]); loop++) {
+    ext_len = strlen(extensions[loop]);
+    if ((len > ext_len) && !strcmp(filename + len - ext_len, extensions[loop])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/** Files with a fixed 200 response get an ETag and Cache-Control (HTTP/1.1
+ * only). SSI output changes at runtime and error pages must not be cached. */
+static int is_cacheable(const char *filename)
+{
+  size_t loop;
+
+  if (!useHttp11 || !includeHttpHeader) {
+    return 0;
+  }
+  for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
+    if (strstr(filename, g_pcSSIExtensions[loop])) {
+      return 0;
+    }
+  }
+  return (strstr(filename, "404") != filename) && (strstr(filename, "400") != filename) &&
+         (strstr(filename, "501") != filename);
+}
+
+/** Index of the content-type string in g_psHTTPHeaderStrings for a file. */
+static int get_file_type(const char *filename)
+{
+  const char *file_ext;
+  int j;
+
+  file_ext = filename;
+  while(strstr(file_ext, ".") != NULL) {
+    file_ext = strstr(file_ext, ".");
+    file_ext++;
+  }
+  if((file_ext == NULL) || (*file_ext == 0)) {
+    printf("failed to get extension for file \"%s\", using default.\n", filename);
+    return HTTP_HDR_DEFAULT_TYPE;
+  }
+  for(j = 0; j < NUM_HTTP_HEADERS; j++) {
+    if(!strcmp(file_ext, g_psHTTPHeaders[j].extension)) {
+      return g_psHTTPHeaders[j].headerIndex;
+    }
+  }
+  printf("failed to get file type for extension \"%s\", using default.\n", file_ext);
+  return HTTP_HDR_DEFAULT_TYPE;
+}
+
+/** Pages are revalidated on every load (they link the other files, so a new
+ * firmware shows up at once), everything else is cached for cacheMaxAge. */
+static void get_cache_control(const char *filename, char *buf)
+{
+  if ((get_file_type(filename) == HTTP_HDR_HTML) || (cacheMaxAge <= 0)) {
+    strcpy(buf, g_psHTTPHeaderStrings[HTTP_HDR_NO_CACHE]);
+  } else {
+    sprintf(buf, "%s%d\r\n", g_psHTTPHeaderStrings[HTTP_HDR_MAX_AGE], cacheMaxAge);
+  }
+}
+
+/** Writes str as a C string literal, one line per header line. */
+static void write_c_string(FILE *file, const char *str)
+{
+  fprintf(file, "\"");
+  for (; *str != 0; str++) {
+    if (*str == '\r') {
+      fprintf(file, "\\r");
+    } else if ((*str == '\n') && (str[1] != 0)) {
+      fprintf(file, "\\n\"" NEWLINE "\"");
+    } else if (*str == '\n') {
+      fprintf(file, "\\n");
+    } else {
+      if ((*str == '"') || (*str == '\\')) {
+        fputc('\\', file);
+      }
+      fputc(*str, file);
+    }
+  }
+  fprintf(file, "\"");
+}
+
+/** Writes the ETag of a file and its complete "304 Not Modified" response. */
+static void write_not_modified(FILE *data_file, const char *varname, const char *etag,
+                               const char *cache_control, int encoding)
+{
+  char buf[512];
+
+  sprintf(buf, "%s%s%s%s\r\n%s%s\r\n", g_psHTTPHeaderStrings[HTTP_HDR_NOT_MODIFIED_11],
+    serverID, g_psHTTPHeaderStrings[HTTP_HDR_ETAG], etag, cache_control,
+    (encoding != ENCODING_NONE) ? g_psHTTPHeaderStrings[HTTP_HDR_VARY] : "");
+  fprintf(data_file, "#if HTTPD_FS_ETAG" NEWLINE);
+  fprintf(data_file, "static const char etag_%s[] = ", varname);
+  write_c_string(data_file, etag);
+  fprintf(data_file, ";" NEWLINE "static const char not_modified_%s[] =" NEWLINE, varname);
+  write_c_string(data_file, buf);
+  fprintf(data_file, ";" NEWLINE "#endif /* HTTPD_FS_ETAG */" NEWLINE NEWLINE);
+}
+
+/** SSI files as recognized by httpd (g_pcSSIExtensions). */
+static int is_ssi_file(const char *filename)
+{
+  size_t loop;
+
+  if (!supportSsi) {
+    return 0;
+  }
+  for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
+    if (strstr(filename, g_pcSSIExtensions[loop])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int is_tag_space(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+/** Writes the tags of an SSI file as a list of struct fsdata_ssi_seg.
+ * Tags are parsed like http_ssi_render() does at runtime: whole
+ * "<!--#" [ws] name [ws] "-->" with names up to LWIP_HTTPD_MAX_TAG_NAME_LEN.
+ * @return 1 if the list was written, 0 if a text is too long for it */
+static int write_ssi_segments(FILE *data_file, const char *varname,
+                              const unsigned char *data, int file_size)
+{
+  const char *src = (const char *)data;
+  const char *end = src + file_size;
+  const char *text = src, *tag, *name, *p;
+  int count = 0;
+  char *list = (char *)malloc(file_size * 2 + 64);
+  size_t list_len = 0;
+
+  if (list == NULL) {
+    return 0;
+  }
+  for (tag = src; end - tag >= 5; tag++) {
+    if (memcmp(tag, "<!--#", 5)) {
+      continue;
+    }
+    for (name = tag + 5; (name < end) && is_tag_space(*name); name++);
+    for (p = name; (p < end) && (p - name <= LWIP_HTTPD_MAX_TAG_NAME_LEN) && (*p != '-') &&
+         !is_tag_space(*p); p++);
+    if ((p == name) || (p - name > LWIP_HTTPD_MAX_TAG_NAME_LEN)) {
+      continue;
+    }
+    for (src = p; (src < end) && is_tag_space(*src); src++);
+    if ((end - src < 3) || memcmp(src, "-->", 3)) {
+      continue;
+    }
+    src += 3;
+    if (tag - text > 0xffff) {
+      free(list);
+      return 0;
+    }
+    list_len += sprintf(list + list_len, "{%d, %d, \"%.*s\"}," NEWLINE,
+      (int)(tag - text), (int)(src - tag), (int)(p - name), name);
+    text = src;
+    tag = src - 1;
+    count++;
+  }
+  if (end - text > 0xffff) {
+    free(list);
+    return 0;
+  }
+  fprintf(data_file, "#if HTTPD_FS_SSI_SEGMENTS" NEWLINE);
+  fprintf(data_file, "/* %d tags */" NEWLINE, count);
+  fprintf(data_file, "static const struct fsdata_ssi_seg ssi_segs_%s[] = {" NEWLINE, varname);
+  fwrite(list, 1, list_len, data_file);
+  fprintf(data_file, "{%d, 0, NULL}," NEWLINE, (int)(end - text));
+  fprintf(data_file, "};" NEWLINE "#endif /* HTTPD_FS_SSI_SEGMENTS */" NEWLINE NEWLINE);
+  free(list);
+  return 1;
+}
+
+/** Writes the data array and the struct fsdata_file of one variant of a file.
+ * @param next variable name of the next file in the list ("NULL" for variants
+ *        which are only reachable through fsdata_file.gzip)
+ * @param gzip variable name of the gzip variant or "NULL" */
+void write_file_entry(FILE *data_file, FILE *struct_file, const char *filename,
+                      const char *qualifiedName, const char *varname,
+                      const unsigned char *data, int file_size, int encoding,
+                      const char *next, const char *gzip)
 {
-  char *pch;
-  char varname[MAX_PATH_LEN];
   int i = 0;
-  char qualifiedName[MAX_PATH_LEN];
-  int file_size;
   u16_t http_hdr_chksum = 0;
   u16_t http_hdr_len = 0;
   int chksum_count = 0;
-
-  /* create qualified name (TODO: prepend slash or not?) */
-  sprintf(qualifiedName,"%s/%s", curSubdir, filename);
-  /* create C variable name */
-  strcpy(varname, qualifiedName);
-  /* convert slashes & dots to underscores */
-  while ((pch = strpbrk(varname, "./\\")) != NULL) {
-    *pch = '_';
+  char etag[32];
+  char cache_control[64];
+  int cacheable = is_cacheable(filename);
+  int segments = 0;
+
+  if (cacheable) {
+    /* the validator changes with the bytes sent, so each variant has its own */
+    sprintf(etag, "\"%08lx-%x\"", crc32(data, file_size), file_size);
+    get_cache_control(filename, cache_control);
+    write_not_modified(data_file, varname, etag, cache_control, encoding);
+  }
+  if (is_ssi_file(filename)) {
+    segments = write_ssi_segments(data_file, varname, data, file_size);
   }
 #if ALIGN_PAYLOAD
   /* to force even alignment of array */
@@ -412,7 +704,7 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
 #endif /* ALIGN_PAYLOAD */
   fprintf(data_file, "static const unsigned char data_%s[] = {" NEWLINE, varname);
   /* encode source file name (used by file system, not returned to browser) */
-  fprintf(data_file, "/* %s (%d chars) */" NEWLINE, qualifiedName, strlen(qualifiedName)+1);
+  fprintf(data_file, "/* %s (%d chars) */" NEWLINE, qualifiedName, (int)strlen(qualifiedName)+1);
   file_put_ascii(data_file, qualifiedName, strlen(qualifiedName)+1, &i);
 #if ALIGN_PAYLOAD
   /* pad to even number of bytes to assure payload is on aligned boundary */
@@ -423,39 +715,221 @@ int process_file(FILE *data_file, FILE *struct_file, const char *filename)
 #endif /* ALIGN_PAYLOAD */
   fprintf(data_file, NEWLINE);
 
-  file_size = get_file_size(filename);
   if (includeHttpHeader) {
-    file_write_http_header(data_file, filename, file_size, &http_hdr_len, &http_hdr_chksum);
+    file_write_http_header(data_file, filename, file_size, encoding,
+      cacheable ? etag : NULL, cacheable ? cache_control : NULL, &http_hdr_len, &http_hdr_chksum);
   }
   if (precalcChksum) {
-    chksum_count = write_checksums(struct_file, filename, varname, http_hdr_len, http_hdr_chksum);
+    chksum_count = write_checksums(struct_file, data, file_size, varname, http_hdr_len, http_hdr_chksum);
   }
 
   /* build declaration of struct fsdata_file in temp file */
   fprintf(struct_file, "const struct fsdata_file file_%s[] = { {" NEWLINE, varname);
-  fprintf(struct_file, "file_%s," NEWLINE, lastFileVar);
+  fprintf(struct_file, "file_%s," NEWLINE, next);
   fprintf(struct_file, "data_%s," NEWLINE, varname);
   fprintf(struct_file, "data_%s + %d," NEWLINE, varname, i);
   fprintf(struct_file, "sizeof(data_%s) - %d," NEWLINE, varname, i);
   fprintf(struct_file, "%d," NEWLINE, includeHttpHeader);
+  if (supportGzip) {
+    fprintf(struct_file, "#if HTTPD_FS_GZIP" NEWLINE);
+    fprintf(struct_file, "file_%s," NEWLINE, gzip);
+    fprintf(struct_file, "#endif /* HTTPD_FS_GZIP */" NEWLINE);
+  }
+  fprintf(struct_file, "#if HTTPD_FS_ETAG" NEWLINE);
+  if (cacheable) {
+    fprintf(struct_file, "etag_%s, not_modified_%s," NEWLINE, varname, varname);
+  } else {
+    fprintf(struct_file, "NULL, NULL," NEWLINE);
+  }
+  fprintf(struct_file, "#endif /* HTTPD_FS_ETAG */" NEWLINE);
+  fprintf(struct_file, "#if HTTPD_FS_SSI_SEGMENTS" NEWLINE);
+  if (segments) {
+    fprintf(struct_file, "ssi_segs_%s," NEWLINE, varname);
+  } else {
+    fprintf(struct_file, "NULL," NEWLINE);
+  }
+  fprintf(struct_file, "#endif /* HTTPD_FS_SSI_SEGMENTS */" NEWLINE);
   if (precalcChksum) {
     fprintf(struct_file, "#if HTTPD_PRECALCULATED_CHECKSUM" NEWLINE);
     fprintf(struct_file, "%d, chksums_%s," NEWLINE, chksum_count, varname);
     fprintf(struct_file, "#endif /* HTTPD_PRECALCULATED_CHECKSUM */" NEWLINE);
   }
   fprintf(struct_file, "}};" NEWLINE NEWLINE);
-  strcpy(lastFileVar, varname);
 
   /* write actual file contents */
-  i = 0;
-  fprintf(data_file, NEWLINE "/* raw file data (%d bytes) */" NEWLINE, file_size);
-  process_file_data(filename, data_file);
+  fprintf(data_file, NEWLINE "/* %s file data (%d bytes) */" NEWLINE,
+    (encoding == ENCODING_GZIP) ? "gzip" : "raw", file_size);
+  process_file_data(data, file_size, data_file);
   fprintf(data_file, "};" NEWLINE NEWLINE);
+}
+
+int process_file(FILE *data_file, FILE *struct_file, const char *filename)
+{
+  char *pch;
+  char varname[MAX_PATH_LEN];
+  char gzipname[MAX_PATH_LEN];
+  char qualifiedName[MAX_PATH_LEN];
+  int file_size;
+  int gzip_size = -1;
+  unsigned char *data;
+  unsigned char *gzip_data = NULL;
+
+  /* create qualified name (TODO: prepend slash or not?) */
+  sprintf(qualifiedName,"%s/%s", curSubdir, filename);
+  /* create C variable name */
+  strcpy(varname, qualifiedName);
+  /* convert slashes & dots to underscores */
+  while ((pch = strpbrk(varname, "./\\")) != NULL) {
+    *pch = '_';
+  }
+
+  data = read_file(filename, &file_size);
+  strcpy(gzipname, "NULL");
+  if (supportGzip && is_compressible(filename)) {
+    gzip_size = deflate_gzip(data, file_size, &gzip_data);
+    /* keep it if it saves more than an eighth, the header grows a bit */
+    if ((gzip_size > 0) && (gzip_size + 24 < file_size - file_size / 8)) {
+      sprintf(gzipname, "%s__gz", varname);
+      write_file_entry(data_file, struct_file, filename, qualifiedName, gzipname,
+        gzip_data, gzip_size, ENCODING_GZIP, "NULL", "NULL");
+      printf("  gzip variant: %d of %d bytes" NEWLINE, gzip_size, file_size);
+    }
+    free(gzip_data);
+  }
+  write_file_entry(data_file, struct_file, filename, qualifiedName, varname,
+    data, file_size, strcmp(gzipname, "NULL") ? ENCODING_VARY : ENCODING_NONE,
+    lastFileVar, gzipname);
+  strcpy(lastFileVar, varname);
+  fileNames = (char **)realloc(fileNames, (fileCount + 1) * sizeof(char *));
+  fileVars = (char **)realloc(fileVars, (fileCount + 1) * sizeof(char *));
+  if ((fileNames == NULL) || (fileVars == NULL)) {
+    printf("Out of memory" NEWLINE);
+    exit(-1);
+  }
+  fileNames[fileCount] = strdup(qualifiedName);
+  fileVars[fileCount] = strdup(varname);
+  fileCount++;
+  free(data);
 
   return 0;
 }
 
-int file_write_http_header(FILE *data_file, const char *filename, int file_size,
+/** Hash of a file name, the same as fs_hash() in fs.c. */
+static unsigned long fs_hash(const char *name, unsigned long seed)
+{
+  unsigned long h = 2166136261UL ^ seed;
+  while (*name != 0) {
+    h = ((h ^ (unsigned char)*name++) * 16777619UL) & 0xffffffffUL;
+  }
+  h ^= h >> 16;
+  h = (h * 0x85ebca6bUL) & 0xffffffffUL;
+  return h ^ (h >> 13);
+}
+
+/** Places the files of each bucket (fs_hash(name, 0)) into free slots of
+ * the table with the first seed which maps all of them to distinct free
+ * slots, biggest buckets first ("hash and displace").
+ * @return 1 if all files got a slot */
+static int place_files(int buckets, int size, unsigned short *disp, int *slots)
+{
+  int *bucket_of = (int *)malloc((fileCount + 1) * sizeof(int));
+  int *count = (int *)calloc(buckets, sizeof(int));
+  int *mine = (int *)malloc((fileCount + 1) * sizeof(int));
+  int b, k, n, j, max = 0, ok = 1;
+  unsigned long d;
+
+  for (k = 0; k < size; k++) {
+    slots[k] = -1;
+  }
+  for (k = 0; k < fileCount; k++) {
+    bucket_of[k] = (int)(fs_hash(fileNames[k], 0) & (buckets - 1));
+    if (++count[bucket_of[k]] > max) {
+      max = count[bucket_of[k]];
+    }
+  }
+  memset(disp, 0, buckets * sizeof(unsigned short));
+  for (n = max; (n > 0) && ok; n--) {
+    for (b = 0; (b < buckets) && ok; b++) {
+      if (count[b] != n) {
+        continue;
+      }
+      for (d = 1; d <= 0xffff; d++) {
+        /* all files of the bucket in free slots, no two in the same one */
+        for (k = 0, j = 0; k < fileCount; k++) {
+          if (bucket_of[k] == b) {
+            mine[j] = (int)(fs_hash(fileNames[k], d) & (size - 1));
+            if (slots[mine[j]] >= 0) {
+              break;
+            }
+            slots[mine[j]] = k;
+            j++;
+          }
+        }
+        if (k == fileCount) {
+          disp[b] = (unsigned short)d;
+          break;
+        }
+        while (j > 0) {
+          slots[mine[--j]] = -1;
+        }
+      }
+      ok = (d <= 0xffff);
+    }
+  }
+  free(bucket_of);
+  free(count);
+  free(mine);
+  return ok;
+}
+
+/** Writes the perfect hash index of the file list used by fs_open()
+ * (HTTPD_FS_HASH): a name is at
+ * fs_hash_files[fs_hash(name, fs_hash_disp[fs_hash(name, 0) % buckets]) % size] */
+void write_hash_index(FILE *struct_file)
+{
+  int buckets = 1, size = 1, k;
+  unsigned short *disp;
+  int *slots;
+
+  /* about two files per bucket, a table at least as big as the list */
+  while (buckets * 2 < fileCount) {
+    buckets <<= 1;
+  }
+  while (size < fileCount) {
+    size <<= 1;
+  }
+  disp = (unsigned short *)malloc(buckets * sizeof(unsigned short));
+  slots = (int *)malloc(size * sizeof(int));
+  while ((disp != NULL) && (slots != NULL) && !place_files(buckets, size, disp, slots)) {
+    size <<= 1;
+    slots = (int *)realloc(slots, size * sizeof(int));
+  }
+  if ((disp == NULL) || (slots == NULL)) {
+    printf("Out of memory" NEWLINE);
+    exit(-1);
+  }
+
+  fprintf(struct_file, "#if HTTPD_FS_HASH" NEWLINE);
+  fprintf(struct_file, "#define FS_HASH_BUCKETS %d" NEWLINE, buckets);
+  fprintf(struct_file, "#define FS_HASH_SIZE %d" NEWLINE NEWLINE, size);
+  fprintf(struct_file, "static const u16_t fs_hash_disp[FS_HASH_BUCKETS] = {" NEWLINE);
+  for (k = 0; k < buckets; k++) {
+    fprintf(struct_file, "%u," NEWLINE, disp[k]);
+  }
+  fprintf(struct_file, "};" NEWLINE NEWLINE);
+  fprintf(struct_file, "static const struct fsdata_file * const fs_hash_files[FS_HASH_SIZE] = {" NEWLINE);
+  for (k = 0; k < size; k++) {
+    fprintf(struct_file, "file_%s," NEWLINE, (slots[k] >= 0) ? fileVars[slots[k]] : "NULL");
+  }
+  fprintf(struct_file, "};" NEWLINE);
+  fprintf(struct_file, "#endif /* HTTPD_FS_HASH */" NEWLINE NEWLINE);
+  printf("hash index: %d files, %d buckets, %d slots" NEWLINE, fileCount, buckets, size);
+  free(disp);
+  free(slots);
+}
+
+int file_write_http_header(FILE *data_file, const char *filename, int file_size, int encoding,
+                           const char *etag, const char *cache_control,
                            u16_t *http_hdr_len, u16_t *http_hdr_chksum)
 {
   int i = 0;
@@ -466,16 +940,14 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
   int written = 0;
   size_t hdr_len = 0;
   u16_t acc;
-  const char *file_ext;
-  int j;
-  u8_t keepalive = useHttp11;
+  u8_t is_ssi = 0;
 
-  if (keepalive) {
+  if (useHttp11 && supportSsi) {
     size_t loop;
     for (loop = 0; loop < NUM_SHTML_EXTENSIONS; loop++) {
       if (strstr(filename, g_pcSSIExtensions[loop])) {
-        /* no keepalive connection for SSI files */
-        keepalive = 0;
+        /* the length of SSI files is only known after rendering */
+        is_ssi = 1;
       }
     }
   }
@@ -505,7 +977,7 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
   }
   cur_string = g_psHTTPHeaderStrings[response_type];
   cur_len = strlen(cur_string);
-  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, cur_string, cur_len);
+  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, COMMENT(cur_string), cur_len);
   written += file_put_ascii(data_file, cur_string, cur_len, &i);
   i = 0;
   if (precalcChksum) {
@@ -515,7 +987,7 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
 
   cur_string = serverID;
   cur_len = strlen(cur_string);
-  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, cur_string, cur_len);
+  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, COMMENT(cur_string), cur_len);
   written += file_put_ascii(data_file, cur_string, cur_len, &i);
   i = 0;
   if (precalcChksum) {
@@ -523,62 +995,50 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
     hdr_len += cur_len;
   }
 
-  file_ext = filename;
-  while(strstr(file_ext, ".") != NULL) {
-    file_ext = strstr(file_ext, ".");
-    file_ext++;
-  }
-  if((file_ext == NULL) || (*file_ext == 0)) {
-    printf("failed to get extension for file \"%s\", using default.\n", filename);
-  } else {
-    for(j = 0; j < NUM_HTTP_HEADERS; j++) {
-      if(!strcmp(file_ext, g_psHTTPHeaders[j].extension)) {
-        file_type = g_psHTTPHeaders[j].headerIndex;
-        break;
-      }
-    }
-    if (j >= NUM_HTTP_HEADERS) {
-      printf("failed to get file type for extension \"%s\", using default.\n", file_ext);
-      file_type = HTTP_HDR_DEFAULT_TYPE;
-    }
-  }
+  file_type = get_file_type(filename);
 
-  if (useHttp11) {
+  if (useHttp11 && !is_ssi) {
+    /* HTTP/1.1 connections persist unless the client closes them,
+       so no "Connection:" header is needed */
     char intbuf[MAX_PATH_LEN];
-    int content_len = file_size;
     memset(intbuf, 0, sizeof(intbuf));
 
-    if (!keepalive) {
-      content_len *= 2;
+    cur_string = g_psHTTPHeaderStrings[HTTP_HDR_CONTENT_LENGTH];
+    cur_len = strlen(cur_string);
+    fprintf(data_file, NEWLINE "/* \"%s%d" NEWLINE "\" (%d+ bytes) */" NEWLINE, COMMENT(cur_string), file_size, cur_len+2);
+    written += file_put_ascii(data_file, cur_string, cur_len, &i);
+    if (precalcChksum) {
+      memcpy(&hdr_buf[hdr_len], cur_string, cur_len);
+      hdr_len += cur_len;
     }
-    {
-      cur_string = g_psHTTPHeaderStrings[HTTP_HDR_CONTENT_LENGTH];
-      cur_len = strlen(cur_string);
-      fprintf(data_file, NEWLINE "/* \"%s%d\r\n\" (%d+ bytes) */" NEWLINE, cur_string, content_len, cur_len+2);
-      written += file_put_ascii(data_file, cur_string, cur_len, &i);
-      if (precalcChksum) {
-        memcpy(&hdr_buf[hdr_len], cur_string, cur_len);
-        hdr_len += cur_len;
-      }
 
-      _itoa(content_len, intbuf, 10);
-      strcat(intbuf, "\r\n");
-      cur_len = strlen(intbuf);
-      written += file_put_ascii(data_file, intbuf, cur_len, &i);
-      i = 0;
-      if (precalcChksum) {
-        memcpy(&hdr_buf[hdr_len], intbuf, cur_len);
-        hdr_len += cur_len;
-      }
+    sprintf(intbuf, "%d\r\n", file_size);
+    cur_len = strlen(intbuf);
+    written += file_put_ascii(data_file, intbuf, cur_len, &i);
+    i = 0;
+    if (precalcChksum) {
+      memcpy(&hdr_buf[hdr_len], intbuf, cur_len);
+      hdr_len += cur_len;
     }
+  }
 
-    if (keepalive) {
-      cur_string = g_psHTTPHeaderStrings[HTTP_HDR_CONN_KEEPALIVE];
-    } else {
-      cur_string = g_psHTTPHeaderStrings[HTTP_HDR_CONN_CLOSE];
+  if (etag != NULL) {
+    char tagbuf[MAX_PATH_LEN];
+    sprintf(tagbuf, "%s%s\r\n%s", g_psHTTPHeaderStrings[HTTP_HDR_ETAG], etag, cache_control);
+    cur_len = strlen(tagbuf);
+    fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, COMMENT(tagbuf), cur_len);
+    written += file_put_ascii(data_file, tagbuf, cur_len, &i);
+    i = 0;
+    if (precalcChksum) {
+      memcpy(&hdr_buf[hdr_len], tagbuf, cur_len);
+      hdr_len += cur_len;
     }
+  }
+
+  if (encoding != ENCODING_NONE) {
+    cur_string = g_psHTTPHeaderStrings[encoding == ENCODING_GZIP ? HTTP_HDR_GZIP : HTTP_HDR_VARY];
     cur_len = strlen(cur_string);
-    fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, cur_string, cur_len);
+    fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, COMMENT(cur_string), cur_len);
     written += file_put_ascii(data_file, cur_string, cur_len, &i);
     i = 0;
     if (precalcChksum) {
@@ -589,7 +1049,7 @@ int file_write_http_header(FILE *data_file, const char *filename, int file_size,
 
   cur_string = g_psHTTPHeaderStrings[file_type];
   cur_len = strlen(cur_string);
-  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, cur_string, cur_len);
+  fprintf(data_file, NEWLINE "/* \"%s\" (%d bytes) */" NEWLINE, COMMENT(cur_string), cur_len);
   written += file_put_ascii(data_file, cur_string, cur_len, &i);
   i = 0;
   if (precalcChksum) {
@@ -29,6 +29,7 @@
 #include "Interrupts.h"
 #include "usb_core.h"
 #include "usbd_core.h"
+#include "probe.h"
 
 extern USB_OTG_CORE_HANDLE           USB_OTG_dev;
 extern uint32_t USBD_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev);
@@ -116,7 +117,9 @@ void OTG_FS_WKUP_IRQHandler(void)
 
 void OTG_FS_IRQHandler(void)
 {
+  PROBE_BEGIN(PROBE_USB_ISR);
   USBD_OTG_ISR_Handler(&USB_OTG_dev);
+  PROBE_END(PROBE_USB_ISR);
 }
 
 void EXTI0_IRQHandler(void)
@@ -29,6 +29,7 @@
 
 #include "dhserver.h"
 #include "dnserver.h"
+#include "mdserver.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include "usbd_rndis_core.h"
@@ -52,6 +53,13 @@
 #include "lwip/tcp.h"
 #include "time.h"
 #include "httpd.h"
+#include "fs.h"
+#include "probe.h"
+#include "prof.h"
+#include "trace.h"
+#include "lease_store.h"
+#include "captive.h"
+#include "latency.h"
 
 __ALIGN_BEGIN
 USB_OTG_CORE_HANDLE USB_OTG_dev
@@ -68,25 +76,72 @@ static uint8_t gateway[4] = {0, 0, 0, 0};
 #define LED_BLUE   LED6
 #define LINK_LED   LED_BLUE
 
-#define NUM_DHCP_ENTRY 3
+#define NUM_DHCP_LEASE 16
 
-static dhcp_entry_t entries[NUM_DHCP_ENTRY] =
+/* No default gateway: the host keeps its internet route and reaches
+ * only the device subnet over usb. */
+static dhcp_pool_t pools[] =
 {
-    /* mac    ip address        subnet mask        lease time */
-    { {0}, {192, 168, 7, 2}, {255, 255, 255, 0}, 24 * 60 * 60 },
-    { {0}, {192, 168, 7, 3}, {255, 255, 255, 0}, 24 * 60 * 60 },
-    { {0}, {192, 168, 7, 4}, {255, 255, 255, 0}, 24 * 60 * 60 }
+    {
+        {192, 168, 7, 2}, NUM_DHCP_LEASE, /* first address, size */
+        {255, 255, 255, 0},               /* subnet mask */
+        24 * 60 * 60,                     /* lease time */
+        {0, 0, 0, 0},                     /* router */
+        RNDIS_MTU,                        /* mtu */
+        0, NULL                           /* classless static routes */
+    }
 };
 
+static dhcp_lease_t leases[NUM_DHCP_LEASE];
+
 static dhcp_config_t dhcp_config =
 {
     {192, 168, 7, 1}, 67, /* server address, port */
     {192, 168, 7, 1},     /* dns server */
     "stm",                /* dns suffix */
-    NUM_DHCP_ENTRY,       /* num entry */
-    entries               /* entries */
+    sizeof(pools) / sizeof(pools[0]), pools, /* address pools */
+    NUM_DHCP_LEASE, leases,                  /* lease table */
+    lease_store_save                         /* leases survive restarts */
+};
+
+/* sorted by name */
+static const dns_record_t dns_records[] =
+{
+    /* name                      type          A address         target     port */
+    { "1.7.168.192.in-addr.arpa", DNS_TYPE_PTR, {0},              "run.stm"     },
+    { "_http._tcp.stm",           DNS_TYPE_SRV, {0},              "run.stm", 80 },
+    { "dns.msftncsi.com",         DNS_TYPE_A,   {131, 107, 255, 255}, NULL      }, /* windows ncsi */
+    { "run.stm",                  DNS_TYPE_A,   {192, 168, 7, 1}, NULL          },
+    { "run.stm",                  DNS_TYPE_TXT, {0},              "path=/"      },
+    { "www.run.stm",              DNS_TYPE_A,   {192, 168, 7, 1}, NULL          }
+};
+
+static const dns_zone_t dns_zone =
+{
+    "stm", "7.168.192.in-addr.arpa", /* forward and reverse zones */
+    DNS_DEFAULT_TTL, 60,             /* ttl of answers and negative answers */
+    sizeof(dns_records) / sizeof(dns_records[0]), dns_records
+};
+
+/* "rndis-xxxxxx.local", unique per board to tell several boards apart */
+static char mdns_host[16];
+static char mdns_instance[24];
+
+static const mdns_config_t mdns_config =
+{
+    mdns_host,     /* host name */
+    mdns_instance, /* http service instance */
+    80, "path=/"   /* http port, txt */
 };
 
+void init_mdns_names(void)
+{
+    const uint32_t *uid = (const uint32_t *)0x1FFF7A10; /* 96-bit unique device id */
+    unsigned id = (uid[0] ^ uid[1] ^ uid[2]) & 0xFFFFFF;
+    sprintf(mdns_host, "rndis-%06x", id);
+    sprintf(mdns_instance, "STM32 RNDIS %06x", id);
+}
+
 struct netif netif_data;
 
 uint32_t sys_now()
@@ -99,6 +154,8 @@ static int recvSize = 0;
 
 void on_packet(const char *data, int size)
 {
+    if (recvSize != 0)
+        TRACE(TR_RX_OVERRUN, recvSize, size);
     memcpy(received, data, size);
     recvSize = size;
 }
@@ -113,6 +170,11 @@ TIMER_PROC(tcp_timer, TCP_TMR_INTERVAL * 1000, 1, NULL)
     tcp_tmr();
 }
 
+TIMER_PROC(igmp_timer, IGMP_TMR_INTERVAL * 1000, 1, NULL)
+{
+    igmp_tmr();
+}
+
 void usb_polling()
 {
     struct pbuf *frame;
@@ -122,21 +184,30 @@ void usb_polling()
         __enable_irq();
         return;
     }
+    PROBE_BEGIN(PROBE_USB_POLL);
     frame = pbuf_alloc(PBUF_RAW, recvSize, PBUF_POOL);
     if (frame == NULL) 
     {
+        TRACE(TR_RX_NOMEM, recvSize, 0);
         __enable_irq();
+        PROBE_END(PROBE_USB_POLL);
         return;
     }
     memcpy(frame->payload, received, recvSize);
     frame->len = recvSize;
+    TRACE(TR_USB_POLL, recvSize, 0);
+    LAT_DEQUEUE();
     recvSize = 0;
     __enable_irq();
+    PROBE_BEGIN(PROBE_ETH_INPUT);
     ethernet_input(frame, &netif_data);
+    PROBE_END(PROBE_ETH_INPUT);
+    LAT_END();
     pbuf_free(frame);
 
     STM_EVAL_LEDOn(LINK_LED);
     stmr_run(&link_led_off);
+    PROBE_END(PROBE_USB_POLL);
 }
 
 static int outputs = 0;
@@ -152,6 +223,7 @@ err_t linkoutput_fn(struct netif *netif, struct pbuf *p)
     struct pbuf *q;
     static char data[RNDIS_MTU + 14 + 4];
     int size = 0;
+    PROBE_BEGIN(PROBE_LINKOUTPUT);
     for (i = 0; i < 200; i++)
     {
         if (rndis_can_send()) break;
@@ -160,14 +232,24 @@ err_t linkoutput_fn(struct netif *netif, struct pbuf *p)
     for(q = p; q != NULL; q = q->next)
     {
         if (size + q->len > RNDIS_MTU + 14)
+        {
+            PROBE_END(PROBE_LINKOUTPUT);
             return ERR_ARG;
+        }
         memcpy(data + size, (char *)q->payload, q->len);
         size += q->len;
     }
     if (!rndis_can_send())
+    {
+        TRACE(TR_LINK_BUSY, size, 0);
+        PROBE_END(PROBE_LINKOUTPUT);
         return ERR_USE;
+    }
+    TRACE(TR_LINKOUTPUT, size, i);
+    LAT_TX();
     rndis_send(data, size);
     outputs++;
+    PROBE_END(PROBE_LINKOUTPUT);
     return ERR_OK;
 }
 
@@ -175,7 +257,7 @@ err_t netif_init_cb(struct netif *netif)
 {
     LWIP_ASSERT("netif != NULL", (netif != NULL));
     netif->mtu = RNDIS_MTU;
-    netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP | NETIF_FLAG_UP;
+    netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_IGMP | NETIF_FLAG_LINK_UP | NETIF_FLAG_UP;
     netif->state = NULL;
     netif->name[0] = 'E';
     netif->name[1] = 'X';
@@ -198,6 +280,7 @@ void init_lwip()
     netif_set_default(netif);
 
     stmr_add(&tcp_timer);
+    stmr_add(&igmp_timer);
     stmr_add(&link_led_off);
 }
 
@@ -206,13 +289,16 @@ void init_periph(void)
     static LIS302DL_InitTypeDef accInit =
     {
         LIS302DL_LOWPOWERMODE_ACTIVE,
-        LIS302DL_DATARATE_100,
+        LIS302DL_DATARATE_400,
         LIS302DL_XYZ_ENABLE,
         LIS302DL_FULLSCALE_2_3,
         LIS302DL_SELFTEST_NORMAL
     };
 
     time_init();
+    probe_init();
+    trace_init();
+    prof_init(PROF_RATE);
     USBD_Init(&USB_OTG_dev, USB_OTG_FS_CORE_ID, &USR_desc, &usbd_rndis_cb, &USR_cb);
     rndis_rxproc = on_packet;
     STM_EVAL_PBInit(BUTTON_USER, BUTTON_MODE_GPIO);
@@ -223,16 +309,6 @@ void init_periph(void)
     LIS302DL_Init(&accInit);
 }
 
-bool dns_query_proc(const char *name, ip_addr_t *addr)
-{
-    if (strcmp(name, "run.stm") == 0 || strcmp(name, "www.run.stm") == 0)
-    {
-        addr->addr = *(uint32_t *)ipaddr;
-        return true;
-    }
-    return false;
-}
-
 const char *state_cgi_handler(int index, int n_params, char *params[], char *values[])
 {
     return "/state.shtml";
@@ -242,16 +318,261 @@ bool led_g = false;
 bool led_o = false;
 bool led_r = false;
 
-const char *ctl_cgi_handler(int index, int n_params, char *params[], char *values[])
+/* accelerometer samples at the full rate of the LIS302DL (400 Hz), taken
+ * while clients of /ws (websocket) stream them or pages wait for them */
+
+#define ACC_RING        512  /* samples, a power of two */
+#define ACC_POLL        1000 /* us, polling of the data ready flag */
+#define ACC_WAITERS     4    /* pages waiting for a sample */
+#define ACC_FRESH       10   /* ms, age of a sample still good for a page */
+
+static int16_t acc_ring[ACC_RING][3]; /* x, y, z in mg */
+static uint32_t acc_head;             /* samples taken */
+static int64_t acc_time;              /* time of the last sample */
+static int acc_users;                 /* websocket clients and waiting pages */
+
+/* continue callbacks of the pages waiting for a sample (httpd_get_continue) */
+static fs_wait_cb acc_wait_fn[ACC_WAITERS];
+static void *acc_wait_arg[ACC_WAITERS];
+static int acc_waiting;
+
+TIMER_PROC(acc_sample, ACC_POLL, 0, NULL)
+{
+    uint8_t status;
+    int32_t acc[3];
+    int16_t *s;
+    fs_wait_cb fn[ACC_WAITERS];
+    void *arg[ACC_WAITERS];
+    int i, n;
+
+    LIS302DL_Read(&status, LIS302DL_STATUS_REG_ADDR, 1);
+    if ((status & 0x08) == 0) return; /* ZYXDA: no new sample */
+    LIS302DL_ReadACC(acc);
+    s = acc_ring[acc_head & (ACC_RING - 1)];
+    s[0] = (int16_t)acc[0];
+    s[1] = (int16_t)acc[1];
+    s[2] = (int16_t)acc[2];
+    acc_head++;
+    acc_time = mtime();
+
+    /* resume the pages, they take the sample now */
+    n = acc_waiting;
+    if (n == 0) return;
+    memcpy(fn, acc_wait_fn, n * sizeof(fn[0]));
+    memcpy(arg, acc_wait_arg, n * sizeof(arg[0]));
+    acc_waiting = 0;
+    acc_users -= n;
+    if (acc_users == 0)
+        stmr_stop(tmr);
+    for (i = 0; i < n; i++)
+        fn[i](arg[i]);
+}
+
+static void acc_start(void)
+{
+    if (acc_users++ == 0)
+        stmr_run(&acc_sample);
+}
+
+static void acc_stop(void)
+{
+    if (--acc_users == 0)
+        stmr_stop(&acc_sample);
+}
+
+/* while sampling, reading the sensor would take a sample from the ring */
+static void acc_read(int32_t *acc)
+{
+    int16_t *s;
+
+    if ((acc_sample.flags & STMR_ACTIVE) == 0 || acc_head == 0)
+    {
+        LIS302DL_ReadACC(acc);
+        return;
+    }
+    s = acc_ring[(acc_head - 1) & (ACC_RING - 1)];
+    acc[0] = s[0];
+    acc[1] = s[1];
+    acc[2] = s[2];
+}
+
+/* the SSI insert of a page takes a recent sample or waits for the next one,
+ * so the sensor is not read in the receive callback of httpd */
+static bool acc_recent(int32_t *acc)
+{
+    int16_t *s;
+
+    if (acc_head == 0 || mtime() - acc_time > ACC_FRESH) return false;
+    s = acc_ring[(acc_head - 1) & (ACC_RING - 1)];
+    acc[0] = s[0];
+    acc[1] = s[1];
+    acc[2] = s[2];
+    return true;
+}
+
+static bool acc_wait(void)
+{
+    if (acc_waiting == ACC_WAITERS) return false;
+    httpd_get_continue(&acc_wait_fn[acc_waiting], &acc_wait_arg[acc_waiting]);
+    acc_waiting++;
+    acc_start();
+    return true;
+}
+
+/* state pushed to the clients of /events (server-sent events) every
+ * state_period ms and as soon as the button, a led or the accelerometer
+ * changes */
+
+#define STATE_PERIOD    1000 /* ms, default period, ctl.cgi?period=<ms> */
+#define STATE_SAMPLE    50   /* ms, sampling of the button and the accelerometer */
+#define STATE_ACC_DELTA 90   /* mg, accelerometer change sent at once */
+
+static int state_period = STATE_PERIOD;
+static int64_t state_sent;     /* time of the last event */
+static int state_btn;          /* button and accelerometer of the last event */
+static int32_t state_acc[3];
+
+static u16_t state_event(char *buf, u16_t size)
+{
+    int res;
+
+    res = snprintf(buf, size,
+        "{\"systick\":%u,\"button\":%i,\"acc\":[%i,%i,%i],\"leds\":{\"g\":%i,\"o\":%i,\"r\":%i}}",
+        (unsigned)mtime(), state_btn, state_acc[0], state_acc[1], state_acc[2], led_g, led_o, led_r);
+    if (res < 0 || res >= size) return 0;
+    return res;
+}
+
+static void state_notify(void)
+{
+    state_sent = mtime();
+    httpd_sse_notify();
+}
+
+TIMER_PROC(state_watch, STATE_SAMPLE * 1000, 1, NULL)
+{
+    int32_t acc[3];
+    int i, btn;
+    bool changed;
+
+    /* the accelerometer is read only while somebody listens */
+    if (!httpd_sse_subscribed()) return;
+
+    btn = STM_EVAL_PBGetState(BUTTON_USER) & 1;
+    acc_read(acc);
+    changed = btn != state_btn;
+    for (i = 0; i < 3; i++)
+        if (abs(acc[i] - state_acc[i]) >= STATE_ACC_DELTA)
+            changed = true;
+
+    if (changed || mtime() - state_sent >= state_period)
+    {
+        state_btn = btn;
+        memcpy(state_acc, acc, sizeof(acc));
+        state_notify();
+    }
+}
+
+/* history of the state, one record per HIST_PERIOD ms, sent as /history.json
+ * chunk by chunk: the response is much longer than the heap of lwip */
+
+#define HIST_LEN    256        /* records, power of 2 */
+#define HIST_PERIOD 1000       /* ms */
+#define HIST_END    0xffffffff /* cursor after the closing bracket */
+
+typedef struct
+{
+    uint32_t time;
+    int16_t acc[3];
+    uint8_t btn;
+    uint8_t leds; /* bit 0: g, 1: o, 2: r */
+} hist_rec_t;
+
+static hist_rec_t hist[HIST_LEN];
+static uint32_t hist_count; /* records taken since the start */
+
+TIMER_PROC(hist_sample, HIST_PERIOD * 1000, 1, NULL)
 {
+    hist_rec_t *r;
+    int32_t acc[3];
     int i;
-    for (i = 0; i < n_params; i++)
+
+    acc_read(acc);
+    r = &hist[hist_count & (HIST_LEN - 1)];
+    r->time = (uint32_t)mtime();
+    for (i = 0; i < 3; i++)
+        r->acc[i] = (int16_t)acc[i];
+    r->btn = STM_EVAL_PBGetState(BUTTON_USER) & 1;
+    r->leds = (led_g ? 1 : 0) | (led_o ? 2 : 0) | (led_r ? 4 : 0);
+    hist_count++;
+}
+
+/* the cursor is 0 before the opening bracket, then the number of the next
+ * record + 1; records overwritten while sending are skipped */
+static u16_t hist_json(u32_t *cursor, char *buf, u16_t size)
+{
+    const hist_rec_t *r;
+    uint32_t i, first;
+    int len, res;
+
+    if (*cursor == HIST_END) return 0;
+    first = hist_count > HIST_LEN ? hist_count - HIST_LEN : 0;
+    len = 0;
+    if (*cursor == 0)
     {
-        if (strcmp(params[i], "g") == 0) led_g = *values[i] == '1';
-        if (strcmp(params[i], "o") == 0) led_o = *values[i] == '1';
-        if (strcmp(params[i], "r") == 0) led_r = *values[i] == '1';
+        buf[len++] = '[';
+        i = first;
     }
+    else
+    {
+        i = *cursor - 1;
+        if (i < first) i = first;
+    }
+    for (; i < hist_count; i++)
+    {
+        r = &hist[i & (HIST_LEN - 1)];
+        res = snprintf(buf + len, size - len,
+            "%s{\"systick\":%u,\"button\":%i,\"acc\":[%i,%i,%i],\"leds\":{\"g\":%i,\"o\":%i,\"r\":%i}}",
+            i == first && *cursor == 0 ? "" : ",", (unsigned)r->time, r->btn,
+            r->acc[0], r->acc[1], r->acc[2], r->leds & 1, (r->leds >> 1) & 1, (r->leds >> 2) & 1);
+        if (res < 0 || res >= size - len)
+        {
+            *cursor = i + 1;
+            return len;
+        }
+        len += res;
+    }
+    /* snprintf left room for the bracket */
+    buf[len++] = ']';
+    *cursor = HIST_END;
+    return len;
+}
+
+/* report of the probes, as long as their histograms need */
+
+#if LWIP_HTTPD_CHUNK_SIZE < PROBE_JSON_PART_MIN
+#error "LWIP_HTTPD_CHUNK_SIZE is too small for a probe of /probes.json"
+#endif
 
+static u16_t probes_json(u32_t *cursor, char *buf, u16_t size)
+{
+    uint32_t part;
+    int len;
+
+    part = *cursor;
+    len = probe_json_part(&part, buf, size);
+    *cursor = part;
+    return len;
+}
+
+static const tChunked chunked_table[] =
+{
+    { "/history.json", "application/json", hist_json },
+    { "/probes.json",  "application/json", probes_json },
+};
+
+static void leds_update(void)
+{
     if (led_g)
         STM_EVAL_LEDOn(LED_GREEN); else
         STM_EVAL_LEDOff(LED_GREEN);
@@ -261,10 +582,156 @@ const char *ctl_cgi_handler(int index, int n_params, char *params[], char *value
     if (led_r)
         STM_EVAL_LEDOn(LED_RED); else
         STM_EVAL_LEDOff(LED_RED);
+    httpd_cache_invalidate("/state.shtml");
+    state_notify();
+}
+
+const char *ctl_cgi_handler(int index, int n_params, char *params[], char *values[])
+{
+    int i;
+    for (i = 0; i < n_params; i++)
+    {
+        if (strcmp(params[i], "g") == 0) led_g = *values[i] == '1';
+        if (strcmp(params[i], "o") == 0) led_o = *values[i] == '1';
+        if (strcmp(params[i], "r") == 0) led_r = *values[i] == '1';
+        if (strcmp(params[i], "period") == 0 && atoi(values[i]) > 0) state_period = atoi(values[i]);
+    }
+    leds_update();
 
     return "/state.shtml";
 }
 
+/* websocket /ws: binary messages of samples from the ring (x, y, z int16
+ * little endian) to each client, "g=1&o=0&r=1" text messages set the leds */
+
+#define WS_CLIENTS      4
+#define WS_BATCH        25000 /* us, period of the messages (10 samples) */
+
+typedef struct
+{
+    void    *conn;
+    uint32_t pos; /* next sample to send */
+} ws_client_t;
+
+static ws_client_t ws_clients[WS_CLIENTS];
+static int ws_count;
+
+static void ws_send_samples(ws_client_t *c)
+{
+    uint32_t avail, n, i, room;
+
+    avail = acc_head - c->pos;
+    if (avail > ACC_RING)
+    {
+        /* too slow: the oldest samples are gone */
+        c->pos = acc_head - ACC_RING;
+        avail = ACC_RING;
+    }
+    /* up to two messages when the samples wrap around the ring */
+    while (avail > 0)
+    {
+        i = c->pos & (ACC_RING - 1);
+        n = ACC_RING - i;
+        if (n > avail) n = avail;
+        room = httpd_ws_sndbuf(c->conn) / sizeof(acc_ring[0]);
+        if (n > room) n = room;
+        if (n == 0) break;
+        if (httpd_ws_send(c->conn, HTTPD_WS_BINARY, acc_ring[i], (u16_t)(n * sizeof(acc_ring[0]))) != ERR_OK) break;
+        c->pos += n;
+        avail -= n;
+    }
+}
+
+TIMER_PROC(ws_stream, WS_BATCH, 0, NULL)
+{
+    int i;
+    for (i = 0; i < WS_CLIENTS; i++)
+        if (ws_clients[i].conn != NULL)
+            ws_send_samples(&ws_clients[i]);
+}
+
+static err_t ws_open(void *conn)
+{
+    int i;
+    for (i = 0; i < WS_CLIENTS; i++)
+        if (ws_clients[i].conn == NULL) break;
+    if (i == WS_CLIENTS)
+        return ERR_MEM;
+    ws_clients[i].conn = conn;
+    ws_clients[i].pos = acc_head;
+    acc_start();
+    if (ws_count++ == 0)
+        stmr_run(&ws_stream);
+    return ERR_OK;
+}
+
+static void ws_recv(void *conn, u8_t opcode, const u8_t *data, u16_t len)
+{
+    u16_t i;
+
+    if (opcode != HTTPD_WS_TEXT) return;
+    /* "x=v" pairs separated by '&' */
+    for (i = 0; i + 2 < len; i += 4)
+    {
+        if (data[i + 1] != '=') break;
+        if (data[i] == 'g') led_g = data[i + 2] == '1';
+        if (data[i] == 'o') led_o = data[i + 2] == '1';
+        if (data[i] == 'r') led_r = data[i + 2] == '1';
+    }
+    leds_update();
+}
+
+static void ws_close(void *conn)
+{
+    int i;
+    for (i = 0; i < WS_CLIENTS; i++)
+        if (ws_clients[i].conn == conn)
+        {
+            ws_clients[i].conn = NULL;
+            acc_stop();
+            if (--ws_count == 0)
+                stmr_stop(&ws_stream);
+        }
+}
+
+static const tWSHandler ws_handler =
+{
+    "/ws", ws_open, ws_recv, ws_close
+};
+
+const char *probes_cgi_handler(int index, int n_params, char *params[], char *values[])
+{
+    int i;
+    for (i = 0; i < n_params; i++)
+        if (strcmp(params[i], "reset") == 0)
+            probe_reset();
+    return "/probes.json";
+}
+
+const char *captive_cgi_handler(int index, int n_params, char *params[], char *values[])
+{
+    int i;
+    for (i = 0; i < n_params; i++)
+    {
+        if (strcmp(params[i], "mode") != 0) continue;
+        if (strcmp(values[i], "off") == 0) captive_set_mode(CAPTIVE_OFF);
+        if (strcmp(values[i], "online") == 0) captive_set_mode(CAPTIVE_ONLINE);
+        if (strcmp(values[i], "portal") == 0) captive_set_mode(CAPTIVE_PORTAL);
+    }
+    return "/index.html";
+}
+
+const char *prof_cgi_handler(int index, int n_params, char *params[], char *values[])
+{
+    int i;
+    for (i = 0; i < n_params; i++)
+    {
+        if (strcmp(params[i], "rate") == 0) prof_init(atoi(values[i]));
+        if (strcmp(params[i], "reset") == 0) prof_reset();
+    }
+    return "/prof";
+}
+
 static const char *ssi_tags_table[] =
 {
     "systick", /* 0 */
@@ -279,8 +746,79 @@ static const tCGI cgi_uri_table[] =
 {
     { "/state.cgi", state_cgi_handler },
     { "/ctl.cgi",   ctl_cgi_handler },
+    { "/probes.cgi", probes_cgi_handler },
+    { "/prof.cgi",   prof_cgi_handler },
+    { "/captive.cgi", captive_cgi_handler },
+};
+
+/* state.shtml polled by every open dashboard is rendered at most once per
+ * STATE_CACHE_TTL ms, a led change renders it again at once */
+
+#define STATE_CACHE_TTL 50 /* ms */
+
+static const tCacheRule cache_rules[] =
+{
+    { "/state.shtml", STATE_CACHE_TTL },
 };
 
+/* static images with http header, served without copying */
+
+typedef struct
+{
+    const char *name;                 /* uri */
+    const char *(*open)(int *len);    /* returns the image */
+    void (*close)(void);
+} image_file_t;
+
+static const image_file_t image_files[] =
+{
+    { "/prof",  prof_open,  prof_close },
+    { "/trace", trace_open, trace_close },
+};
+
+#define NUM_IMAGE_FILES (sizeof(image_files) / sizeof(image_file_t))
+
+static const char *image_data[NUM_IMAGE_FILES]; /* image of each opened file */
+
+int fs_open_custom(struct fs_file *file, const char *name)
+{
+    int i;
+
+    /* os connectivity probes, static */
+    file->data = captive_open(name, &file->len);
+    if (file->data != NULL)
+    {
+        file->index = file->len;
+        file->pextension = NULL;
+        file->http_header_included = 1;
+        return 1;
+    }
+
+    for (i = 0; i < NUM_IMAGE_FILES; i++)
+    {
+        if (strcmp(name, image_files[i].name) != 0) continue;
+        image_data[i] = image_files[i].open(&file->len);
+        if (image_data[i] == NULL)
+            return 0;
+        file->data = image_data[i];
+        file->index = file->len;
+        file->pextension = NULL;
+        file->http_header_included = 1;
+        return 1;
+    }
+
+    return 0;
+}
+
+void fs_close_custom(struct fs_file *file)
+{
+    int i;
+
+    for (i = 0; i < NUM_IMAGE_FILES; i++)
+        if (file->data == image_data[i])
+            image_files[i].close();
+}
+
 static u16_t ssi_handler(int index, char *insert, int ins_len)
 {
     int res;
@@ -298,7 +836,11 @@ static u16_t ssi_handler(int index, char *insert, int ins_len)
     case 2: /* acc */
     {
         int32_t acc[3];
-        LIS302DL_ReadACC(acc);
+        if (!acc_recent(acc))
+        {
+            if (acc_wait()) return HTTPD_SSI_PENDING;
+            acc_read(acc); /* too many pages waiting */
+        }
         res = snprintf(insert, ins_len, "%i, %i, %i", acc[0], acc[1], acc[2]);
         break;
     }
@@ -328,12 +870,27 @@ int main(void)
     while (!netif_is_up(&netif_data)) ;
 
     while (dhserv_init(&dhcp_config) != ERR_OK) ;
+    lease_store_init(&dhcp_config);
+
+    while (dnserv_init(PADDR(ipaddr), 53, &dns_zone) != ERR_OK) ;
+    captive_init(ipaddr, CAPTIVE_DEFAULT_MODE);
+
+    init_mdns_names();
+    while (mdserv_init(&netif_data, &mdns_config) != ERR_OK) ;
 
-    while (dnserv_init(PADDR(ipaddr), 53, dns_query_proc) != ERR_OK) ;
+    while (trace_udp_init(TRACE_UDP_PORT) != ERR_OK) ;
 
     http_set_cgi_handlers(cgi_uri_table, sizeof(cgi_uri_table) / sizeof(tCGI));
     http_set_ssi_handler(ssi_handler, ssi_tags_table, sizeof(ssi_tags_table) / sizeof(char *));
+    http_set_cache_rules(cache_rules, sizeof(cache_rules) / sizeof(tCacheRule));
+    http_set_sse_handler("/events", state_event);
+    http_set_ws_handler(&ws_handler);
+    http_set_chunked_handlers(chunked_table, sizeof(chunked_table) / sizeof(tChunked));
     httpd_init();
+    stmr_add(&state_watch);
+    stmr_add(&acc_sample);
+    stmr_add(&ws_stream);
+    stmr_add(&hist_sample);
 
     while (1)
     {
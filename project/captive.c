@@ -0,0 +1,122 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "captive.h"
+#include "dnserver.h"
+#include <string.h>
+
+#define HTTP_PROBE_HEADER(status, type) \
+	"HTTP/1.0 " status "\r\n" \
+	"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n" \
+	"Content-type: " type "\r\n" \
+	"Cache-Control: no-cache\r\n" \
+	"\r\n"
+
+#define HTTP_TEXT(body) HTTP_PROBE_HEADER("200 OK", "text/plain") body
+#define HTTP_HTML(body) HTTP_PROBE_HEADER("200 OK", "text/html") body
+
+#define APPLE_SUCCESS "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>"
+
+static const char http_no_content[] =
+	"HTTP/1.1 204 No Content\r\n"
+	"Content-Length: 0\r\n"
+	"\r\n";
+
+static const char http_redirect[] =
+	"HTTP/1.1 302 Found\r\n"
+	"Location: " CAPTIVE_URL "\r\n"
+	"Cache-Control: no-cache\r\n"
+	"Content-Length: 0\r\n"
+	"\r\n";
+
+typedef struct
+{
+	const char *uri;
+	const char *response; /* CAPTIVE_ONLINE answer */
+} probe_file_t;
+
+/* sorted by uri */
+static const probe_file_t probe_files[] =
+{
+	{ "/canonical.html",            HTTP_HTML("<meta http-equiv=\"refresh\" content=\"0;url=https://support.mozilla.org/kb/captive-portal\"/>") },
+	{ "/check_network_status.txt",  HTTP_TEXT("NetworkManager is online\n") },
+	{ "/connecttest.txt",           HTTP_TEXT("Microsoft Connect Test") },
+	{ "/gen_204",                   http_no_content },
+	{ "/generate_204",              http_no_content },
+	{ "/hotspot-detect.html",       HTTP_HTML(APPLE_SUCCESS) },
+	{ "/library/test/success.html", HTTP_HTML(APPLE_SUCCESS) },
+	{ "/ncsi.txt",                  HTTP_TEXT("Microsoft NCSI") },
+	{ "/success.txt",               HTTP_TEXT("success\n") }
+};
+
+#define NUM_PROBE_FILES (sizeof(probe_files) / sizeof(probe_file_t))
+
+static captive_mode_t mode = CAPTIVE_OFF;
+static uint8_t device_addr[4];
+
+void captive_init(const uint8_t *addr, captive_mode_t m)
+{
+	memcpy(device_addr, addr, 4);
+	captive_set_mode(m);
+}
+
+void captive_set_mode(captive_mode_t m)
+{
+	mode = m;
+	dnserv_set_wildcard(mode == CAPTIVE_OFF ? NULL : device_addr);
+}
+
+captive_mode_t captive_mode(void)
+{
+	return mode;
+}
+
+const char *captive_open(const char *uri, int *len)
+{
+	int lo, hi, mid, cmp;
+	const char *res;
+
+	if (mode == CAPTIVE_OFF) return NULL;
+	lo = 0;
+	hi = NUM_PROBE_FILES;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		cmp = strcmp(uri, probe_files[mid].uri);
+		if (cmp == 0)
+		{
+			res = mode == CAPTIVE_PORTAL ? http_redirect : probe_files[mid].response;
+			*len = strlen(res);
+			return res;
+		}
+		if (cmp < 0)
+			hi = mid; else
+			lo = mid + 1;
+	}
+	return NULL;
+}
@@ -0,0 +1,63 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   captive portal: wildcard dns and os connectivity probes
+ */
+
+#ifndef CAPTIVE_H
+#define CAPTIVE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+	CAPTIVE_OFF,    /* unknown names are refused, probes get 404 */
+	CAPTIVE_ONLINE, /* probes get the expected answers, the host reports the link ready */
+	CAPTIVE_PORTAL  /* probes are redirected to the device, the host opens its ui */
+} captive_mode_t;
+
+#ifndef CAPTIVE_DEFAULT_MODE
+#define CAPTIVE_DEFAULT_MODE CAPTIVE_ONLINE
+#endif
+
+#ifndef CAPTIVE_URL
+#define CAPTIVE_URL "http://run.stm/"
+#endif
+
+void captive_init(const uint8_t *addr, captive_mode_t mode); /* addr: wildcard dns answer */
+void captive_set_mode(captive_mode_t mode);
+captive_mode_t captive_mode(void);
+const char *captive_open(const char *uri, int *len); /* complete http response of a probe or NULL */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
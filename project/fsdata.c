@@ -6,16 +6,216 @@
 #define file_NULL (struct fsdata_file *) NULL
 
 
-static const unsigned int dummy_align__img_discovery_svg = 0;
+#if HTTPD_FS_ETAG
+static const char etag__img_discovery_svg__gz[] = "\"f8c0d0dd-885\"";
+static const char not_modified__img_discovery_svg__gz[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"f8c0d0dd-885\"\r\n"
+"Cache-Control: max-age=3600\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__img_discovery_svg__gz = 0;
+static const unsigned char data__img_discovery_svg__gz[] = {
+/* /img/discovery.svg (19 chars) */
+0x2f,0x69,0x6d,0x67,0x2f,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x79,0x2e,0x73,
+0x76,0x67,0x00,0x00,
+
+/* HTTP header */
+/* "HTTP/1.1 200 OK
+" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+" (63 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
+0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
+0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
+0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 2181
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x31,0x38,0x31,0x0d,0x0a,
+/* "ETag: "f8c0d0dd-885"
+Cache-Control: max-age=3600
+" (51 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x66,0x38,0x63,0x30,0x64,0x30,0x64,0x64,0x2d,
+0x38,0x38,0x35,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,
+0x72,0x6f,0x6c,0x3a,0x20,0x6d,0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x33,0x36,0x30,
+0x30,0x0d,0x0a,
+/* "Content-Encoding: gzip
+Vary: Accept-Encoding
+" (47 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,
+0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-type: image/svg+xml
+
+" (31 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
+0x61,0x67,0x65,0x2f,0x73,0x76,0x67,0x2b,0x78,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (2181 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xcd,0x59,0xdb,0x6e,0xdb,0x38,
+0x10,0x7d,0xef,0x57,0x08,0x0a,0x16,0x68,0x1f,0x44,0xf3,0x4e,0xd2,0x69,0x02,0x6c,
+0xb1,0x97,0x97,0x5d,0xec,0x62,0xdb,0x7e,0x80,0x2c,0xd1,0xb6,0x50,0x59,0x0a,0x64,
+0x35,0x4e,0xfa,0xf5,0x3b,0xa3,0x8b,0x65,0xc7,0x97,0x28,0x4e,0x0b,0x34,0x42,0x1c,
+0x85,0xa2,0xe6,0xcc,0x1c,0xce,0x8d,0xf4,0xfb,0xf5,0xfd,0x22,0x78,0x58,0xe5,0xc5,
+0x7a,0x5a,0xa5,0xf3,0x9b,0x70,0x59,0xd7,0x77,0xd3,0xc9,0x64,0xb3,0xd9,0x90,0x8d,
+0x20,0x65,0xb5,0x98,0x30,0xe7,0xdc,0x84,0xf2,0x09,0xe7,0x11,0xcc,0x88,0xd6,0x8f,
+0x45,0x1d,0x3f,0x44,0xc5,0xfa,0x2a,0x6c,0xdf,0x3b,0xf6,0x0e,0xa7,0x94,0x4e,0x40,
+0x72,0x18,0x2c,0x7d,0xb6,0x58,0xd6,0x37,0x21,0x77,0x66,0xb5,0x0a,0x83,0x4d,0x96,
+0xd6,0x4b,0xf8,0x8f,0x51,0xfc,0xef,0xde,0x57,0xeb,0xac,0x2c,0x6e,0x42,0x46,0x58,
+0x18,0xf8,0x22,0x9e,0xe5,0x3e,0x9a,0xc5,0xc9,0x97,0x45,0x55,0x7e,0x2d,0xd2,0x9b,
+0xb0,0xf0,0x9b,0x0e,0x65,0x9a,0x24,0x5b,0xa0,0xa4,0xf2,0x71,0x9d,0xdd,0xfb,0xa4,
+0x5c,0xad,0xca,0x62,0xdd,0x20,0x0e,0xfa,0x4c,0x1f,0xf2,0xac,0xf8,0x72,0xd2,0x92,
+0xe6,0x29,0x40,0x67,0x7e,0xf3,0xa1,0x7c,0xb8,0x09,0x69,0x40,0x03,0x23,0x25,0xa1,
+0x4e,0x4a,0x6b,0x99,0x0b,0x18,0x55,0x9c,0x08,0xcd,0x39,0x95,0xa6,0x17,0x99,0x0e,
+0xe0,0x77,0x5f,0xab,0xbc,0x91,0x96,0x26,0x13,0x9f,0xfb,0x95,0x2f,0xea,0xf5,0x04,
+0xf4,0x9f,0x84,0xb7,0x6f,0xde,0xa7,0x7e,0xbe,0x86,0x3f,0x00,0xe1,0xe3,0xea,0xcf,
+0x2a,0x4e,0x33,0x78,0x1c,0x64,0x60,0x49,0x8c,0x8f,0xd7,0x75,0x79,0x17,0xac,0xeb,
+0xc7,0xdc,0xdf,0x84,0x78,0x1f,0x25,0x65,0x5e,0x56,0xd3,0xab,0xf9,0x7c,0x1e,0x06,
+0xe5,0x7c,0xbe,0xf6,0xc0,0x14,0x0d,0x27,0xfd,0xd4,0x7e,0x88,0x28,0xc1,0x87,0xd1,
+0xe7,0x04,0xb0,0x66,0xea,0x64,0x5f,0x89,0xe3,0x5a,0x2d,0xc3,0xe0,0x91,0xdf,0x84,
+0x86,0xcb,0x30,0x58,0x74,0x0f,0x3e,0x17,0x59,0x0d,0x8b,0xfa,0x75,0xed,0xab,0x8f,
+0x77,0x71,0xe2,0xff,0x29,0x3e,0xaf,0x3d,0x10,0x01,0xf3,0x94,0xb0,0xc3,0xbc,0x4f,
+0x55,0x5c,0xac,0xe7,0x65,0xb5,0xba,0x09,0x57,0x71,0x5d,0x65,0x0f,0x6f,0x19,0x91,
+0x2e,0x40,0x3e,0x9b,0x9b,0x88,0x39,0x0d,0x1f,0x5c,0xbc,0x03,0x10,0x06,0x6a,0x69,
+0xa4,0x13,0x6e,0x38,0x37,0xe7,0xc8,0xa0,0x54,0x09,0x4a,0x8f,0xf2,0x71,0x64,0xb6,
+0x99,0xc7,0xca,0x5c,0x66,0xbc,0xef,0x8c,0x37,0x7c,0x94,0xf1,0x82,0xb2,0x97,0x1b,
+0xef,0x3a,0xe3,0x8d,0x11,0x9d,0xf1,0xda,0x9e,0x33,0x5e,0x08,0x31,0xd6,0x72,0xad,
+0x75,0xb8,0xe3,0x21,0x52,0x9d,0x9d,0xbd,0x27,0xf8,0x05,0x24,0x25,0x2d,0x49,0x4a,
+0xa9,0x71,0x24,0x31,0xfa,0x22,0x92,0x2c,0x7c,0x08,0xd6,0x91,0xa4,0x84,0xee,0x48,
+0x72,0xea,0x1c,0x49,0xca,0xce,0xcc,0x5c,0x8d,0xe5,0x89,0xce,0x0c,0x9d,0xb1,0x8b,
+0x8c,0x9f,0xf5,0xc6,0xb3,0x91,0x1e,0xe2,0xc6,0x1b,0x2f,0x29,0x61,0x68,0x3c,0x7d,
+0xa1,0xf1,0x33,0x87,0xd7,0x58,0xe3,0xb9,0x64,0x09,0x4b,0x2e,0x32,0x7e,0xd1,0x1a,
+0x2f,0x14,0x84,0x47,0x93,0x34,0xa7,0xcb,0xca,0x43,0x85,0xb8,0x8a,0xc7,0x91,0x81,
+0xee,0x79,0x69,0xb8,0x08,0xe6,0x5a,0x32,0x04,0x24,0x8d,0xc9,0x71,0xfd,0xe6,0x3f,
+0x58,0x3f,0xde,0xa9,0xc7,0x83,0x48,0x2b,0x05,0xda,0x29,0xf5,0x02,0xed,0xd2,0x2e,
+0xb9,0xc8,0x71,0xc9,0x45,0x4a,0xf1,0x8a,0xe4,0x82,0x20,0x8d,0x3e,0xc6,0x5c,0x52,
+0x66,0x8e,0x4c,0x4d,0x92,0x1d,0xa7,0x21,0x4c,0x89,0x17,0xcc,0x96,0xee,0xbc,0xec,
+0x99,0xc0,0x6b,0xe7,0x05,0x6b,0xce,0x57,0x37,0x9f,0xe0,0xf5,0xbc,0x13,0x4f,0xba,
+0xf2,0xbb,0x80,0xdf,0xca,0x27,0x75,0x2f,0x6b,0x9e,0xe5,0x79,0x54,0x7d,0xcd,0xfd,
+0xd4,0xdf,0xfb,0xa2,0x4c,0xd3,0xeb,0x75,0x5d,0x95,0x5f,0x3c,0xd6,0x1a,0xda,0xdd,
+0x47,0x4d,0x67,0x32,0x45,0x7e,0xef,0x1e,0xae,0xf1,0x8d,0x29,0x14,0xfa,0xb7,0x57,
+0xcb,0x77,0x43,0x0f,0xe3,0x30,0x09,0x76,0x1d,0x8c,0x96,0xe0,0x3e,0x8f,0xb8,0x70,
+0x04,0xe3,0x16,0xe2,0x97,0x12,0xdb,0xe8,0xb5,0x8b,0x7c,0x16,0xa7,0x45,0xb9,0x4a,
+0xd2,0x34,0x49,0x67,0x03,0x0a,0xc3,0x3a,0xd3,0xa1,0x18,0x41,0x5a,0x18,0x66,0xb1,
+0x43,0x02,0x18,0x21,0xe5,0x45,0x28,0x4d,0xfe,0xdf,0x42,0xc8,0x01,0xc2,0x4a,0x94,
+0x0c,0x10,0x56,0xb9,0x06,0x81,0x39,0x76,0x09,0x42,0xc3,0x96,0xdf,0x61,0x4b,0x18,
+0x32,0xd0,0xa5,0x6c,0x6f,0x88,0x17,0x1d,0x8a,0x39,0x89,0x92,0x60,0xce,0x62,0xfb,
+0x40,0x9c,0x38,0xd3,0x02,0x15,0x65,0xe1,0x07,0x14,0x2d,0xe8,0x00,0x42,0x1b,0x08,
+0xd1,0x1b,0x42,0xd9,0x0f,0x83,0xd0,0xb4,0x81,0xd0,0x54,0xbe,0x10,0x82,0x8b,0xa3,
+0x10,0x03,0x82,0xa6,0x48,0x1b,0x60,0x68,0xd5,0x32,0xc5,0xb9,0xfd,0x81,0x18,0xb2,
+0xc1,0x90,0xba,0xed,0x1e,0x92,0xac,0x4a,0x72,0x1f,0x54,0xd8,0xa1,0x13,0x78,0xb4,
+0x0f,0xd7,0x2c,0x71,0xf2,0x6e,0x1f,0x4e,0x12,0xa9,0x3b,0x1f,0xa3,0xb1,0x61,0x33,
+0x48,0x45,0x09,0x6a,0xad,0xa0,0x55,0x4c,0x10,0xc2,0x8a,0xb1,0xa2,0x67,0xa7,0x45,
+0xf7,0x75,0x0c,0x45,0x4b,0x28,0x90,0x9d,0xe8,0x43,0xf6,0xdb,0xe9,0xb1,0xc4,0x6b,
+0xc7,0xe1,0xf9,0xe0,0x8a,0x0c,0x5b,0x31,0x8c,0xdc,0xce,0x76,0x6e,0xf5,0x58,0x29,
+0xd8,0x29,0xf6,0x52,0x78,0xcb,0xa0,0x14,0xad,0x27,0x60,0xe3,0x73,0x6a,0x95,0x20,
+0xf6,0x4e,0x79,0xda,0x95,0x14,0x42,0x09,0xb5,0x83,0x21,0xe4,0x80,0x21,0x7a,0x4d,
+0xbb,0xd8,0xa7,0xad,0xa6,0xf3,0xbc,0xdc,0xfc,0x57,0x96,0x35,0x6e,0x4e,0xa6,0x6b,
+0xac,0x24,0x37,0xe1,0x5d,0xe5,0xa1,0xac,0xdc,0xfb,0x2d,0xb1,0xb9,0xaf,0x6b,0x5f,
+0x45,0xf8,0x38,0x2b,0x16,0x53,0x8a,0x59,0xad,0x2c,0xea,0x68,0x9d,0x7d,0xf3,0x53,
+0x89,0xff,0x6e,0xca,0x2a,0x3d,0x7c,0x3e,0x8f,0x57,0x59,0xfe,0x38,0x5d,0x43,0x09,
+0x8a,0x40,0x62,0x36,0xbf,0xc6,0x3c,0x1b,0xb5,0xfa,0x4d,0xc1,0xec,0x5f,0xfa,0xd5,
+0x6e,0x7e,0xc2,0xa0,0x1e,0x5f,0xad,0x6e,0x5b,0xd5,0xfd,0x02,0x36,0x7d,0xb7,0x2d,
+0x55,0x68,0x1e,0x98,0xb5,0x4d,0x78,0x94,0x98,0x2e,0xcf,0xe9,0x81,0x14,0xe5,0x08,
+0x3a,0xd1,0xfb,0xc9,0xee,0xeb,0x78,0xff,0x6f,0x5c,0xc5,0xdb,0x71,0x60,0x04,0xc8,
+0xa9,0xfd,0x43,0x3d,0x8a,0x03,0x10,0xaa,0xbe,0x1f,0x0b,0x47,0x97,0x02,0x8c,0x53,
+0x8c,0x12,0xce,0x19,0xc4,0x57,0x63,0x15,0x57,0x84,0x59,0x2d,0x81,0x89,0x1a,0x66,
+0x17,0x7b,0x63,0x5b,0xe7,0xdb,0xaa,0x08,0x59,0x5f,0x9f,0xd6,0xa8,0x19,0xde,0xb4,
+0x1a,0xcd,0xca,0x3c,0xed,0xeb,0x89,0xc1,0xeb,0x09,0xf8,0xed,0xc7,0x4f,0x7f,0x0b,
+0xfe,0x87,0x7c,0x3f,0x69,0x70,0x81,0x32,0xe4,0x69,0x6c,0x9d,0x6c,0xa2,0x73,0xf1,
+0x24,0x3a,0x35,0xd9,0xfa,0xb0,0xc2,0x2b,0x0c,0x2a,0x8c,0x26,0x40,0x84,0xbb,0x47,
+0xcc,0x5b,0x64,0xa7,0xe4,0xb4,0x75,0xb2,0x77,0x6c,0xd6,0x3a,0xb6,0x90,0xb6,0x0d,
+0x41,0xa7,0x46,0x86,0xa0,0xc1,0x2a,0xdb,0x8b,0x71,0x16,0xb1,0x10,0x8a,0xee,0x07,
+0xc8,0xf3,0x72,0x9c,0xd9,0x51,0xc7,0xb0,0xae,0x04,0x32,0xdb,0x39,0x1f,0x34,0x78,
+0xa3,0x83,0x99,0x11,0xed,0x4e,0x04,0xb3,0x51,0xc4,0x0d,0x28,0x8a,0xb4,0x56,0xc3,
+0x31,0x44,0x87,0x62,0x8e,0x6a,0x7b,0x7a,0x09,0xe6,0x4f,0x96,0x00,0x24,0xda,0x27,
+0x6b,0xb0,0x13,0x8d,0x55,0x59,0xc7,0xb5,0x7f,0x1b,0x39,0xdc,0x62,0xe0,0xda,0x30,
+0xdd,0xaf,0x0d,0x33,0xa8,0xd8,0xb6,0x52,0xab,0x5d,0x52,0x29,0x3e,0x6a,0xd6,0xaf,
+0x55,0x33,0xe2,0xba,0xad,0xa3,0x77,0x71,0xbd,0xdc,0x67,0x15,0x1a,0xca,0xeb,0x03,
+0x8d,0xc3,0x00,0xda,0xdf,0x95,0x96,0x36,0x80,0x65,0x85,0xd3,0x14,0xd8,0xe6,0x80,
+0x4f,0x68,0x15,0x31,0x49,0x5c,0x20,0x80,0xae,0x08,0x06,0x75,0xd4,0x0c,0x7e,0xbb,
+0x44,0x32,0x43,0xc9,0xd0,0x8f,0x13,0x83,0xe2,0x44,0x64,0xe0,0xa6,0x91,0x96,0x08,
+0x62,0x79,0x04,0x2d,0xbb,0x08,0x80,0x1a,0xb8,0x61,0x81,0x21,0x8c,0x45,0x9a,0x50,
+0x0e,0xc9,0x48,0x88,0x48,0x12,0xc5,0x71,0x2e,0x33,0x91,0x25,0x4e,0x46,0x82,0x28,
+0x06,0xb9,0x89,0x18,0x10,0xa2,0x24,0x7e,0xa0,0x38,0x14,0x82,0x73,0x99,0xc2,0x67,
+0xee,0x02,0x25,0x95,0x45,0x53,0xe1,0x30,0xc9,0x12,0x1b,0x09,0x4d,0xd4,0x52,0xc1,
+0x47,0x1e,0x71,0xc2,0x38,0xe8,0x26,0xe5,0x32,0x92,0xc0,0x7a,0x82,0xca,0x22,0x3f,
+0x54,0x00,0x26,0x1c,0x42,0x29,0xa0,0x85,0x2a,0xcb,0x40,0x09,0xad,0x03,0x0e,0xf9,
+0x13,0xc9,0x52,0x60,0x86,0xd1,0x81,0x26,0x4c,0x04,0x10,0x60,0x02,0xee,0x8c,0x0c,
+0xb8,0x26,0x1a,0x5f,0xd5,0x16,0x25,0x58,0xe3,0xe0,0x5d,0xab,0x81,0x72,0xe2,0xe0,
+0x2d,0x02,0xa3,0xfc,0x02,0xcd,0x25,0xd3,0x81,0x92,0x22,0x90,0x44,0x48,0x10,0xcb,
+0x98,0x04,0xfa,0x64,0xc0,0xa0,0x13,0x45,0xf6,0x4c,0xd4,0x8c,0x5d,0x24,0x58,0xa0,
+0xe0,0xa8,0xd1,0x1d,0xc4,0x29,0x20,0x5f,0xb0,0x16,0x22,0x01,0xaf,0x90,0x20,0x59,
+0x71,0xf0,0x1a,0xc2,0x2d,0xdc,0x4a,0x98,0x25,0xc0,0x38,0xa0,0x4c,0x41,0x35,0x01,
+0x64,0x58,0x28,0x02,0x1e,0x05,0x16,0x3b,0x81,0x2b,0x67,0x25,0x0c,0xc0,0xf2,0x01,
+0x9d,0x28,0x8b,0x37,0x1f,0xf8,0x40,0x68,0x18,0x53,0x16,0x9e,0x02,0x27,0x70,0xa7,
+0x2f,0xd0,0x56,0x38,0x16,0x28,0x25,0x02,0x8b,0xfe,0x83,0xae,0xb6,0xe4,0xc0,0x48,
+0x0e,0x8a,0x39,0x06,0xd4,0x03,0x39,0x4b,0x28,0x6c,0xc4,0x24,0x8d,0xd6,0xa8,0x14,
+0x43,0x17,0x07,0xdb,0x70,0x05,0x1b,0x5d,0x04,0xac,0x04,0x35,0x48,0x1a,0x18,0x22,
+0xf0,0x25,0x2d,0x41,0x9e,0xe1,0x70,0x07,0x9e,0x01,0xc5,0x11,0x5f,0xe3,0x4e,0xc0,
+0x1f,0x61,0xd0,0x66,0x61,0x50,0x92,0x6d,0x48,0x36,0xed,0xaa,0x6a,0x76,0x5c,0xf9,
+0xe3,0xfb,0x19,0xee,0xf1,0x3a,0xdb,0xa2,0xa7,0xef,0x3a,0x03,0x41,0x19,0xa7,0xcd,
+0x12,0x56,0xc2,0xde,0x47,0xe0,0xa7,0x32,0x37,0x40,0x35,0x06,0x87,0xe9,0x22,0x36,
+0x68,0x4e,0x43,0xdb,0x50,0xdd,0x8e,0x41,0x5a,0xe7,0xe8,0x93,0xae,0x9d,0x79,0xcf,
+0xe8,0x32,0x82,0x17,0x4d,0x8e,0xb6,0xe8,0xc8,0x01,0x2d,0xe0,0x2a,0xdf,0x46,0xe6,
+0x61,0xd8,0x35,0x0d,0x5b,0x11,0xa8,0xc8,0x6d,0xdd,0x6a,0x4f,0xcb,0xb0,0x35,0x33,
+0x23,0xe5,0x40,0x47,0x2b,0x77,0x9a,0xf4,0x2e,0xd3,0x1a,0xdd,0xd7,0x17,0xfe,0x92,
+0x7c,0xce,0x4e,0xe5,0x73,0x25,0x50,0xc1,0x1e,0x45,0xf4,0x28,0xd8,0x16,0x36,0x28,
+0xe7,0x36,0x4e,0x78,0xa8,0xb9,0x0f,0x04,0x59,0xa0,0x6f,0x6f,0x95,0xf6,0xa9,0xdc,
+0xed,0x02,0xf9,0x4e,0x46,0x16,0xed,0x9e,0x43,0x5b,0xdd,0xf7,0x10,0x97,0xc2,0xcc,
+0x85,0x98,0x8b,0xf9,0x73,0x30,0x6d,0xab,0x22,0xa9,0xb9,0x14,0xc6,0xeb,0x59,0x2a,
+0x93,0x67,0x60,0x64,0xdb,0x7d,0xe3,0x31,0xcc,0x85,0x30,0x52,0x4b,0xe7,0x9f,0x81,
+0x31,0xdc,0x76,0x30,0xa7,0x37,0x51,0x33,0x85,0xd7,0xe9,0x9d,0xb3,0xc5,0x6b,0xcf,
+0x65,0x87,0xd6,0x41,0xf4,0xad,0x83,0xd6,0x5d,0xeb,0xd0,0x1d,0x09,0xed,0xc6,0xeb,
+0xc9,0xdd,0xf3,0xb0,0xc1,0x69,0xb7,0x6a,0x4d,0x5c,0x42,0xe5,0x30,0x02,0x2a,0x1b,
+0xd4,0xa2,0x40,0x3b,0x62,0x97,0x02,0x32,0xc8,0xeb,0x64,0x4a,0xa8,0x31,0x78,0x86,
+0xc5,0x18,0xd4,0x5e,0xa6,0x97,0xcc,0xc9,0xd7,0x09,0xe4,0x90,0xce,0x60,0x63,0xb7,
+0x8c,0x38,0x6f,0x97,0xef,0x27,0xeb,0xba,0x2d,0x34,0x38,0xca,0x89,0xae,0xd1,0x02,
+0x47,0x81,0x54,0xd5,0x1c,0x8e,0x0d,0x6d,0xf7,0x30,0x78,0xd8,0x77,0x73,0x48,0x44,
+0x77,0x0f,0x4f,0x24,0xdd,0xfe,0x0e,0x64,0xfd,0x05,0xe7,0x8c,0x07,0x3d,0xf4,0xab,
+0x8d,0x3f,0xb4,0xf2,0x44,0xc7,0x3f,0xca,0x78,0x47,0xb1,0xa9,0xa0,0xbc,0x75,0x48,
+0x85,0x09,0x1e,0x8e,0xef,0xc5,0xae,0xf1,0xc3,0xe0,0x29,0xe3,0xaf,0xd1,0xa8,0x28,
+0x2e,0x92,0x25,0x9c,0xc0,0xad,0xb2,0x34,0xcd,0x7d,0x37,0x94,0x67,0x8b,0x62,0x9a,
+0xc0,0x89,0x9b,0xaf,0x9e,0xc0,0xdd,0x7e,0xfe,0xf8,0x21,0x48,0xfd,0x7d,0x96,0xf8,
+0x2d,0x47,0x3f,0x06,0x52,0x58,0xa8,0x95,0x14,0x8e,0x90,0x6e,0x33,0x1c,0x9c,0xc7,
+0x3b,0x88,0xfd,0xaa,0x8c,0x72,0x6e,0xd0,0x49,0x1c,0x44,0x20,0xec,0x57,0x9d,0x56,
+0xf7,0x11,0x64,0x78,0xb9,0x84,0xda,0xff,0xca,0xe8,0x13,0x50,0x35,0xb5,0xa5,0x11,
+0xb6,0x52,0xf0,0x0b,0x41,0x23,0xdb,0x23,0x91,0xc9,0xa2,0x3b,0xac,0x3c,0x28,0xee,
+0x25,0x3a,0x47,0xfd,0x38,0x05,0xed,0xfa,0x4d,0xd6,0xb9,0xce,0x0a,0x12,0x1f,0x74,
+0x9b,0x2a,0x81,0xa3,0xa2,0xc0,0x04,0x0a,0xfb,0xdc,0x40,0x1b,0x1a,0x39,0x9d,0x47,
+0x26,0xe2,0x8c,0x47,0xf0,0x65,0x11,0x34,0x27,0x5a,0x7c,0xfb,0x19,0xa3,0x95,0xc1,
+0x72,0x52,0x2b,0x64,0x57,0x46,0x81,0x71,0xcb,0xf7,0x83,0x75,0x3b,0x76,0xe8,0x3b,
+0x06,0xda,0xb2,0x27,0x1a,0xfd,0x5a,0x65,0x71,0xfe,0x44,0xf2,0xc1,0x06,0xf8,0xd5,
+0xb2,0xb9,0x80,0x26,0xc8,0x2a,0xf8,0xea,0xf4,0xf6,0xb7,0x6c,0x9d,0x94,0xf0,0x65,
+0xf6,0xe3,0x81,0x13,0x36,0x4b,0x8c,0xdf,0x84,0xdf,0xbe,0xf9,0x1f,0x85,0x52,0x06,
+0xd5,0x6a,0x1f,0x00,0x00,};
+
+#if HTTPD_FS_ETAG
+static const char etag__img_discovery_svg[] = "\"d5065285-1f6a\"";
+static const char not_modified__img_discovery_svg[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"d5065285-1f6a\"\r\n"
+"Cache-Control: max-age=3600\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__img_discovery_svg = 1;
 static const unsigned char data__img_discovery_svg[] = {
 /* /img/discovery.svg (19 chars) */
 0x2f,0x69,0x6d,0x67,0x2f,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x79,0x2e,0x73,
 0x76,0x67,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.1 200 OK
 " (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
 /* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
@@ -23,12 +223,27 @@ static const unsigned char data__img_discovery_svg[] = {
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 8042
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x38,0x30,0x34,0x32,0x0d,0x0a,
+/* "ETag: "d5065285-1f6a"
+Cache-Control: max-age=3600
+" (52 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x64,0x35,0x30,0x36,0x35,0x32,0x38,0x35,0x2d,
+0x31,0x66,0x36,0x61,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,
+0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x33,0x36,
+0x30,0x30,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
 /* "Content-type: image/svg+xml
 
 " (31 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
 0x61,0x67,0x65,0x2f,0x73,0x76,0x67,0x2b,0x78,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (8125 bytes) */
+/* raw file data (8042 bytes) */
 0x3c,0x73,0x76,0x67,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x72,0x64,0x66,0x3d,0x22,
 0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
 0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x30,0x32,0x2f,0x32,0x32,0x2d,0x72,0x64,0x66,
@@ -49,52 +264,51 @@ static const unsigned char data__img_discovery_svg[] = {
 0x39,0x20,0x31,0x30,0x35,0x32,0x2e,0x33,0x36,0x32,0x32,0x30,0x34,0x37,0x22,0x20,
 0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x64,0x63,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
 0x2f,0x70,0x75,0x72,0x6c,0x2e,0x6f,0x72,0x67,0x2f,0x64,0x63,0x2f,0x65,0x6c,0x65,
-0x6d,0x65,0x6e,0x74,0x73,0x2f,0x31,0x2e,0x31,0x2f,0x22,0x3e,0x0d,0x0a,0x3c,0x64,
-0x65,0x66,0x73,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,
-0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x61,0x22,0x3e,0x0d,0x0a,0x3c,
-0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,
-0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,0x20,0x6f,0x66,0x66,
-0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,
-0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x2e,0x35,0x33,0x32,0x22,0x2f,0x3e,
-0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,
-0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,0x20,
-0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,
-0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0d,
-0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,
-0x20,0x69,0x64,0x3d,0x22,0x68,0x22,0x20,0x79,0x32,0x3d,0x22,0x37,0x32,0x34,0x22,
-0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,
-0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,
-0x78,0x32,0x3d,0x22,0x35,0x33,0x38,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,
-0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,
-0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,
-0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,0x31,0x32,0x33,0x29,0x22,0x20,0x79,0x31,0x3d,
-0x22,0x31,0x36,0x37,0x22,0x20,0x78,0x31,0x3d,0x22,0x32,0x32,0x37,0x22,0x3e,0x0d,
-0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,
-0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,
-0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,
-0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,
-0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x37,0x66,0x61,0x35,0x37,0x66,0x22,
-0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,
-0x0d,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,
-0x74,0x20,0x69,0x64,0x3d,0x22,0x65,0x22,0x20,0x79,0x32,0x3d,0x22,0x37,0x37,0x32,
-0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,
-0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,
-0x20,0x78,0x32,0x3d,0x22,0x33,0x30,0x31,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,
-0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,
-0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,
-0x39,0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,0x31,0x32,0x39,0x29,0x22,0x20,0x79,0x31,
-0x3d,0x22,0x37,0x37,0x33,0x22,0x20,0x78,0x31,0x3d,0x22,0x32,0x36,0x38,0x22,0x3e,
-0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,
-0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,0x33,0x33,0x22,0x20,
-0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,
-0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x36,0x36,0x22,0x20,0x6f,0x66,0x66,0x73,
-0x65,0x74,0x3d,0x22,0x2e,0x35,0x34,0x35,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,
+0x6d,0x65,0x6e,0x74,0x73,0x2f,0x31,0x2e,0x31,0x2f,0x22,0x3e,0x0a,0x3c,0x64,0x65,
+0x66,0x73,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,
+0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x61,0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,
+0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,
+0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x6f,0x66,0x66,
+0x73,0x65,0x74,0x3d,0x22,0x2e,0x35,0x33,0x32,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,
 0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,0x33,0x33,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,
-0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,
-0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,0x6e,
+0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,
+0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,0x72,
+0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,
+0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x68,0x22,
+0x20,0x79,0x32,0x3d,0x22,0x37,0x32,0x34,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,
+0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,
+0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x35,0x33,0x38,
+0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,
+0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,
+0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,
+0x31,0x32,0x33,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x31,0x36,0x37,0x22,0x20,0x78,
+0x31,0x3d,0x22,0x32,0x32,0x37,0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,
+0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
+0x37,0x66,0x61,0x35,0x37,0x66,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,
+0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,
+0x64,0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,
+0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x65,0x22,0x20,0x79,0x32,
+0x3d,0x22,0x37,0x37,0x32,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,
+0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,
+0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x33,0x30,0x31,0x22,0x20,0x67,
+0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,
+0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,0x30,0x20,
+0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,0x31,0x32,0x39,
+0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x37,0x37,0x33,0x22,0x20,0x78,0x31,0x3d,0x22,
+0x32,0x36,0x38,0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,
+0x33,0x33,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,
+0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,
+0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x36,0x36,0x36,0x22,0x20,0x6f,
+0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x2e,0x35,0x34,0x35,0x22,0x2f,0x3e,0x0a,0x3c,
+0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,
+0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,0x33,0x33,0x22,0x20,0x6f,0x66,0x66,
+0x73,0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,
+0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,
 0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,
 0x63,0x22,0x20,0x79,0x32,0x3d,0x22,0x35,0x35,0x35,0x22,0x20,0x67,0x72,0x61,0x64,
 0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,
@@ -103,155 +317,153 @@ static const unsigned char data__img_discovery_svg[] = {
 0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,
 0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,0x39,0x38,
 0x20,0x2d,0x31,0x33,0x31,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x35,0x33,0x36,0x22,
-0x20,0x78,0x31,0x3d,0x22,0x32,0x39,0x35,0x22,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,
-0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x23,0x35,0x38,0x62,0x37,0x66,0x35,0x22,0x20,0x6f,0x66,0x66,
-0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,
+0x20,0x78,0x31,0x3d,0x22,0x32,0x39,0x35,0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,
 0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,
-0x6f,0x72,0x3a,0x23,0x30,0x62,0x37,0x30,0x62,0x31,0x22,0x20,0x6f,0x66,0x66,0x73,
-0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,
-0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0d,0x0a,0x3c,0x6c,0x69,
-0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,
-0x22,0x62,0x22,0x20,0x79,0x32,0x3d,0x22,0x35,0x35,0x31,0x22,0x20,0x67,0x72,0x61,
-0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,
-0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,
-0x33,0x30,0x39,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,
-0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,
-0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x34,0x30,0x2e,
-0x31,0x20,0x2d,0x31,0x33,0x30,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x35,0x33,0x36,
-0x22,0x20,0x78,0x31,0x3d,0x22,0x32,0x39,0x35,0x22,0x3e,0x0d,0x0a,0x3c,0x73,0x74,
-0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x62,0x39,0x62,0x39,0x62,0x39,0x22,0x20,0x6f,0x66,
-0x66,0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,
-0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x23,0x32,0x34,0x31,0x63,0x31,0x63,0x22,0x20,0x6f,0x66,0x66,
-0x73,0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,
-0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0d,0x0a,0x3c,0x6c,
-0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,
-0x3d,0x22,0x67,0x22,0x20,0x79,0x32,0x3d,0x22,0x33,0x35,0x32,0x22,0x20,0x78,0x6c,
-0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x61,0x22,0x20,0x67,0x72,
-0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,
-0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,
-0x22,0x33,0x36,0x36,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,
-0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,
-0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,
-0x39,0x36,0x20,0x2d,0x31,0x32,0x39,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x33,0x31,
-0x39,0x22,0x20,0x78,0x31,0x3d,0x22,0x33,0x36,0x37,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,
-0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,
-0x64,0x3d,0x22,0x66,0x22,0x20,0x79,0x32,0x3d,0x22,0x33,0x35,0x32,0x22,0x20,0x78,
-0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,0x3d,0x22,0x23,0x61,0x22,0x20,0x67,
-0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,
-0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,
-0x3d,0x22,0x33,0x36,0x36,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,
-0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,
-0x28,0x31,0x2e,0x32,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x32,0x20,0x2d,0x36,0x35,
-0x35,0x20,0x2d,0x31,0x35,0x35,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x33,0x31,0x39,
-0x22,0x20,0x78,0x31,0x3d,0x22,0x33,0x36,0x37,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x6c,
-0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,
-0x3d,0x22,0x64,0x22,0x20,0x79,0x32,0x3d,0x22,0x37,0x34,0x32,0x22,0x20,0x67,0x72,
-0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,
-0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,
-0x22,0x34,0x34,0x33,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,
-0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,
-0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,
-0x39,0x36,0x20,0x2d,0x31,0x32,0x39,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x37,0x34,
-0x32,0x22,0x20,0x78,0x31,0x3d,0x22,0x33,0x37,0x37,0x22,0x3e,0x0d,0x0a,0x3c,0x73,
-0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,0x20,0x6f,0x66,0x66,0x73,
-0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x23,0x63,0x63,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,
-0x2e,0x31,0x35,0x33,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,
+0x6f,0x72,0x3a,0x23,0x35,0x38,0x62,0x37,0x66,0x35,0x22,0x20,0x6f,0x66,0x66,0x73,
+0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,
 0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,
-0x3a,0x23,0x63,0x63,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x2e,
-0x34,0x39,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,
+0x3a,0x23,0x30,0x62,0x37,0x30,0x62,0x31,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,
+0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,
+0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x62,0x22,0x20,
+0x79,0x32,0x3d,0x22,0x35,0x35,0x31,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,
+0x74,0x55,0x6e,0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,
+0x65,0x4f,0x6e,0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x33,0x30,0x39,0x22,
+0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,
+0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,
+0x30,0x20,0x30,0x20,0x31,0x2e,0x34,0x39,0x20,0x34,0x30,0x2e,0x31,0x20,0x2d,0x31,
+0x33,0x30,0x29,0x22,0x20,0x79,0x31,0x3d,0x22,0x35,0x33,0x36,0x22,0x20,0x78,0x31,
+0x3d,0x22,0x32,0x39,0x35,0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,
 0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
-0x23,0x62,0x33,0x62,0x33,0x62,0x33,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,
-0x22,0x2e,0x38,0x37,0x32,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,
+0x23,0x62,0x39,0x62,0x39,0x62,0x39,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,
+0x22,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x32,
+0x34,0x31,0x63,0x31,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x31,
+0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,
+0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,
+0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x67,0x22,0x20,0x79,0x32,0x3d,
+0x22,0x33,0x35,0x32,0x22,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,
+0x3d,0x22,0x23,0x61,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,
+0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,
+0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x33,0x36,0x36,0x22,0x20,0x67,0x72,
+0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,
+0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,
+0x20,0x31,0x2e,0x34,0x39,0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,0x31,0x32,0x39,0x29,
+0x22,0x20,0x79,0x31,0x3d,0x22,0x33,0x31,0x39,0x22,0x20,0x78,0x31,0x3d,0x22,0x33,
+0x36,0x37,0x22,0x2f,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,
+0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x66,0x22,0x20,0x79,0x32,0x3d,
+0x22,0x33,0x35,0x32,0x22,0x20,0x78,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x72,0x65,0x66,
+0x3d,0x22,0x23,0x61,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,
+0x69,0x74,0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,
+0x55,0x73,0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x33,0x36,0x36,0x22,0x20,0x67,0x72,
+0x61,0x64,0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,
+0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x32,0x20,0x30,0x20,0x30,0x20,
+0x31,0x2e,0x32,0x20,0x2d,0x36,0x35,0x35,0x20,0x2d,0x31,0x35,0x35,0x29,0x22,0x20,
+0x79,0x31,0x3d,0x22,0x33,0x31,0x39,0x22,0x20,0x78,0x31,0x3d,0x22,0x33,0x36,0x37,
+0x22,0x2f,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x47,0x72,0x61,0x64,0x69,
+0x65,0x6e,0x74,0x20,0x69,0x64,0x3d,0x22,0x64,0x22,0x20,0x79,0x32,0x3d,0x22,0x37,
+0x34,0x32,0x22,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x55,0x6e,0x69,0x74,
+0x73,0x3d,0x22,0x75,0x73,0x65,0x72,0x53,0x70,0x61,0x63,0x65,0x4f,0x6e,0x55,0x73,
+0x65,0x22,0x20,0x78,0x32,0x3d,0x22,0x34,0x34,0x33,0x22,0x20,0x67,0x72,0x61,0x64,
+0x69,0x65,0x6e,0x74,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,
+0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x34,0x39,0x20,0x30,0x20,0x30,0x20,0x31,
+0x2e,0x34,0x39,0x20,0x2d,0x31,0x39,0x36,0x20,0x2d,0x31,0x32,0x39,0x29,0x22,0x20,
+0x79,0x31,0x3d,0x22,0x37,0x34,0x32,0x22,0x20,0x78,0x31,0x3d,0x22,0x33,0x37,0x37,
+0x22,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x22,
+0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,
+0x74,0x6f,0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,
+0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,
+0x65,0x74,0x3d,0x22,0x2e,0x31,0x35,0x33,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,
+0x70,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,
+0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+0x3d,0x22,0x2e,0x34,0x39,0x30,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,0x20,
 0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x23,0x65,0x63,0x65,0x63,0x65,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,
-0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,
-0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0d,0x0a,0x3c,0x2f,0x64,0x65,
-0x66,0x73,0x3e,0x0d,0x0a,0x3c,0x67,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,
-0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
-0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
-0x68,0x3a,0x31,0x2e,0x34,0x39,0x70,0x78,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,0x72,
-0x6c,0x28,0x23,0x68,0x29,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,
-0x35,0x35,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x34,0x36,0x22,0x20,
-0x79,0x3d,0x22,0x34,0x34,0x2e,0x36,0x22,0x20,0x78,0x3d,0x22,0x35,0x30,0x2e,0x38,
-0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,
-0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,
-0x66,0x69,0x6c,0x6c,0x3a,0x23,0x63,0x64,0x64,0x63,0x64,0x62,0x22,0x20,0x68,0x65,
-0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x30,0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3d,0x22,0x37,0x33,0x2e,0x36,0x22,0x20,0x79,0x3d,0x22,0x31,0x38,0x2e,0x31,0x22,
-0x20,0x78,0x3d,0x22,0x33,0x34,0x34,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,
-0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
-0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
-0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x33,0x33,0x33,
-0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x34,0x31,0x22,0x20,0x77,
-0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x34,0x2e,0x31,0x22,0x20,0x79,0x3d,0x22,0x38,
-0x35,0x39,0x22,0x20,0x78,0x3d,0x22,0x31,0x39,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,
+0x72,0x3a,0x23,0x62,0x33,0x62,0x33,0x62,0x33,0x22,0x20,0x6f,0x66,0x66,0x73,0x65,
+0x74,0x3d,0x22,0x2e,0x38,0x37,0x32,0x22,0x2f,0x3e,0x0a,0x3c,0x73,0x74,0x6f,0x70,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x6f,0x70,0x2d,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x23,0x65,0x63,0x65,0x63,0x65,0x63,0x22,0x20,0x6f,0x66,0x66,0x73,
+0x65,0x74,0x3d,0x22,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x6c,0x69,0x6e,0x65,0x61,
+0x72,0x47,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x3e,0x0a,0x3c,0x2f,0x64,0x65,0x66,
+0x73,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,
+0x65,0x6e,0x6f,0x64,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,
+0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
+0x2e,0x34,0x39,0x70,0x78,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,0x72,0x6c,0x28,0x23,
+0x68,0x29,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,0x35,0x35,0x22,
+0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x34,0x36,0x22,0x20,0x79,0x3d,0x22,
+0x34,0x34,0x2e,0x36,0x22,0x20,0x78,0x3d,0x22,0x35,0x30,0x2e,0x38,0x22,0x2f,0x3e,
+0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,
+0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,
+0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,
+0x3a,0x23,0x63,0x64,0x64,0x63,0x64,0x62,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
+0x3d,0x22,0x31,0x30,0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x33,
+0x2e,0x36,0x22,0x20,0x79,0x3d,0x22,0x31,0x38,0x2e,0x31,0x22,0x20,0x78,0x3d,0x22,
+0x33,0x34,0x34,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,
+0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,
+0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x33,0x33,0x33,0x22,0x20,0x68,0x65,0x69,
+0x67,0x68,0x74,0x3d,0x22,0x31,0x34,0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x38,0x34,0x2e,0x31,0x22,0x20,0x79,0x3d,0x22,0x38,0x35,0x39,0x22,0x20,0x78,
+0x3d,0x22,0x31,0x39,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,
+0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
+0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,0x72,0x6c,0x28,0x23,0x65,0x29,
+0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x35,0x22,0x20,
+0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x38,0x2e,0x36,0x22,0x20,0x79,0x3d,0x22,
+0x31,0x65,0x33,0x22,0x20,0x78,0x3d,0x22,0x31,0x39,0x37,0x22,0x2f,0x3e,0x0a,0x3c,
 0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,
-0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,
-0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,
-0x72,0x6c,0x28,0x23,0x65,0x29,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-0x33,0x37,0x2e,0x35,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x38,0x2e,
-0x36,0x22,0x20,0x79,0x3d,0x22,0x31,0x65,0x33,0x22,0x20,0x78,0x3d,0x22,0x31,0x39,
-0x37,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,
-0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,
-0x2e,0x39,0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x33,0x30,0x22,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x35,0x30,0x22,0x20,0x79,0x3d,0x22,0x33,0x35,0x39,0x22,0x20,0x78,
-0x3d,0x22,0x31,0x30,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,
-0x31,0x63,0x31,0x63,0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x32,0x2e,0x39,0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,
-0x65,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x33,0x30,0x22,0x20,
-0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x30,0x22,0x20,0x79,0x3d,0x22,0x33,0x36,
-0x30,0x22,0x20,0x78,0x3d,0x22,0x36,0x30,0x34,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,
-0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,
-0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,
-0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,0x32,0x33,0x3b,0x66,0x69,0x6c,0x6c,
-0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x36,
-0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,0x30,0x2e,0x35,0x22,0x20,
-0x79,0x3d,0x22,0x36,0x35,0x33,0x22,0x20,0x78,0x3d,0x22,0x32,0x32,0x38,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,0x31,0x3b,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,0x32,0x33,
-0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,0x65,0x69,0x67,
-0x68,0x74,0x3d,0x22,0x36,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x36,
-0x30,0x2e,0x35,0x22,0x20,0x79,0x3d,0x22,0x36,0x35,0x34,0x22,0x20,0x78,0x3d,0x22,
-0x34,0x36,0x35,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x63,0x69,0x72,0x63,0x6c,0x65,0x20,
+0x6b,0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,
+0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,0x39,0x37,0x3b,0x66,0x69,0x6c,
+0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
+0x36,0x33,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x30,0x22,0x20,
+0x79,0x3d,0x22,0x33,0x35,0x39,0x22,0x20,0x78,0x3d,0x22,0x31,0x30,0x31,0x22,0x2f,
+0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,
+0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,0x31,0x3b,0x73,0x74,
+0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,0x39,0x37,0x3b,
+0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,0x65,0x69,0x67,0x68,
+0x74,0x3d,0x22,0x36,0x33,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,
+0x30,0x22,0x20,0x79,0x3d,0x22,0x33,0x36,0x30,0x22,0x20,0x78,0x3d,0x22,0x36,0x30,
+0x34,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,0x31,0x63,0x31,0x63,0x31,
+0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,
+0x32,0x33,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x68,0x65,
+0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x36,0x30,0x2e,0x35,0x22,0x20,0x79,0x3d,0x22,0x36,0x35,0x33,0x22,0x20,0x78,
+0x3d,0x22,0x32,0x32,0x38,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x63,0x31,
+0x63,0x31,0x63,0x31,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x32,0x2e,0x32,0x33,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,
+0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x30,0x22,0x20,0x77,0x69,
+0x64,0x74,0x68,0x3d,0x22,0x36,0x30,0x2e,0x35,0x22,0x20,0x79,0x3d,0x22,0x36,0x35,
+0x34,0x22,0x20,0x78,0x3d,0x22,0x34,0x36,0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x63,0x69,
+0x72,0x63,0x6c,0x65,0x20,0x72,0x3d,0x22,0x32,0x31,0x2e,0x34,0x22,0x20,0x73,0x74,
+0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,
+0x23,0x63,0x29,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,
+0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x30,0x61,0x37,0x31,
+0x62,0x32,0x22,0x20,0x63,0x78,0x3d,0x22,0x32,0x35,0x38,0x22,0x20,0x63,0x79,0x3d,
+0x22,0x36,0x38,0x33,0x22,0x2f,0x3e,0x0a,0x3c,0x63,0x69,0x72,0x63,0x6c,0x65,0x20,
 0x72,0x3d,0x22,0x32,0x31,0x2e,0x34,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x63,0x29,0x3b,0x73,
+0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x62,0x29,0x3b,0x73,
 0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,
-0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x30,0x61,0x37,0x31,0x62,0x32,0x22,0x20,0x63,
-0x78,0x3d,0x22,0x32,0x35,0x38,0x22,0x20,0x63,0x79,0x3d,0x22,0x36,0x38,0x33,0x22,
-0x2f,0x3e,0x0d,0x0a,0x3c,0x63,0x69,0x72,0x63,0x6c,0x65,0x20,0x72,0x3d,0x22,0x32,
-0x31,0x2e,0x34,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,
-0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x62,0x29,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,
-0x6c,0x3a,0x23,0x32,0x34,0x31,0x63,0x31,0x63,0x22,0x20,0x63,0x78,0x3d,0x22,0x34,
-0x39,0x35,0x22,0x20,0x63,0x79,0x3d,0x22,0x36,0x38,0x34,0x22,0x2f,0x3e,0x0d,0x0a,
-0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,
-0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,
-0x74,0x3d,0x22,0x31,0x32,0x35,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,
-0x37,0x33,0x22,0x20,0x79,0x3d,0x22,0x34,0x35,0x34,0x22,0x20,0x78,0x3d,0x22,0x32,
-0x38,0x36,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,
-0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x37,0x32,0x22,0x20,0x77,
-0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x35,0x22,0x20,0x79,0x3d,0x22,0x34,0x33,
-0x30,0x22,0x20,0x78,0x3d,0x22,0x33,0x31,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,
-0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,
-0x65,0x3a,0x23,0x33,0x33,0x33,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x32,0x2e,0x39,0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,
-0x33,0x33,0x35,0x33,0x35,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,
-0x33,0x34,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x33,0x33,0x22,0x20,
-0x79,0x3d,0x22,0x34,0x35,0x31,0x22,0x20,0x78,0x3d,0x22,0x33,0x30,0x36,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x66,0x6c,0x6f,0x77,0x52,0x6f,0x6f,0x74,0x20,0x78,0x6d,0x6c,
+0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x32,0x34,0x31,0x63,0x31,0x63,0x22,0x20,0x63,
+0x78,0x3d,0x22,0x34,0x39,0x35,0x22,0x20,0x63,0x79,0x3d,0x22,0x36,0x38,0x34,0x22,
+0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,
+0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x35,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
+0x3d,0x22,0x31,0x37,0x33,0x22,0x20,0x79,0x3d,0x22,0x34,0x35,0x34,0x22,0x20,0x78,
+0x3d,0x22,0x32,0x38,0x36,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,
+0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x37,0x32,0x22,
+0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x35,0x22,0x20,0x79,0x3d,0x22,
+0x34,0x33,0x30,0x22,0x20,0x78,0x3d,0x22,0x33,0x31,0x30,0x22,0x2f,0x3e,0x0a,0x3c,
+0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,
+0x6b,0x65,0x3a,0x23,0x33,0x33,0x33,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,
+0x69,0x64,0x74,0x68,0x3a,0x32,0x2e,0x39,0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,
+0x34,0x33,0x33,0x35,0x33,0x35,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
+0x31,0x33,0x34,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x33,0x33,0x22,
+0x20,0x79,0x3d,0x22,0x34,0x35,0x31,0x22,0x20,0x78,0x3d,0x22,0x33,0x30,0x36,0x22,
+0x2f,0x3e,0x0a,0x3c,0x66,0x6c,0x6f,0x77,0x52,0x6f,0x6f,0x74,0x20,0x78,0x6d,0x6c,
 0x3a,0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,
 0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,
 0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
@@ -268,252 +480,250 @@ static const unsigned char data__img_discovery_svg[] = {
 0x30,0x2e,0x37,0x22,0x20,0x78,0x3d,0x22,0x33,0x34,0x36,0x22,0x20,0x68,0x65,0x69,
 0x67,0x68,0x74,0x3d,0x22,0x35,0x39,0x2e,0x33,0x22,0x2f,0x3e,0x3c,0x2f,0x66,0x6c,
 0x6f,0x77,0x52,0x65,0x67,0x69,0x6f,0x6e,0x3e,0x3c,0x66,0x6c,0x6f,0x77,0x50,0x61,
-0x72,0x61,0x2f,0x3e,0x3c,0x2f,0x66,0x6c,0x6f,0x77,0x52,0x6f,0x6f,0x74,0x3e,0x0d,
-0x0a,0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6c,0x65,
-0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,
-0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,0x2e,0x35,0x70,
-0x78,0x3b,0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,
-0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x73,
-0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x32,0x35,0x25,0x3b,0x66,0x69,0x6c,0x6c,0x3a,
-0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,
-0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x20,0x79,0x3d,
-0x22,0x35,0x31,0x30,0x2e,0x32,0x32,0x31,0x36,0x35,0x22,0x20,0x78,0x3d,0x22,0x33,
-0x32,0x35,0x2e,0x31,0x38,0x36,0x34,0x22,0x3e,0x3c,0x74,0x73,0x70,0x61,0x6e,0x20,
-0x78,0x3d,0x22,0x33,0x32,0x35,0x2e,0x31,0x38,0x36,0x34,0x22,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x38,
-0x2e,0x36,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,
-0x3a,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,0x6e,0x74,
-0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x66,0x69,0x6c,
-0x6c,0x3a,0x23,0x63,0x37,0x63,0x37,0x63,0x37,0x22,0x20,0x79,0x3d,0x22,0x35,0x31,
-0x30,0x2e,0x32,0x32,0x31,0x36,0x35,0x22,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x34,
-0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,
-0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
-0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x3b,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x67,0x29,0x3b,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x2e,0x37,0x3b,
-0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x35,0x34,0x35,0x34,0x35,0x22,0x20,0x72,0x78,
-0x3d,0x22,0x32,0x30,0x2e,0x32,0x22,0x20,0x72,0x79,0x3d,0x22,0x32,0x32,0x2e,0x33,
-0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x34,0x34,0x2e,0x36,0x22,0x20,
-0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x31,0x33,0x22,0x20,0x79,0x3d,0x22,0x33,
-0x34,0x38,0x22,0x20,0x78,0x3d,0x22,0x32,0x39,0x35,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,
+0x72,0x61,0x2f,0x3e,0x3c,0x2f,0x66,0x6c,0x6f,0x77,0x52,0x6f,0x6f,0x74,0x3e,0x0a,
+0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6c,0x65,0x74,
+0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,
+0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,0x2e,0x35,0x70,0x78,
+0x3b,0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,
+0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x73,0x61,
+0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,
+0x69,0x67,0x68,0x74,0x3a,0x31,0x32,0x35,0x25,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,
+0x30,0x30,0x30,0x30,0x30,0x30,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,
+0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x20,0x79,0x3d,0x22,
+0x35,0x31,0x30,0x2e,0x32,0x32,0x31,0x36,0x35,0x22,0x20,0x78,0x3d,0x22,0x33,0x32,
+0x35,0x2e,0x31,0x38,0x36,0x34,0x22,0x3e,0x3c,0x74,0x73,0x70,0x61,0x6e,0x20,0x78,
+0x3d,0x22,0x33,0x32,0x35,0x2e,0x31,0x38,0x36,0x34,0x22,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x38,0x2e,
+0x36,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
+0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,0x6e,0x74,0x2d,
+0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x66,0x69,0x6c,0x6c,
+0x3a,0x23,0x63,0x37,0x63,0x37,0x63,0x37,0x22,0x20,0x79,0x3d,0x22,0x35,0x31,0x30,
+0x2e,0x32,0x32,0x31,0x36,0x35,0x22,0x3e,0x53,0x54,0x4d,0x33,0x32,0x46,0x34,0x3c,
+0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0a,0x3c,
 0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,
-0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
-0x3d,0x22,0x37,0x30,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x39,
-0x38,0x2e,0x32,0x22,0x20,0x79,0x3d,0x22,0x32,0x30,0x31,0x22,0x20,0x78,0x3d,0x22,
-0x33,0x30,0x36,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,
-0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,0x37,0x2e,0x36,0x22,
-0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x31,0x2e,0x31,0x22,0x20,0x79,0x3d,
-0x22,0x31,0x38,0x37,0x22,0x20,0x78,0x3d,0x22,0x33,0x31,0x39,0x22,0x2f,0x3e,0x0d,
-0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,
-0x72,0x6f,0x6b,0x65,0x3a,0x23,0x33,0x33,0x33,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,
-0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x36,0x39,0x3b,0x66,0x69,0x6c,0x6c,
-0x3a,0x23,0x34,0x33,0x33,0x35,0x33,0x35,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
-0x3d,0x22,0x37,0x35,0x2e,0x39,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,
-0x35,0x2e,0x33,0x22,0x20,0x79,0x3d,0x22,0x31,0x39,0x39,0x22,0x20,0x78,0x3d,0x22,
-0x33,0x31,0x37,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,
-0x76,0x65,0x6e,0x6f,0x64,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,
-0x6c,0x28,0x23,0x66,0x29,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x35,0x2e,0x33,0x38,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x35,
-0x34,0x35,0x34,0x35,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,
-0x22,0x72,0x6f,0x74,0x61,0x74,0x65,0x28,0x2d,0x39,0x30,0x29,0x22,0x20,0x72,0x78,
-0x3d,0x22,0x31,0x36,0x2e,0x32,0x22,0x20,0x72,0x79,0x3d,0x22,0x31,0x37,0x2e,0x39,
-0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x33,0x35,0x2e,0x38,0x22,0x20,
-0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x39,0x30,0x2e,0x39,0x22,0x20,0x79,0x3d,0x22,
-0x32,0x32,0x39,0x22,0x20,0x78,0x3d,0x22,0x2d,0x32,0x36,0x31,0x22,0x2f,0x3e,0x0d,
-0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
-0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,
-0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x36,
-0x34,0x38,0x20,0x32,0x39,0x35,0x20,0x31,0x30,0x2e,0x31,0x20,0x30,0x2e,0x32,0x36,
-0x35,0x2d,0x31,0x34,0x2e,0x39,0x20,0x33,0x31,0x2e,0x36,0x2d,0x31,0x30,0x2e,0x36,
-0x2d,0x30,0x2e,0x32,0x36,0x35,0x7a,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,
+0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x3b,0x73,0x74,
+0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x67,0x29,0x3b,0x73,0x74,0x72,
+0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x2e,0x37,0x3b,0x66,0x69,
+0x6c,0x6c,0x3a,0x23,0x34,0x35,0x34,0x35,0x34,0x35,0x22,0x20,0x72,0x78,0x3d,0x22,
+0x32,0x30,0x2e,0x32,0x22,0x20,0x72,0x79,0x3d,0x22,0x32,0x32,0x2e,0x33,0x22,0x20,
+0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x34,0x34,0x2e,0x36,0x22,0x20,0x77,0x69,
+0x64,0x74,0x68,0x3d,0x22,0x31,0x31,0x33,0x22,0x20,0x79,0x3d,0x22,0x33,0x34,0x38,
+0x22,0x20,0x78,0x3d,0x22,0x32,0x39,0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,
+0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,
+0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x37,
+0x30,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x39,0x38,0x2e,0x32,
+0x22,0x20,0x79,0x3d,0x22,0x32,0x30,0x31,0x22,0x20,0x78,0x3d,0x22,0x33,0x30,0x36,
+0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,0x37,0x2e,0x36,0x22,0x20,0x77,0x69,0x64,
+0x74,0x68,0x3d,0x22,0x37,0x31,0x2e,0x31,0x22,0x20,0x79,0x3d,0x22,0x31,0x38,0x37,
+0x22,0x20,0x78,0x3d,0x22,0x33,0x31,0x39,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,
+0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
+0x23,0x33,0x33,0x33,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x31,0x2e,0x36,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x33,0x33,
+0x35,0x33,0x35,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x37,0x35,0x2e,
+0x39,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,0x2e,0x33,0x22,0x20,
+0x79,0x3d,0x22,0x31,0x39,0x39,0x22,0x20,0x78,0x3d,0x22,0x33,0x31,0x37,0x22,0x2f,
+0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
+0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,
+0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x75,0x72,0x6c,0x28,0x23,0x66,0x29,0x3b,
+0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x2e,0x33,
+0x38,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x35,0x34,0x35,0x34,0x35,0x22,0x20,
+0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x72,0x6f,0x74,0x61,0x74,
+0x65,0x28,0x2d,0x39,0x30,0x29,0x22,0x20,0x72,0x78,0x3d,0x22,0x31,0x36,0x2e,0x32,
+0x22,0x20,0x72,0x79,0x3d,0x22,0x31,0x37,0x2e,0x39,0x22,0x20,0x68,0x65,0x69,0x67,
+0x68,0x74,0x3d,0x22,0x33,0x35,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x39,0x30,0x2e,0x39,0x22,0x20,0x79,0x3d,0x22,0x32,0x32,0x39,0x22,0x20,0x78,
+0x3d,0x22,0x2d,0x32,0x36,0x31,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,
+0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,
+0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x36,0x34,0x38,0x20,0x32,0x39,0x35,0x20,
+0x31,0x30,0x2e,0x31,0x20,0x30,0x2e,0x32,0x36,0x35,0x2d,0x31,0x34,0x2e,0x39,0x20,
+0x33,0x31,0x2e,0x36,0x2d,0x31,0x30,0x2e,0x36,0x2d,0x30,0x2e,0x32,0x36,0x35,0x7a,
+0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,
+0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,
+0x22,0x6d,0x36,0x34,0x31,0x20,0x32,0x39,0x35,0x2d,0x31,0x35,0x2e,0x37,0x20,0x33,
+0x31,0x2e,0x33,0x2d,0x37,0x2e,0x37,0x20,0x30,0x2e,0x32,0x36,0x35,0x63,0x33,0x2e,
+0x38,0x32,0x2d,0x31,0x2e,0x32,0x33,0x20,0x35,0x2e,0x33,0x2d,0x31,0x2e,0x31,0x20,
+0x37,0x2e,0x31,0x31,0x2d,0x36,0x2e,0x30,0x32,0x20,0x31,0x2e,0x33,0x33,0x2d,0x34,
+0x2e,0x35,0x32,0x20,0x30,0x2e,0x32,0x31,0x37,0x2d,0x38,0x2e,0x39,0x34,0x2d,0x33,
+0x2e,0x35,0x31,0x2d,0x31,0x32,0x2e,0x37,0x2d,0x37,0x2e,0x35,0x34,0x2d,0x37,0x2e,
+0x35,0x33,0x2d,0x37,0x2e,0x38,0x32,0x2d,0x31,0x33,0x2d,0x34,0x2e,0x31,0x35,0x2d,
+0x31,0x32,0x2e,0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,
+0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,
+0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x35,0x38,0x39,0x20,0x33,0x31,0x39,0x20,0x31,
+0x38,0x2e,0x38,0x2d,0x33,0x36,0x2e,0x35,0x68,0x35,0x36,0x2e,0x35,0x6c,0x2d,0x32,
+0x2e,0x31,0x32,0x20,0x35,0x2e,0x34,0x34,0x68,0x2d,0x34,0x35,0x2e,0x38,0x63,0x2d,
+0x31,0x2e,0x32,0x31,0x20,0x30,0x2e,0x30,0x33,0x38,0x32,0x2d,0x34,0x2e,0x30,0x35,
+0x2d,0x30,0x2e,0x30,0x35,0x38,0x31,0x2d,0x37,0x2e,0x36,0x36,0x20,0x32,0x2e,0x34,
+0x39,0x2d,0x31,0x30,0x2e,0x35,0x20,0x37,0x2e,0x37,0x36,0x20,0x36,0x2e,0x31,0x33,
+0x20,0x32,0x30,0x2e,0x33,0x20,0x36,0x2e,0x37,0x34,0x20,0x32,0x36,0x2e,0x36,0x20,
+0x30,0x2e,0x30,0x36,0x38,0x31,0x20,0x30,0x2e,0x38,0x37,0x39,0x2d,0x30,0x2e,0x38,
+0x36,0x35,0x20,0x31,0x2e,0x39,0x39,0x2d,0x31,0x2e,0x38,0x31,0x20,0x32,0x7a,0x22,
+0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,
+0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,
+0x6d,0x34,0x31,0x36,0x20,0x35,0x34,0x33,0x20,0x34,0x2e,0x33,0x34,0x20,0x30,0x2e,
+0x31,0x31,0x34,0x2d,0x36,0x2e,0x34,0x20,0x31,0x33,0x2e,0x36,0x2d,0x34,0x2e,0x35,
+0x37,0x2d,0x30,0x2e,0x31,0x31,0x34,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,
 0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,
 0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,
-0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x36,0x34,0x31,0x20,0x32,0x39,
-0x35,0x2d,0x31,0x35,0x2e,0x37,0x20,0x33,0x31,0x2e,0x33,0x2d,0x37,0x2e,0x37,0x20,
-0x30,0x2e,0x32,0x36,0x35,0x63,0x33,0x2e,0x38,0x32,0x2d,0x31,0x2e,0x32,0x33,0x20,
-0x35,0x2e,0x33,0x2d,0x31,0x2e,0x31,0x20,0x37,0x2e,0x31,0x31,0x2d,0x36,0x2e,0x30,
-0x32,0x20,0x31,0x2e,0x33,0x33,0x2d,0x34,0x2e,0x35,0x32,0x20,0x30,0x2e,0x32,0x31,
-0x37,0x2d,0x38,0x2e,0x39,0x34,0x2d,0x33,0x2e,0x35,0x31,0x2d,0x31,0x32,0x2e,0x37,
-0x2d,0x37,0x2e,0x35,0x34,0x2d,0x37,0x2e,0x35,0x33,0x2d,0x37,0x2e,0x38,0x32,0x2d,
-0x31,0x33,0x2d,0x34,0x2e,0x31,0x35,0x2d,0x31,0x32,0x2e,0x39,0x7a,0x22,0x2f,0x3e,
-0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,
-0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,
-0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,
-0x35,0x38,0x39,0x20,0x33,0x31,0x39,0x20,0x31,0x38,0x2e,0x38,0x2d,0x33,0x36,0x2e,
-0x35,0x68,0x35,0x36,0x2e,0x35,0x6c,0x2d,0x32,0x2e,0x31,0x32,0x20,0x35,0x2e,0x34,
-0x34,0x68,0x2d,0x34,0x35,0x2e,0x38,0x63,0x2d,0x31,0x2e,0x32,0x31,0x20,0x30,0x2e,
-0x30,0x33,0x38,0x32,0x2d,0x34,0x2e,0x30,0x35,0x2d,0x30,0x2e,0x30,0x35,0x38,0x31,
-0x2d,0x37,0x2e,0x36,0x36,0x20,0x32,0x2e,0x34,0x39,0x2d,0x31,0x30,0x2e,0x35,0x20,
-0x37,0x2e,0x37,0x36,0x20,0x36,0x2e,0x31,0x33,0x20,0x32,0x30,0x2e,0x33,0x20,0x36,
-0x2e,0x37,0x34,0x20,0x32,0x36,0x2e,0x36,0x20,0x30,0x2e,0x30,0x36,0x38,0x31,0x20,
-0x30,0x2e,0x38,0x37,0x39,0x2d,0x30,0x2e,0x38,0x36,0x35,0x20,0x31,0x2e,0x39,0x39,
-0x2d,0x31,0x2e,0x38,0x31,0x20,0x32,0x7a,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,
-0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,
-0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,
-0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x34,0x31,0x36,0x20,0x35,
-0x34,0x33,0x20,0x34,0x2e,0x33,0x34,0x20,0x30,0x2e,0x31,0x31,0x34,0x2d,0x36,0x2e,
-0x34,0x20,0x31,0x33,0x2e,0x36,0x2d,0x34,0x2e,0x35,0x37,0x2d,0x30,0x2e,0x31,0x31,
-0x34,0x7a,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,
-0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,
-0x20,0x64,0x3d,0x22,0x6d,0x34,0x31,0x33,0x20,0x35,0x34,0x33,0x2d,0x36,0x2e,0x37,
-0x34,0x20,0x31,0x33,0x2e,0x35,0x2d,0x33,0x2e,0x33,0x31,0x20,0x30,0x2e,0x31,0x31,
-0x34,0x63,0x31,0x2e,0x36,0x34,0x2d,0x30,0x2e,0x35,0x32,0x38,0x20,0x32,0x2e,0x32,
-0x38,0x2d,0x30,0x2e,0x34,0x37,0x34,0x20,0x33,0x2e,0x30,0x36,0x2d,0x32,0x2e,0x35,
-0x39,0x20,0x30,0x2e,0x35,0x37,0x31,0x2d,0x31,0x2e,0x39,0x35,0x20,0x30,0x2e,0x30,
-0x39,0x33,0x34,0x2d,0x33,0x2e,0x38,0x34,0x2d,0x31,0x2e,0x35,0x31,0x2d,0x35,0x2e,
-0x34,0x35,0x2d,0x33,0x2e,0x32,0x35,0x2d,0x33,0x2e,0x32,0x34,0x2d,0x33,0x2e,0x33,
-0x36,0x2d,0x35,0x2e,0x35,0x38,0x2d,0x31,0x2e,0x37,0x39,0x2d,0x35,0x2e,0x35,0x36,
-0x7a,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,
-0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,
-0x64,0x3d,0x22,0x6d,0x33,0x39,0x31,0x20,0x35,0x35,0x33,0x20,0x38,0x2e,0x31,0x31,
-0x2d,0x31,0x35,0x2e,0x37,0x68,0x32,0x34,0x2e,0x33,0x6c,0x2d,0x30,0x2e,0x39,0x31,
-0x34,0x20,0x32,0x2e,0x33,0x34,0x68,0x2d,0x31,0x39,0x2e,0x37,0x63,0x2d,0x30,0x2e,
-0x35,0x32,0x20,0x30,0x2e,0x30,0x31,0x36,0x35,0x2d,0x31,0x2e,0x37,0x34,0x2d,0x30,
-0x2e,0x30,0x32,0x35,0x2d,0x33,0x2e,0x33,0x20,0x31,0x2e,0x30,0x37,0x2d,0x34,0x2e,
-0x35,0x20,0x33,0x2e,0x33,0x34,0x20,0x32,0x2e,0x36,0x34,0x20,0x38,0x2e,0x37,0x32,
-0x20,0x32,0x2e,0x39,0x20,0x31,0x31,0x2e,0x34,0x20,0x30,0x2e,0x30,0x32,0x39,0x33,
-0x20,0x30,0x2e,0x33,0x37,0x38,0x2d,0x30,0x2e,0x33,0x37,0x32,0x20,0x30,0x2e,0x38,
-0x35,0x37,0x2d,0x30,0x2e,0x37,0x38,0x31,0x20,0x30,0x2e,0x38,0x36,0x31,0x7a,0x22,
-0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,
-0x64,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x32,0x65,0x32,0x65,0x32,
-0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
-0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,0x72,0x6c,0x28,0x23,0x64,0x29,
-0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,0x36,0x34,0x20,0x39,0x36,0x37,0x68,0x31,0x33,
-0x2e,0x38,0x76,0x2d,0x31,0x38,0x2e,0x34,0x6c,0x37,0x32,0x2e,0x35,0x20,0x30,0x2e,
-0x32,0x37,0x31,0x20,0x30,0x2e,0x32,0x36,0x35,0x20,0x31,0x39,0x20,0x31,0x30,0x2e,
-0x36,0x2d,0x30,0x2e,0x32,0x37,0x31,0x20,0x30,0x2e,0x32,0x36,0x35,0x20,0x32,0x32,
-0x2e,0x32,0x2d,0x31,0x30,0x2e,0x39,0x20,0x30,0x2e,0x32,0x37,0x31,0x76,0x31,0x30,
-0x68,0x2d,0x37,0x32,0x2e,0x37,0x6c,0x30,0x2e,0x30,0x32,0x36,0x2d,0x39,0x68,0x2d,
-0x31,0x33,0x2e,0x36,0x7a,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,
-0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,
-0x34,0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x35,0x30,0x2e,
-0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x39,0x2e,0x37,0x22,0x20,
-0x79,0x3d,0x22,0x37,0x37,0x33,0x22,0x20,0x78,0x3d,0x22,0x32,0x38,0x37,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,
-0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x30,0x2e,0x34,0x22,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x35,0x30,0x2e,0x33,0x22,0x20,0x79,0x3d,0x22,0x37,0x36,0x38,0x22,
-0x20,0x78,0x3d,0x22,0x32,0x39,0x32,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,
+0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x34,0x31,0x33,0x20,0x35,0x34,
+0x33,0x2d,0x36,0x2e,0x37,0x34,0x20,0x31,0x33,0x2e,0x35,0x2d,0x33,0x2e,0x33,0x31,
+0x20,0x30,0x2e,0x31,0x31,0x34,0x63,0x31,0x2e,0x36,0x34,0x2d,0x30,0x2e,0x35,0x32,
+0x38,0x20,0x32,0x2e,0x32,0x38,0x2d,0x30,0x2e,0x34,0x37,0x34,0x20,0x33,0x2e,0x30,
+0x36,0x2d,0x32,0x2e,0x35,0x39,0x20,0x30,0x2e,0x35,0x37,0x31,0x2d,0x31,0x2e,0x39,
+0x35,0x20,0x30,0x2e,0x30,0x39,0x33,0x34,0x2d,0x33,0x2e,0x38,0x34,0x2d,0x31,0x2e,
+0x35,0x31,0x2d,0x35,0x2e,0x34,0x35,0x2d,0x33,0x2e,0x32,0x35,0x2d,0x33,0x2e,0x32,
+0x34,0x2d,0x33,0x2e,0x33,0x36,0x2d,0x35,0x2e,0x35,0x38,0x2d,0x31,0x2e,0x37,0x39,
+0x2d,0x35,0x2e,0x35,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,
+0x3b,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,
+0x64,0x64,0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,0x39,0x31,0x20,0x35,0x35,0x33,0x20,
+0x38,0x2e,0x31,0x31,0x2d,0x31,0x35,0x2e,0x37,0x68,0x32,0x34,0x2e,0x33,0x6c,0x2d,
+0x30,0x2e,0x39,0x31,0x34,0x20,0x32,0x2e,0x33,0x34,0x68,0x2d,0x31,0x39,0x2e,0x37,
+0x63,0x2d,0x30,0x2e,0x35,0x32,0x20,0x30,0x2e,0x30,0x31,0x36,0x35,0x2d,0x31,0x2e,
+0x37,0x34,0x2d,0x30,0x2e,0x30,0x32,0x35,0x2d,0x33,0x2e,0x33,0x20,0x31,0x2e,0x30,
+0x37,0x2d,0x34,0x2e,0x35,0x20,0x33,0x2e,0x33,0x34,0x20,0x32,0x2e,0x36,0x34,0x20,
+0x38,0x2e,0x37,0x32,0x20,0x32,0x2e,0x39,0x20,0x31,0x31,0x2e,0x34,0x20,0x30,0x2e,
+0x30,0x32,0x39,0x33,0x20,0x30,0x2e,0x33,0x37,0x38,0x2d,0x30,0x2e,0x33,0x37,0x32,
+0x20,0x30,0x2e,0x38,0x35,0x37,0x2d,0x30,0x2e,0x37,0x38,0x31,0x20,0x30,0x2e,0x38,
+0x36,0x31,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,
+0x65,0x6e,0x6f,0x64,0x64,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x32,0x65,
+0x32,0x65,0x32,0x65,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x75,0x72,0x6c,0x28,
+0x23,0x64,0x29,0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,0x36,0x34,0x20,0x39,0x36,0x37,
+0x68,0x31,0x33,0x2e,0x38,0x76,0x2d,0x31,0x38,0x2e,0x34,0x6c,0x37,0x32,0x2e,0x35,
+0x20,0x30,0x2e,0x32,0x37,0x31,0x20,0x30,0x2e,0x32,0x36,0x35,0x20,0x31,0x39,0x20,
+0x31,0x30,0x2e,0x36,0x2d,0x30,0x2e,0x32,0x37,0x31,0x20,0x30,0x2e,0x32,0x36,0x35,
+0x20,0x32,0x32,0x2e,0x32,0x2d,0x31,0x30,0x2e,0x39,0x20,0x30,0x2e,0x32,0x37,0x31,
+0x76,0x31,0x30,0x68,0x2d,0x37,0x32,0x2e,0x37,0x6c,0x30,0x2e,0x30,0x32,0x36,0x2d,
+0x39,0x68,0x2d,0x31,0x33,0x2e,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,
+0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,
+0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x35,
+0x30,0x2e,0x31,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x39,0x2e,0x37,
+0x22,0x20,0x79,0x3d,0x22,0x37,0x37,0x33,0x22,0x20,0x78,0x3d,0x22,0x32,0x38,0x37,
+0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x61,0x34,0x61,0x34,0x61,0x34,0x22,0x20,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x36,0x30,0x2e,0x34,0x22,0x20,0x77,0x69,0x64,
+0x74,0x68,0x3d,0x22,0x35,0x30,0x2e,0x33,0x22,0x20,0x79,0x3d,0x22,0x37,0x36,0x38,
+0x22,0x20,0x78,0x3d,0x22,0x32,0x39,0x32,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,
 0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
 0x23,0x33,0x33,0x33,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
 0x68,0x3a,0x31,0x2e,0x31,0x39,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x33,0x33,
 0x35,0x33,0x35,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x35,0x33,0x2e,
 0x37,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x35,0x33,0x2e,0x33,0x22,0x20,
 0x79,0x3d,0x22,0x37,0x37,0x32,0x22,0x20,0x78,0x3d,0x22,0x32,0x39,0x31,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,
-0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x35,0x36,0x65,0x64,0x34,0x35,0x22,0x20,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,0x79,0x3d,0x22,0x36,0x38,0x36,0x22,0x20,
-0x78,0x3d,0x22,0x33,0x32,0x35,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,
-0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,
-0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,
-0x33,0x33,0x66,0x33,0x66,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,
-0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,
-0x79,0x3d,0x22,0x36,0x38,0x35,0x22,0x20,0x78,0x3d,0x22,0x34,0x30,0x37,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,
-0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x65,0x36,0x62,0x64,0x34,0x63,0x22,0x20,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,0x79,0x3d,0x22,0x36,0x34,0x34,0x22,0x20,
-0x78,0x3d,0x22,0x33,0x36,0x36,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,
+0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,
+0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,0x74,
+0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,0x3b,
+0x66,0x69,0x6c,0x6c,0x3a,0x23,0x35,0x36,0x65,0x64,0x34,0x35,0x22,0x20,0x68,0x65,
+0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,
+0x68,0x3d,0x22,0x33,0x30,0x22,0x20,0x79,0x3d,0x22,0x36,0x38,0x36,0x22,0x20,0x78,
+0x3d,0x22,0x33,0x32,0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,
+0x35,0x33,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x2e,0x34,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x33,0x33,
+0x66,0x33,0x66,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,
+0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,0x79,0x3d,
+0x22,0x36,0x38,0x35,0x22,0x20,0x78,0x3d,0x22,0x34,0x30,0x37,0x22,0x2f,0x3e,0x0a,
+0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,
+0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,
+0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,0x3b,0x66,0x69,
+0x6c,0x6c,0x3a,0x23,0x65,0x36,0x62,0x64,0x34,0x63,0x22,0x20,0x68,0x65,0x69,0x67,
+0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,
+0x22,0x33,0x30,0x22,0x20,0x79,0x3d,0x22,0x36,0x34,0x34,0x22,0x20,0x78,0x3d,0x22,
+0x33,0x36,0x36,0x22,0x2f,0x3e,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x35,0x33,
+0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,
+0x2e,0x34,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,0x36,0x34,0x39,0x65,
+0x63,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x2e,0x38,0x22,
+0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,0x79,0x3d,0x22,0x37,
+0x32,0x38,0x22,0x20,0x78,0x3d,0x22,0x33,0x36,0x38,0x22,0x2f,0x3e,0x0a,0x3c,0x72,
+0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,
+0x65,0x3a,0x23,0x62,0x35,0x62,0x35,0x62,0x35,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,
+0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,0x39,0x3b,0x66,0x69,0x6c,0x6c,
+0x3a,0x23,0x33,0x38,0x33,0x38,0x33,0x38,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
+0x3d,0x22,0x35,0x30,0x2e,0x36,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x33,
+0x31,0x2e,0x31,0x22,0x20,0x79,0x3d,0x22,0x36,0x36,0x37,0x22,0x20,0x78,0x3d,0x22,
+0x33,0x36,0x37,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,
+0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,
+0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,0x3d,0x22,
+0x6d,0x33,0x38,0x39,0x20,0x37,0x33,0x37,0x20,0x33,0x37,0x2e,0x35,0x20,0x36,0x39,
+0x2e,0x38,0x68,0x33,0x34,0x2e,0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,
 0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,
-0x30,0x30,0x35,0x33,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x2e,0x34,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x34,
-0x36,0x34,0x39,0x65,0x63,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,
-0x32,0x2e,0x38,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x30,0x22,0x20,
-0x79,0x3d,0x22,0x37,0x32,0x38,0x22,0x20,0x78,0x3d,0x22,0x33,0x36,0x38,0x22,0x2f,
-0x3e,0x0d,0x0a,0x3c,0x72,0x65,0x63,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x62,0x35,0x62,0x35,0x62,0x35,0x3b,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x2e,0x34,0x39,
-0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x33,0x38,0x33,0x38,0x33,0x38,0x22,0x20,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x35,0x30,0x2e,0x36,0x22,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x33,0x31,0x2e,0x31,0x22,0x20,0x79,0x3d,0x22,0x36,0x36,0x37,
-0x22,0x20,0x78,0x3d,0x22,0x33,0x36,0x37,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,
-0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,
-0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,
-0x65,0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,0x38,0x39,0x20,0x37,0x33,0x37,0x20,0x33,
-0x37,0x2e,0x35,0x20,0x36,0x39,0x2e,0x38,0x68,0x33,0x34,0x2e,0x35,0x22,0x2f,0x3e,
-0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,
-0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,
-0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,
-0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,0x3d,0x22,0x6d,0x34,0x32,0x31,0x20,
-0x36,0x35,0x35,0x20,0x31,0x31,0x36,0x2d,0x31,0x31,0x36,0x68,0x31,0x39,0x34,0x22,
-0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,
-0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,
-0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,0x3d,0x22,0x6d,0x32,0x33,
-0x34,0x20,0x36,0x38,0x33,0x68,0x2d,0x32,0x32,0x36,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,
-0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6c,0x65,0x74,0x74,
-0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,0x2e,0x35,0x70,0x78,0x3b,
-0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,
-0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x73,0x61,0x6e,
-0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x31,0x32,0x35,0x25,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x30,
-0x30,0x30,0x30,0x30,0x30,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,
-0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x20,0x79,0x3d,0x22,0x38,
-0x31,0x37,0x2e,0x35,0x39,0x33,0x39,0x39,0x22,0x20,0x78,0x3d,0x22,0x34,0x36,0x34,
-0x2e,0x32,0x37,0x33,0x37,0x37,0x22,0x3e,0x3c,0x74,0x73,0x70,0x61,0x6e,0x20,0x78,
-0x3d,0x22,0x34,0x36,0x34,0x2e,0x32,0x37,0x33,0x37,0x37,0x22,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x39,
-0x2e,0x37,0x70,0x78,0x22,0x20,0x79,0x3d,0x22,0x38,0x31,0x37,0x2e,0x35,0x39,0x33,
-0x39,0x39,0x22,0x3e,0x45,0x74,0x68,0x20,0x4c,0x69,0x6e,0x6b,0x3c,0x2f,0x74,0x73,
-0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6c,0x65,0x74,0x74,0x65,0x72,
-0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,
-0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,0x2e,0x35,0x70,0x78,0x3b,0x77,0x6f,
-0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,0x6c,
+0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,
+0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,
+0x20,0x64,0x3d,0x22,0x6d,0x34,0x32,0x31,0x20,0x36,0x35,0x35,0x20,0x31,0x31,0x36,
+0x2d,0x31,0x31,0x36,0x68,0x31,0x39,0x34,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,
+0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,
+0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,
+0x22,0x20,0x64,0x3d,0x22,0x6d,0x32,0x33,0x34,0x20,0x36,0x38,0x33,0x68,0x2d,0x32,
+0x32,0x36,0x22,0x2f,0x3e,0x0a,0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,
+0x67,0x3a,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x35,0x39,0x2e,0x35,0x70,0x78,0x3b,0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,
+0x69,0x6e,0x67,0x3a,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
+0x69,0x6c,0x79,0x3a,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x6c,
 0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x32,0x35,0x25,0x3b,
-0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x73,0x61,0x6e,0x73,
-0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x30,0x30,0x30,
-0x30,0x30,0x30,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,0x3d,0x22,
-0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x20,0x79,0x3d,0x22,0x39,0x30,0x31,
-0x2e,0x32,0x31,0x30,0x32,0x37,0x22,0x20,0x78,0x3d,0x22,0x35,0x31,0x33,0x2e,0x38,
-0x35,0x35,0x35,0x33,0x22,0x3e,0x3c,0x74,0x73,0x70,0x61,0x6e,0x20,0x78,0x3d,0x22,
-0x35,0x31,0x33,0x2e,0x38,0x35,0x35,0x35,0x33,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x39,0x2e,0x37,
-0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6e,0x63,0x68,0x6f,0x72,0x3a,0x6d,
-0x69,0x64,0x64,0x6c,0x65,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,
-0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x20,0x79,0x3d,0x22,0x39,0x30,0x31,0x2e,
-0x32,0x31,0x30,0x32,0x37,0x22,0x3e,0x55,0x53,0x42,0x20,0x64,0x65,0x76,0x69,0x63,
-0x65,0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x74,0x73,0x70,0x61,0x6e,0x20,
-0x78,0x3d,0x22,0x35,0x31,0x33,0x2e,0x38,0x35,0x35,0x35,0x33,0x22,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,
-0x39,0x2e,0x37,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6e,0x63,0x68,0x6f,
-0x72,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,
-0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x20,0x79,0x3d,0x22,0x39,
-0x33,0x38,0x2e,0x33,0x37,0x30,0x39,0x37,0x22,0x3e,0x69,0x6e,0x74,0x65,0x72,0x66,
-0x61,0x63,0x65,0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,
-0x74,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,0x72,
-0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x2e,0x38,0x33,0x3b,0x66,
-0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,0x39,
-0x36,0x20,0x39,0x36,0x35,0x76,0x2d,0x35,0x33,0x2e,0x34,0x68,0x31,0x35,0x2e,0x35,
-0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,0x30,0x3b,0x73,0x74,
-0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x2e,0x34,0x36,0x3b,
-0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,0x3d,0x22,0x6d,0x33,
-0x36,0x35,0x20,0x36,0x38,0x30,0x2d,0x31,0x31,0x34,0x2d,0x31,0x31,0x34,0x68,0x2d,
-0x32,0x34,0x33,0x22,0x2f,0x3e,0x0d,0x0a,0x3c,0x2f,0x67,0x3e,0x0d,0x0a,0x3c,0x67,
-0x3e,0x0d,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x66,0x69,0x6c,0x6c,0x2d,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x38,0x33,
-0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,0x6c,
-0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,0x64,
-0x3d,0x22,0x6d,0x34,0x32,0x2e,0x38,0x20,0x33,0x31,0x35,0x63,0x32,0x32,0x38,0x20,
-0x37,0x20,0x35,0x33,0x33,0x2d,0x34,0x20,0x36,0x37,0x30,0x2d,0x39,0x36,0x6c,0x2d,
-0x37,0x2d,0x32,0x31,0x32,0x2d,0x36,0x36,0x36,0x2d,0x31,0x2e,0x36,0x33,0x7a,0x22,
-0x2f,0x3e,0x0d,0x0a,0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x66,0x69,0x6c,0x6c,0x3a,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x22,0x20,0x78,0x6d,
+0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,
+0x65,0x22,0x20,0x79,0x3d,0x22,0x38,0x31,0x37,0x2e,0x35,0x39,0x33,0x39,0x39,0x22,
+0x20,0x78,0x3d,0x22,0x34,0x36,0x34,0x2e,0x32,0x37,0x33,0x37,0x37,0x22,0x3e,0x3c,
+0x74,0x73,0x70,0x61,0x6e,0x20,0x78,0x3d,0x22,0x34,0x36,0x34,0x2e,0x32,0x37,0x33,
+0x37,0x37,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
+0x73,0x69,0x7a,0x65,0x3a,0x32,0x39,0x2e,0x37,0x70,0x78,0x22,0x20,0x79,0x3d,0x22,
+0x38,0x31,0x37,0x2e,0x35,0x39,0x33,0x39,0x39,0x22,0x3e,0x45,0x74,0x68,0x20,0x4c,
+0x69,0x6e,0x6b,0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,
+0x74,0x3e,0x0a,0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
+0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,
+0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,0x2e,
+0x35,0x70,0x78,0x3b,0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,
+0x3a,0x30,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,
+0x3a,0x31,0x32,0x35,0x25,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,
+0x79,0x3a,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x69,0x6c,
+0x6c,0x3a,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,
+0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,0x20,
+0x79,0x3d,0x22,0x39,0x30,0x31,0x2e,0x32,0x31,0x30,0x32,0x37,0x22,0x20,0x78,0x3d,
+0x22,0x35,0x31,0x33,0x2e,0x38,0x35,0x35,0x35,0x33,0x22,0x3e,0x3c,0x74,0x73,0x70,
+0x61,0x6e,0x20,0x78,0x3d,0x22,0x35,0x31,0x33,0x2e,0x38,0x35,0x35,0x35,0x33,0x22,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+0x65,0x3a,0x32,0x39,0x2e,0x37,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6e,
+0x63,0x68,0x6f,0x72,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x3b,0x74,0x65,0x78,0x74,
+0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x22,0x20,0x79,
+0x3d,0x22,0x39,0x30,0x31,0x2e,0x32,0x31,0x30,0x32,0x37,0x22,0x3e,0x55,0x53,0x42,
+0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x74,0x73,0x70,0x61,0x6e,0x20,0x78,0x3d,0x22,0x35,0x31,0x33,0x2e,0x38,0x35,0x35,
+0x35,0x33,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,
+0x73,0x69,0x7a,0x65,0x3a,0x32,0x39,0x2e,0x37,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,
+0x2d,0x61,0x6e,0x63,0x68,0x6f,0x72,0x3a,0x6d,0x69,0x64,0x64,0x6c,0x65,0x3b,0x74,
+0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,
+0x22,0x20,0x79,0x3d,0x22,0x39,0x33,0x38,0x2e,0x33,0x37,0x30,0x39,0x37,0x22,0x3e,
+0x69,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3c,0x2f,0x74,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,
+0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,
+0x2e,0x38,0x33,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,
+0x3d,0x22,0x6d,0x33,0x39,0x36,0x20,0x39,0x36,0x35,0x76,0x2d,0x35,0x33,0x2e,0x34,
+0x68,0x31,0x35,0x2e,0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,
+0x74,0x79,0x6c,0x65,0x3d,0x22,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3a,0x23,0x30,0x30,
+0x30,0x3b,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,
+0x2e,0x34,0x36,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x64,
+0x3d,0x22,0x6d,0x33,0x36,0x35,0x20,0x36,0x38,0x30,0x2d,0x31,0x31,0x34,0x2d,0x31,
+0x31,0x34,0x68,0x2d,0x32,0x34,0x33,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,
+0x3c,0x67,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x69,0x6c,0x6c,0x2d,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x38,
+0x33,0x37,0x3b,0x66,0x69,0x6c,0x6c,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x69,0x6c,
+0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3a,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,
+0x64,0x3d,0x22,0x6d,0x34,0x32,0x2e,0x38,0x20,0x33,0x31,0x35,0x63,0x32,0x32,0x38,
+0x20,0x37,0x20,0x35,0x33,0x33,0x2d,0x34,0x20,0x36,0x37,0x30,0x2d,0x39,0x36,0x6c,
+0x2d,0x37,0x2d,0x32,0x31,0x32,0x2d,0x36,0x36,0x36,0x2d,0x31,0x2e,0x36,0x33,0x7a,
+0x22,0x2f,0x3e,0x0a,0x3c,0x74,0x65,0x78,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
 0x22,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,
 0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x35,0x39,
 0x2e,0x35,0x70,0x78,0x3b,0x77,0x6f,0x72,0x64,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,
@@ -535,18 +745,18 @@ static const unsigned char data__img_discovery_svg[] = {
 0x33,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
 0x41,0x72,0x69,0x61,0x6c,0x22,0x20,0x79,0x3d,0x22,0x32,0x33,0x30,0x2e,0x39,0x38,
 0x35,0x32,0x34,0x22,0x3e,0x44,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x79,0x3c,0x2f,
-0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x67,0x3e,0x0d,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0d,0x0a,};
+0x74,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0a,0x3c,0x2f,
+0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a,};
 
-static const unsigned int dummy_align__404_html = 1;
+static const unsigned int dummy_align__404_html = 2;
 static const unsigned char data__404_html[] = {
 /* /404.html (10 chars) */
 0x2f,0x34,0x30,0x34,0x2e,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 404 File not found
+/* "HTTP/1.1 404 File not found
 " (29 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
 0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x0d,0x0a,
 /* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
@@ -554,6 +764,10 @@ static const unsigned char data__404_html[] = {
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 119
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x31,0x39,0x0d,0x0a,
 /* "Content-type: text/html
 
 " (27 bytes) */
@@ -569,15 +783,172 @@ static const unsigned char data__404_html[] = {
 0x44,0x3c,0x2f,0x48,0x31,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,
 0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0a,};
 
-static const unsigned int dummy_align__index_html = 2;
+#if HTTPD_FS_ETAG
+static const char etag__index_html__gz[] = "\"75aa4d66-5f1\"";
+static const char not_modified__index_html__gz[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"75aa4d66-5f1\"\r\n"
+"Cache-Control: no-cache\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__index_html__gz = 3;
+static const unsigned char data__index_html__gz[] = {
+/* /index.html (12 chars) */
+0x2f,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
+
+/* HTTP header */
+/* "HTTP/1.1 200 OK
+" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+" (63 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
+0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
+0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
+0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 1521
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x35,0x32,0x31,0x0d,0x0a,
+/* "ETag: "75aa4d66-5f1"
+Cache-Control: no-cache
+" (47 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x37,0x35,0x61,0x61,0x34,0x64,0x36,0x36,0x2d,
+0x35,0x66,0x31,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,
+0x72,0x6f,0x6c,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "Content-Encoding: gzip
+Vary: Accept-Encoding
+" (47 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,
+0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-type: text/html
+
+" (27 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1521 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x9d,0x57,0x59,0x73,0xda,0x30,
+0x10,0x7e,0x86,0x5f,0xa1,0x78,0x32,0xc5,0x34,0xc1,0x86,0x5e,0x33,0x25,0x86,0x4c,
+0x0f,0xa6,0x4d,0x27,0x3d,0x26,0xa4,0xed,0x43,0x26,0x0f,0xb2,0x2d,0x40,0x89,0xb1,
+0x5c,0x49,0xe6,0x48,0x86,0xff,0xde,0x5d,0xf9,0x00,0x13,0x42,0x3a,0xcd,0x4c,0x8c,
+0xbc,0xc7,0xa7,0xd5,0x5e,0x5a,0x7b,0x13,0x3d,0x8d,0xfa,0x75,0x6f,0xc2,0x68,0xd8,
+0xf7,0x34,0xd7,0x11,0xeb,0x0f,0x16,0x74,0x9a,0x44,0xcc,0x73,0xb3,0xd7,0x7a,0xdd,
+0x53,0x7a,0x89,0x0b,0x47,0x86,0x7c,0x46,0xee,0xeb,0xb5,0x09,0xe3,0xe3,0x89,0xee,
+0x92,0x17,0xaf,0xda,0xc9,0xe2,0xa4,0x5e,0x9b,0xf3,0x50,0x4f,0xba,0xa4,0xf3,0x3a,
+0x7b,0xf5,0x85,0x0c,0x99,0x6c,0x49,0x1a,0xf2,0x54,0x75,0xc9,0x6b,0x24,0x12,0xf8,
+0x6b,0x4d,0xc5,0x5d,0xeb,0x21,0x73,0xf3,0x3f,0x17,0x9c,0x33,0xff,0x96,0xeb,0x27,
+0x65,0xf3,0x9d,0x60,0x67,0xa0,0x28,0x11,0xf1,0x10,0x68,0x21,0x57,0x49,0x44,0x97,
+0x5d,0xa2,0xa9,0x1f,0xb1,0x56,0xc0,0xa2,0x08,0xa8,0x33,0x26,0x35,0x0f,0x68,0xd4,
+0xa2,0x11,0x1f,0xc7,0x5d,0x32,0xe5,0x61,0x18,0x31,0x60,0x24,0x34,0x0c,0x79,0x3c,
+0xce,0xcd,0xac,0x69,0xb6,0xd0,0x85,0x4c,0xc0,0x62,0xcd,0xe4,0x49,0x7d,0x55,0xf7,
+0xdc,0xdc,0x05,0xe0,0x8b,0x40,0xf2,0x44,0x13,0x25,0x83,0x9e,0xe5,0xde,0xb1,0x44,
+0x0b,0x67,0xca,0x63,0xe7,0x46,0x59,0x7d,0x90,0x32,0xcc,0xb5,0x18,0xac,0x66,0x54,
+0x92,0x44,0x44,0x11,0xec,0x31,0x90,0x52,0x48,0xd2,0x23,0x23,0x1a,0x29,0xd8,0x1a,
+0x39,0x4a,0x4b,0x46,0xa7,0x40,0x8b,0x53,0x34,0xd3,0x90,0x8c,0xf7,0x15,0xd0,0xda,
+0x27,0xf5,0xfa,0x28,0x8d,0x03,0xcd,0x45,0x4c,0x42,0xf1,0x33,0x09,0xa9,0x66,0xb6,
+0xd2,0xf0,0x6c,0xd6,0x21,0x0c,0xa1,0x08,0xd2,0x29,0xd8,0xe8,0x8c,0x99,0x1e,0x44,
+0x0c,0x97,0xef,0x97,0x67,0xa1,0x6d,0x85,0x6c,0x66,0xa4,0xac,0xa6,0xc3,0xe3,0x98,
+0xc9,0xcf,0x97,0x5f,0xcf,0x01,0xaf,0xd1,0x20,0x47,0xc4,0xae,0x18,0x73,0x4a,0x1a,
+0xde,0x48,0xc4,0x9a,0x04,0x22,0x12,0xb2,0x67,0x49,0x16,0x5a,0xfd,0x73,0x1e,0xdf,
+0x12,0x86,0x7c,0xcf,0x45,0x66,0xbf,0x41,0xba,0xa4,0xf1,0x41,0x00,0x54,0xa0,0x59,
+0xd8,0x68,0x82,0x9f,0xf8,0xa8,0x8a,0xd4,0x24,0x92,0xe9,0x54,0xc6,0x60,0xf2,0xe3,
+0x76,0xa9,0xa5,0x82,0x20,0xdc,0xee,0x34,0xcb,0x18,0xec,0xe4,0x12,0xc4,0x25,0x9d,
+0x76,0xbb,0xdd,0x04,0x46,0x83,0x28,0x16,0x88,0x38,0x54,0x8d,0x93,0x3d,0xc8,0x11,
+0x0b,0xc7,0x00,0x1b,0x4c,0x58,0x70,0xcb,0x42,0x00,0xcd,0xe0,0x80,0xac,0x9c,0x31,
+0xe9,0xf5,0x48,0xe7,0x09,0x6d,0xf1,0x98,0xb6,0xf8,0x17,0x6d,0xf9,0x98,0xb6,0x7c,
+0x52,0xdb,0xd7,0xf1,0xb6,0x3f,0x8c,0x3e,0x78,0x7c,0xed,0x16,0x3f,0xd5,0x1a,0x72,
+0x00,0xa2,0x95,0x48,0xa6,0x14,0xc4,0x00,0x23,0x12,0x0b,0x4d,0x8a,0xf7,0x22,0x26,
+0x59,0x42,0x6d,0x46,0xc3,0xe4,0x14,0xc2,0xd2,0x20,0x20,0x8b,0x0c,0x36,0x43,0x05,
+0xc2,0x55,0xfb,0x1a,0x7d,0xec,0xf9,0xb2,0x8f,0xfe,0x45,0x39,0x85,0x04,0x94,0x5d,
+0x6e,0xcb,0x76,0x1e,0x97,0xbd,0xdb,0x96,0x7d,0x51,0x91,0x7d,0xf4,0xf4,0x20,0xba,
+0x75,0x7a,0x85,0xf5,0x96,0x15,0x02,0x8b,0xc3,0x21,0x02,0x5e,0xb0,0x3f,0x29,0x53,
+0x1a,0x2b,0xa7,0xa8,0x06,0xdb,0x14,0xc0,0xa1,0x43,0x6f,0xe8,0xc2,0x86,0x55,0x2d,
+0x95,0x51,0x97,0x58,0x6e,0x66,0x40,0x30,0xe6,0xd6,0x31,0x10,0x35,0x9f,0x32,0x91,
+0x62,0xa3,0x82,0x64,0x42,0x82,0x4a,0x83,0x00,0xfc,0xd5,0x2d,0x81,0x6c,0x28,0x29,
+0xda,0x04,0x0e,0x62,0xd4,0x14,0xd3,0x97,0x99,0x8a,0xbd,0xbd,0xf9,0x31,0x62,0xa0,
+0x93,0x6b,0xb5,0xdd,0xd5,0x0c,0x8c,0xb2,0x44,0x0d,0x28,0x92,0x56,0xb8,0xa9,0xa9,
+0xa4,0xff,0xda,0xd2,0xd4,0xc0,0xae,0x3d,0xb5,0x4c,0xf7,0x6e,0x89,0x6f,0x97,0xcb,
+0x04,0x92,0xc8,0xba,0x51,0x22,0xb6,0xea,0xb5,0x55,0xd3,0xf8,0xb5,0x74,0x60,0xa0,
+0x23,0xa3,0x23,0xfc,0x1b,0xe3,0xca,0x75,0xee,0x90,0x67,0xcf,0xf2,0xb6,0xe4,0xc0,
+0x23,0x5c,0x1a,0x93,0x4c,0x1a,0x83,0xd1,0x68,0xb3,0xfb,0x9c,0xe8,0x09,0x23,0x31,
+0x9b,0x67,0xf1,0x86,0xde,0x31,0x85,0x7e,0xe5,0x53,0xa8,0x5b,0xaa,0x08,0x8d,0x09,
+0x9b,0x41,0x80,0xc9,0x73,0x17,0x3d,0x9e,0x21,0xe1,0xd9,0xec,0x43,0x27,0xa1,0x92,
+0x4e,0xcb,0x7d,0x8d,0xbd,0x45,0xa2,0xd6,0x56,0xbb,0xe2,0x09,0x66,0x96,0xd1,0x44,
+0xb5,0x2e,0xc9,0x95,0xf7,0x44,0x93,0xdc,0x93,0x2d,0xb7,0x90,0xfd,0x4e,0x81,0x03,
+0x41,0x1e,0xb2,0x88,0x49,0x38,0x08,0x74,0xfc,0xb2,0x05,0x53,0x4d,0x5e,0xb5,0xdb,
+0xe4,0x33,0x64,0x37,0x8f,0x75,0xe7,0x0d,0x59,0x1c,0x93,0xe5,0x31,0xb9,0x03,0xff,
+0x73,0x23,0x00,0x47,0x2c,0x3d,0x2a,0x12,0x16,0x0f,0xcd,0x69,0xb3,0xe4,0xc4,0x14,
+0x9e,0x63,0x91,0xa0,0xa3,0x7e,0x33,0x7f,0x28,0xa0,0x3d,0x68,0xdb,0x9a,0xab,0xae,
+0xeb,0x5a,0x50,0x1d,0x91,0x08,0x28,0x6a,0x3a,0x13,0x01,0xc9,0x7d,0x04,0xa7,0x9d,
+0x2b,0x0b,0x7d,0x32,0x57,0x8e,0xcf,0x63,0x2a,0x97,0x68,0x2d,0x00,0x58,0x54,0x4a,
+0xba,0xf4,0xd3,0xd1,0x88,0x49,0x2b,0xe3,0x8b,0x18,0xb7,0xdb,0xa8,0x08,0x1b,0x8f,
+0x5d,0xde,0x26,0x73,0x05,0x67,0x2e,0x24,0x21,0x38,0x8a,0x8e,0xd9,0xa6,0x30,0xcb,
+0x43,0x89,0x36,0x62,0xf9,0x66,0x46,0x9e,0xe1,0x19,0xdf,0xe1,0x5e,0x36,0x73,0xca,
+0x84,0x42,0x19,0xdc,0x09,0xe4,0xa0,0xa7,0xc5,0x63,0x3d,0x21,0x2d,0xf2,0x12,0x39,
+0x85,0x9b,0x8e,0x2a,0x4c,0x37,0x63,0xfe,0x7b,0xc9,0x63,0x1e,0x6f,0x36,0x27,0x6c,
+0x1f,0x71,0xd9,0x3e,0x36,0x3a,0x91,0x61,0xc0,0x6f,0xa7,0xc2,0xbc,0xab,0x32,0xab,
+0x8d,0xa7,0x74,0x42,0x10,0x09,0x55,0x71,0x41,0xee,0x81,0xad,0x0b,0xb8,0x52,0x90,
+0xeb,0x88,0xae,0x4b,0x71,0x55,0x2d,0x23,0x35,0x11,0xf3,0x0b,0x4c,0xb4,0xfd,0x17,
+0xb2,0x7c,0x78,0x19,0xe7,0x1b,0x9f,0x96,0xc9,0x66,0xae,0xba,0x6c,0xed,0x2a,0xd3,
+0xdf,0x4d,0x97,0xdd,0x9c,0x06,0x56,0x95,0x79,0x20,0xb8,0xc0,0xf2,0xb4,0xcb,0xf2,
+0x9d,0xf3,0x38,0x14,0x73,0xa7,0x4c,0xb5,0xfc,0x84,0x9b,0x79,0x99,0x1f,0xf0,0x0c,
+0xe7,0x9a,0x19,0x8d,0xec,0xc2,0xfc,0x8d,0xf3,0x65,0x58,0x07,0x39,0xd8,0x00,0x2b,
+0x79,0x28,0x52,0x19,0x14,0x29,0xb3,0xdd,0xa5,0xec,0x07,0x55,0x9c,0xf7,0x07,0x18,
+0x42,0x78,0xc0,0x48,0x92,0xaa,0x09,0xd8,0xcf,0xb5,0xca,0xba,0xc5,0xb1,0x61,0xfa,
+0x52,0xcc,0x15,0x54,0x9a,0xc4,0xbb,0x1d,0xc7,0x0a,0xe8,0x1f,0x4b,0x14,0x62,0xd1,
+0xc8,0x34,0x0e,0xcc,0x3a,0xd3,0x46,0x8a,0x0a,0xda,0xb0,0xc4,0xb6,0xdc,0x8c,0x65,
+0xaa,0x25,0x5b,0xee,0xcf,0xf3,0xc7,0x5a,0x76,0xd9,0x27,0xbe,0x0c,0xbf,0x7f,0xc3,
+0xee,0xa4,0x58,0x91,0xfa,0x79,0xb0,0xd7,0xf0,0xac,0x50,0x7e,0x02,0xbc,0xe8,0xcd,
+0x25,0x36,0x66,0xd6,0x3a,0x75,0x0e,0xed,0x22,0x4b,0x9a,0x59,0x7f,0xb5,0xd7,0x91,
+0x04,0xa9,0x7a,0x39,0x44,0x12,0x5c,0x9b,0xb9,0xbc,0xee,0xf9,0x22,0x5c,0x12,0x7f,
+0x9c,0x0f,0x69,0xf3,0x09,0x87,0x74,0x22,0x38,0xaa,0xf6,0x2c,0x3f,0x82,0xbe,0x6b,
+0x81,0x4c,0x36,0xad,0xc2,0x10,0x8f,0x63,0x2f,0xc1,0xb1,0x57,0x25,0x34,0x00,0xc3,
+0x7a,0x56,0x1b,0xf9,0x5a,0xf6,0xeb,0x35,0x4f,0x03,0x5c,0xad,0xe6,0xe1,0x20,0x1f,
+0x44,0x54,0x29,0x18,0xf9,0x60,0x6d,0x21,0xb1,0xe6,0xf9,0xfd,0x77,0x9b,0x7d,0xd0,
+0x73,0xfd,0x3e,0x16,0x92,0xe1,0xa1,0x06,0x0f,0x7b,0xa6,0x7c,0x61,0xd2,0x85,0xd7,
+0x2a,0xdd,0xa4,0x78,0xce,0x28,0x95,0xfc,0xfe,0x0f,0x08,0x3f,0xc9,0xc6,0x97,0x9d,
+0x70,0x38,0xfe,0x54,0xb5,0x0a,0x6c,0xf8,0xfe,0x08,0x0b,0x8b,0xbd,0x83,0x56,0xeb,
+0x0a,0xf2,0x32,0x82,0xdb,0xe6,0x6c,0x40,0xde,0x92,0x6b,0xe0,0x0c,0x85,0x94,0xd0,
+0x8d,0xcf,0x06,0xde,0xdb,0x22,0x9f,0x32,0x88,0x50,0x40,0xc2,0xe1,0x70,0xa4,0xd2,
+0x24,0x11,0x52,0x93,0xe1,0xaf,0x4f,0x00,0x71,0x05,0x99,0xcb,0x47,0xd7,0xad,0xd6,
+0x1a,0xef,0xa0,0x00,0xbc,0xee,0x13,0xa4,0xd7,0x3c,0x3e,0x1d,0x93,0xec,0xf3,0xa6,
+0x67,0x41,0xef,0xb7,0xb2,0x41,0xdf,0x71,0x81,0x0e,0x76,0xa9,0x40,0xc0,0x87,0xc4,
+0xd2,0x51,0xb3,0xb1,0x95,0xa1,0x90,0x0a,0x6e,0xd5,0xea,0x3d,0x7e,0xfe,0x98,0x15,
+0x87,0xa9,0x88,0x9d,0x7e,0x29,0x47,0xf8,0x87,0x2e,0xcd,0x75,0x71,0xb8,0xd9,0xa9,
+0x5a,0x4c,0xd9,0x0f,0x35,0x7f,0x62,0xc9,0x9d,0x0f,0x3e,0xaa,0x8a,0x1e,0x8f,0x93,
+0x54,0x1b,0x4d,0x33,0x45,0x13,0x0d,0xb7,0x4e,0xcf,0x32,0xe3,0xac,0x2f,0x16,0x16,
+0xc1,0xe6,0x09,0x78,0x40,0x82,0x99,0xe1,0x1e,0xbe,0x94,0x6c,0x3d,0xe1,0xaa,0x9c,
+0x77,0x4f,0x49,0x07,0x9a,0x55,0xbb,0xb9,0x6a,0x5a,0xfd,0xb1,0x64,0x2c,0xde,0x0d,
+0x2c,0x9e,0x02,0x16,0xfb,0x80,0x85,0xa4,0xf1,0x98,0xed,0x46,0x96,0x4f,0x21,0xcb,
+0x7d,0xc8,0xf0,0xc5,0xb3,0x33,0xf1,0xe0,0x29,0xcd,0x13,0xcb,0x09,0x17,0x79,0x7d,
+0xc1,0x0a,0xab,0x11,0x7f,0xb3,0x6f,0xe7,0xbf,0xf7,0xa2,0x33,0xe5,0x43,0x0f,0x00,
+0x00,};
+
+#if HTTPD_FS_ETAG
+static const char etag__index_html[] = "\"e533a2f7-f43\"";
+static const char not_modified__index_html[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"e533a2f7-f43\"\r\n"
+"Cache-Control: no-cache\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__index_html = 4;
 static const unsigned char data__index_html[] = {
 /* /index.html (12 chars) */
 0x2f,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.1 200 OK
 " (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
 /* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
@@ -585,12 +956,26 @@ static const unsigned char data__index_html[] = {
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 3907
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x33,0x39,0x30,0x37,0x0d,0x0a,
+/* "ETag: "e533a2f7-f43"
+Cache-Control: no-cache
+" (47 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x65,0x35,0x33,0x33,0x61,0x32,0x66,0x37,0x2d,
+0x66,0x34,0x33,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,
+0x72,0x6f,0x6c,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
 /* "Content-type: text/html
 
 " (27 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
 0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (2606 bytes) */
+/* raw file data (3907 bytes) */
 0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,
 0x74,0x6c,0x65,0x3e,0x45,0x78,0x61,0x6d,0x70,0x6c,0x65,0x3c,0x2f,0x74,0x69,0x74,
 0x6c,0x65,0x3e,0x0a,0x0a,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0a,0x2e,0x72,0x64,
@@ -614,156 +999,251 @@ static const unsigned char data__index_html[] = {
 0x65,0x70,0x74,0x6f,0x2e,0x6d,0x69,0x6e,0x2e,0x6a,0x73,0x22,0x3e,0x3c,0x2f,0x73,
 0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x0a,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,
 0x0a,0x0a,0x76,0x61,0x72,0x20,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,
-0x6f,0x72,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x0a,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,0x6f,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x73,
-0x74,0x61,0x74,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
-0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
-0x28,0x22,0x64,0x65,0x76,0x73,0x74,0x61,0x74,0x65,0x22,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x27,0x27,0x20,0x2b,0x20,0x28,0x70,
-0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,0x20,0x3f,0x20,0x27,0x3c,
-0x66,0x6f,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x72,0x65,0x64,0x22,
-0x3e,0x4c,0x69,0x6e,0x6b,0x20,0x65,0x72,0x72,0x6f,0x72,0x3c,0x2f,0x66,0x6f,0x6e,
-0x74,0x3e,0x27,0x20,0x3a,0x20,0x27,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,
-0x27,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,
-0x45,0x72,0x72,0x6f,0x72,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,
-0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x79,0x73,0x74,0x69,0x63,
-0x6b,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,
-0x27,0x27,0x20,0x2b,0x20,0x28,0x73,0x74,0x61,0x74,0x65,0x2e,0x73,0x79,0x73,0x74,
-0x69,0x63,0x6b,0x20,0x2f,0x20,0x31,0x30,0x30,0x30,0x29,0x20,0x2b,0x20,0x27,0x20,
-0x73,0x65,0x63,0x6f,0x6e,0x64,0x73,0x27,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,
+0x6f,0x72,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x76,0x61,0x72,0x20,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0x0a,0x76,
+0x61,0x72,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x3d,0x20,0x30,0x3b,0x0a,
+0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,0x6f,0x55,0x70,0x64,0x61,
+0x74,0x65,0x28,0x73,0x74,0x61,0x74,0x65,0x29,0x0a,0x7b,0x0a,0x09,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x42,0x79,0x49,0x64,0x28,0x22,0x64,0x65,0x76,0x73,0x74,0x61,0x74,0x65,0x22,0x29,
+0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x27,0x27,0x20,
+0x2b,0x20,0x28,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,0x20,
+0x3f,0x20,0x27,0x3c,0x66,0x6f,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,
+0x72,0x65,0x64,0x22,0x3e,0x4c,0x69,0x6e,0x6b,0x20,0x65,0x72,0x72,0x6f,0x72,0x3c,
+0x2f,0x66,0x6f,0x6e,0x74,0x3e,0x27,0x20,0x3a,0x20,0x27,0x43,0x6f,0x6e,0x6e,0x65,
+0x63,0x74,0x65,0x64,0x27,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,0x28,0x70,0x6f,0x6c,
+0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,0x29,0x20,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x3b,0x0a,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x79,
+0x73,0x74,0x69,0x63,0x6b,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
+0x4c,0x20,0x3d,0x20,0x27,0x27,0x20,0x2b,0x20,0x28,0x73,0x74,0x61,0x74,0x65,0x2e,
+0x73,0x79,0x73,0x74,0x69,0x63,0x6b,0x20,0x2f,0x20,0x31,0x30,0x30,0x30,0x29,0x20,
+0x2b,0x20,0x27,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x73,0x27,0x3b,0x0a,0x09,0x64,
+0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
+0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6c,0x65,0x64,0x67,0x22,0x29,0x2e,0x63,
+0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x6c,
+0x65,0x64,0x73,0x2e,0x67,0x20,0x3d,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x42,0x79,0x49,0x64,0x28,0x22,0x6c,0x65,0x64,0x6f,0x22,0x29,0x2e,0x63,0x68,0x65,
+0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x6c,0x65,0x64,
+0x73,0x2e,0x6f,0x20,0x3d,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,
 0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-0x49,0x64,0x28,0x22,0x6c,0x65,0x64,0x67,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,
+0x49,0x64,0x28,0x22,0x6c,0x65,0x64,0x72,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,
 0x65,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x6c,0x65,0x64,0x73,0x2e,
-0x67,0x20,0x3d,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+0x72,0x20,0x3d,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
 0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
-0x28,0x22,0x6c,0x65,0x64,0x6f,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,
-0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x6c,0x65,0x64,0x73,0x2e,0x6f,0x20,
-0x3d,0x3d,0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+0x28,0x22,0x62,0x74,0x6e,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
+0x4c,0x20,0x3d,0x20,0x27,0x73,0x74,0x61,0x74,0x65,0x3a,0x20,0x27,0x20,0x2b,0x20,
+0x28,0x73,0x74,0x61,0x74,0x65,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3f,0x20,
+0x27,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x27,0x20,0x3a,0x20,0x27,0x6e,0x6f,0x74,
+0x20,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x27,0x29,0x3b,0x0a,0x09,0x69,0x66,0x20,
+0x28,0x73,0x74,0x72,0x65,0x61,0x6d,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+0x0a,0x0a,0x09,0x76,0x61,0x72,0x20,0x73,0x20,0x3d,0x20,0x27,0x61,0x63,0x63,0x20,
+0x78,0x3a,0x20,0x27,0x20,0x2b,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x61,0x63,0x63,
+0x5b,0x30,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,0x73,
+0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,0x27,0x61,0x63,0x63,0x20,0x79,0x3a,0x20,0x27,
+0x20,0x2b,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x61,0x63,0x63,0x5b,0x31,0x5d,0x20,
+0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,0x73,0x20,0x3d,0x20,0x73,
+0x20,0x2b,0x20,0x27,0x61,0x63,0x63,0x20,0x7a,0x3a,0x20,0x27,0x20,0x2b,0x20,0x73,
+0x74,0x61,0x74,0x65,0x2e,0x61,0x63,0x63,0x5b,0x32,0x5d,0x20,0x2b,0x20,0x27,0x3c,
+0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
 0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-0x6c,0x65,0x64,0x72,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,
-0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x6c,0x65,0x64,0x73,0x2e,0x72,0x20,0x3d,0x3d,
-0x20,0x31,0x3b,0x0a,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
-0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x62,0x74,
-0x6e,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,
-0x27,0x73,0x74,0x61,0x74,0x65,0x3a,0x20,0x27,0x20,0x2b,0x20,0x28,0x73,0x74,0x61,
-0x74,0x65,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x3f,0x20,0x27,0x70,0x72,0x65,
-0x73,0x73,0x65,0x64,0x27,0x20,0x3a,0x20,0x27,0x6e,0x6f,0x74,0x20,0x70,0x72,0x65,
-0x73,0x73,0x65,0x64,0x27,0x29,0x3b,0x0a,0x09,0x0a,0x09,0x76,0x61,0x72,0x20,0x73,
-0x20,0x3d,0x20,0x27,0x61,0x63,0x63,0x20,0x78,0x3a,0x20,0x27,0x20,0x2b,0x20,0x73,
-0x74,0x61,0x74,0x65,0x2e,0x61,0x63,0x63,0x5b,0x30,0x5d,0x20,0x2b,0x20,0x27,0x3c,
-0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,0x73,0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,0x27,
-0x61,0x63,0x63,0x20,0x79,0x3a,0x20,0x27,0x20,0x2b,0x20,0x73,0x74,0x61,0x74,0x65,
-0x2e,0x61,0x63,0x63,0x5b,0x31,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x27,
-0x3b,0x0a,0x09,0x73,0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,0x27,0x61,0x63,0x63,0x20,
-0x7a,0x3a,0x20,0x27,0x20,0x2b,0x20,0x73,0x74,0x61,0x74,0x65,0x2e,0x61,0x63,0x63,
-0x5b,0x32,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,0x64,
-0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x61,0x63,0x63,0x22,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,
-0x76,0x61,0x72,0x20,0x73,0x65,0x6e,0x64,0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,
-0x75,0x65,0x73,0x74,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
-0x28,0x29,0x0a,0x7b,0x0a,0x09,0x24,0x2e,0x61,0x6a,0x61,0x78,0x28,0x7b,0x0a,0x09,
-0x09,0x75,0x72,0x6c,0x3a,0x20,0x22,0x2f,0x73,0x74,0x61,0x74,0x65,0x2e,0x63,0x67,
-0x69,0x22,0x2c,0x0a,0x09,0x09,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x3a,0x20,0x32,
-0x30,0x30,0x30,0x2c,0x0a,0x09,0x09,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3a,0x20,
-0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x0a,0x09,
-0x09,0x7b,0x0a,0x09,0x09,0x09,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,
-0x28,0x73,0x65,0x6e,0x64,0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,0x75,0x65,0x73,
-0x74,0x2c,0x20,0x32,0x30,0x30,0x29,0x3b,0x0a,0x09,0x09,0x09,0x70,0x6f,0x6c,0x6c,
-0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
-0x3b,0x0a,0x09,0x09,0x09,0x64,0x6f,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x64,0x61,
-0x74,0x61,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x2c,0x0a,0x09,0x09,0x65,0x72,0x72,0x6f,
-0x72,0x3a,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,
-0x29,0x0a,0x09,0x09,0x7b,0x0a,0x09,0x09,0x09,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,
-0x6f,0x75,0x74,0x28,0x73,0x65,0x6e,0x64,0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,
-0x75,0x65,0x73,0x74,0x2c,0x20,0x31,0x30,0x30,0x30,0x29,0x3b,0x0a,0x09,0x09,0x09,
-0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,0x20,0x3d,0x20,0x74,
-0x72,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,0x64,0x6f,0x55,0x70,0x64,0x61,0x74,0x65,
-0x28,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x2c,0x0a,0x09,0x09,0x64,
-0x61,0x74,0x61,0x54,0x79,0x70,0x65,0x3a,0x20,0x22,0x6a,0x73,0x6f,0x6e,0x22,0x0a,
-0x09,0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x20,0x63,0x74,0x6c,0x28,0x64,0x61,0x74,0x61,0x6f,0x62,0x6a,0x29,0x0a,0x7b,0x0a,
-0x09,0x24,0x2e,0x61,0x6a,0x61,0x78,0x28,0x7b,0x0a,0x09,0x09,0x75,0x72,0x6c,0x3a,
-0x20,0x22,0x2f,0x63,0x74,0x6c,0x2e,0x63,0x67,0x69,0x22,0x2c,0x0a,0x09,0x09,0x64,
-0x61,0x74,0x61,0x3a,0x20,0x64,0x61,0x74,0x61,0x6f,0x62,0x6a,0x2c,0x0a,0x09,0x09,
-0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3a,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x20,0x7b,0x20,0x64,0x6f,0x55,0x70,0x64,0x61,
-0x74,0x65,0x28,0x64,0x61,0x74,0x61,0x29,0x3b,0x20,0x7d,0x2c,0x0a,0x09,0x09,0x64,
-0x61,0x74,0x61,0x54,0x79,0x70,0x65,0x3a,0x20,0x22,0x6a,0x73,0x6f,0x6e,0x22,0x0a,
-0x09,0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x20,0x64,0x6f,0x63,0x52,0x65,0x61,0x64,0x79,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x73,
-0x65,0x6e,0x64,0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x28,
-0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x24,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-0x29,0x2e,0x72,0x65,0x61,0x64,0x79,0x28,0x64,0x6f,0x63,0x52,0x65,0x61,0x64,0x79,
-0x28,0x29,0x29,0x3b,0x0a,0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x20,
-0x0a,0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,
-0x62,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x20,
-0x74,0x65,0x78,0x74,0x3d,0x22,0x62,0x6c,0x61,0x63,0x6b,0x22,0x3e,0x0a,0x3c,0x63,
-0x65,0x6e,0x74,0x65,0x72,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x65,0x6c,
-0x6c,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x3e,0x0a,0x3c,0x74,
-0x72,0x3e,0x0a,0x09,0x3c,0x74,0x64,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x64,0x69,0x76,0x22,0x3e,0x0a,0x09,0x09,
-0x09,0x3c,0x62,0x3e,0x41,0x63,0x63,0x65,0x6c,0x65,0x72,0x6f,0x6d,0x65,0x74,0x65,
-0x72,0x3c,0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,
-0x76,0x20,0x69,0x64,0x3d,0x22,0x61,0x63,0x63,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,0x50,0x75,0x73,0x68,
-0x20,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3c,0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,
-0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x62,0x74,0x6e,0x22,
-0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x09,0x3c,0x74,0x64,
-0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x5b,0x69,0x66,0x20,0x6c,0x74,0x65,0x20,0x49,0x45,
-0x20,0x39,0x20,0x5d,0x3e,0x0a,0x09,0x53,0x6f,0x72,0x72,0x79,0x2c,0x20,0x49,0x45,
-0x3c,0x39,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x62,0x72,0x3e,0x0a,0x09,
-0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,
-0x20,0x53,0x56,0x47,0x0a,0x3c,0x21,0x5b,0x65,0x6e,0x64,0x69,0x66,0x5d,0x2d,0x2d,
-0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x5b,0x69,0x66,0x20,0x21,0x6c,0x74,0x65,0x20,0x49,
-0x45,0x20,0x39,0x5d,0x3e,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x3c,0x69,0x6d,0x67,0x20,
-0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x34,0x30,0x30,0x22,0x20,0x73,0x72,0x63,
-0x3d,0x22,0x2e,0x2f,0x69,0x6d,0x67,0x2f,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,
-0x79,0x2e,0x73,0x76,0x67,0x22,0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x20,0x3c,0x21,0x5b,
-0x65,0x6e,0x64,0x69,0x66,0x5d,0x2d,0x2d,0x3e,0x0a,0x0a,0x09,0x3c,0x2f,0x74,0x64,
-0x3e,0x0a,0x09,0x3c,0x74,0x64,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x64,0x69,0x76,0x22,0x3e,0x0a,0x09,0x09,0x09,
-0x3c,0x62,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x3c,
+0x61,0x63,0x63,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,
+0x3d,0x20,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x20,0x73,0x65,0x6e,0x64,
+0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x20,0x3d,0x20,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x24,0x2e,
+0x61,0x6a,0x61,0x78,0x28,0x7b,0x0a,0x09,0x09,0x75,0x72,0x6c,0x3a,0x20,0x22,0x2f,
+0x73,0x74,0x61,0x74,0x65,0x2e,0x63,0x67,0x69,0x22,0x2c,0x0a,0x09,0x09,0x74,0x69,
+0x6d,0x65,0x6f,0x75,0x74,0x3a,0x20,0x32,0x30,0x30,0x30,0x2c,0x0a,0x09,0x09,0x73,
+0x75,0x63,0x63,0x65,0x73,0x73,0x3a,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x28,0x64,0x61,0x74,0x61,0x29,0x0a,0x09,0x09,0x7b,0x0a,0x09,0x09,0x09,0x73,0x65,
+0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x73,0x65,0x6e,0x64,0x53,0x74,0x61,
+0x74,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x2c,0x20,0x32,0x30,0x30,0x29,0x3b,
+0x0a,0x09,0x09,0x09,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,
+0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x09,0x09,0x64,0x6f,0x55,
+0x70,0x64,0x61,0x74,0x65,0x28,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x09,0x09,0x7d,
+0x2c,0x0a,0x09,0x09,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x0a,0x09,0x09,0x7b,0x0a,0x09,0x09,
+0x09,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x73,0x65,0x6e,0x64,
+0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x2c,0x20,0x31,0x30,
+0x30,0x30,0x29,0x3b,0x0a,0x09,0x09,0x09,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,
+0x72,0x72,0x6f,0x72,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,0x09,0x09,
+0x64,0x6f,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,
+0x09,0x09,0x7d,0x2c,0x0a,0x09,0x09,0x64,0x61,0x74,0x61,0x54,0x79,0x70,0x65,0x3a,
+0x20,0x22,0x6a,0x73,0x6f,0x6e,0x22,0x0a,0x09,0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x74,0x6c,0x28,0x64,0x61,0x74,
+0x61,0x6f,0x62,0x6a,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x73,0x74,0x72,
+0x65,0x61,0x6d,0x20,0x26,0x26,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x2e,0x72,0x65,
+0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x09,
+0x7b,0x0a,0x09,0x09,0x2f,0x2a,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x77,0x20,0x73,
+0x74,0x61,0x74,0x65,0x20,0x63,0x6f,0x6d,0x65,0x73,0x20,0x62,0x61,0x63,0x6b,0x20,
+0x61,0x73,0x20,0x61,0x6e,0x20,0x65,0x76,0x65,0x6e,0x74,0x20,0x2a,0x2f,0x0a,0x09,
+0x09,0x73,0x74,0x72,0x65,0x61,0x6d,0x2e,0x73,0x65,0x6e,0x64,0x28,0x24,0x2e,0x70,
+0x61,0x72,0x61,0x6d,0x28,0x64,0x61,0x74,0x61,0x6f,0x62,0x6a,0x29,0x29,0x3b,0x0a,
+0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x09,0x7d,0x0a,0x09,0x24,0x2e,
+0x61,0x6a,0x61,0x78,0x28,0x7b,0x0a,0x09,0x09,0x75,0x72,0x6c,0x3a,0x20,0x22,0x2f,
+0x63,0x74,0x6c,0x2e,0x63,0x67,0x69,0x22,0x2c,0x0a,0x09,0x09,0x64,0x61,0x74,0x61,
+0x3a,0x20,0x64,0x61,0x74,0x61,0x6f,0x62,0x6a,0x2c,0x0a,0x09,0x09,0x73,0x75,0x63,
+0x63,0x65,0x73,0x73,0x3a,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,
+0x61,0x74,0x61,0x29,0x20,0x7b,0x20,0x64,0x6f,0x55,0x70,0x64,0x61,0x74,0x65,0x28,
+0x64,0x61,0x74,0x61,0x29,0x3b,0x20,0x7d,0x2c,0x0a,0x09,0x09,0x64,0x61,0x74,0x61,
+0x54,0x79,0x70,0x65,0x3a,0x20,0x22,0x6a,0x73,0x6f,0x6e,0x22,0x0a,0x09,0x7d,0x29,
+0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2a,0x20,0x61,0x63,0x63,0x65,0x6c,0x65,0x72,0x6f,
+0x6d,0x65,0x74,0x65,0x72,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x61,0x74,
+0x20,0x34,0x30,0x30,0x20,0x48,0x7a,0x3a,0x20,0x69,0x6e,0x74,0x31,0x36,0x20,0x78,
+0x2c,0x20,0x79,0x2c,0x20,0x7a,0x20,0x74,0x72,0x69,0x70,0x6c,0x65,0x73,0x20,0x2a,
+0x2f,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x70,0x65,0x6e,0x53,
+0x74,0x72,0x65,0x61,0x6d,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x76,0x61,0x72,0x20,0x77,
+0x73,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,
+0x74,0x28,0x22,0x77,0x73,0x3a,0x2f,0x2f,0x22,0x20,0x2b,0x20,0x6c,0x6f,0x63,0x61,
+0x74,0x69,0x6f,0x6e,0x2e,0x68,0x6f,0x73,0x74,0x20,0x2b,0x20,0x22,0x2f,0x77,0x73,
+0x22,0x29,0x3b,0x0a,0x09,0x77,0x73,0x2e,0x62,0x69,0x6e,0x61,0x72,0x79,0x54,0x79,
+0x70,0x65,0x20,0x3d,0x20,0x22,0x61,0x72,0x72,0x61,0x79,0x62,0x75,0x66,0x66,0x65,
+0x72,0x22,0x3b,0x0a,0x09,0x77,0x73,0x2e,0x6f,0x6e,0x6f,0x70,0x65,0x6e,0x20,0x3d,
+0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x20,0x73,0x74,
+0x72,0x65,0x61,0x6d,0x20,0x3d,0x20,0x77,0x73,0x3b,0x20,0x7d,0x3b,0x0a,0x09,0x77,
+0x73,0x2e,0x6f,0x6e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x3d,0x20,0x66,0x75,
+0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x0a,0x09,0x7b,0x0a,0x09,0x09,0x76,
+0x61,0x72,0x20,0x61,0x63,0x63,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x49,0x6e,0x74,
+0x31,0x36,0x41,0x72,0x72,0x61,0x79,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,
+0x0a,0x09,0x09,0x76,0x61,0x72,0x20,0x6e,0x20,0x3d,0x20,0x61,0x63,0x63,0x2e,0x6c,
+0x65,0x6e,0x67,0x74,0x68,0x20,0x2d,0x20,0x33,0x3b,0x0a,0x09,0x09,0x73,0x61,0x6d,
+0x70,0x6c,0x65,0x73,0x20,0x2b,0x3d,0x20,0x61,0x63,0x63,0x2e,0x6c,0x65,0x6e,0x67,
+0x74,0x68,0x20,0x2f,0x20,0x33,0x3b,0x0a,0x09,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,
+0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
+0x64,0x28,0x22,0x61,0x63,0x63,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,
+0x4d,0x4c,0x20,0x3d,0x0a,0x09,0x09,0x09,0x27,0x61,0x63,0x63,0x20,0x78,0x3a,0x20,
+0x27,0x20,0x2b,0x20,0x61,0x63,0x63,0x5b,0x6e,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,
+0x72,0x3e,0x61,0x63,0x63,0x20,0x79,0x3a,0x20,0x27,0x20,0x2b,0x20,0x61,0x63,0x63,
+0x5b,0x6e,0x20,0x2b,0x20,0x31,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x61,
+0x63,0x63,0x20,0x7a,0x3a,0x20,0x27,0x20,0x2b,0x20,0x61,0x63,0x63,0x5b,0x6e,0x20,
+0x2b,0x20,0x32,0x5d,0x20,0x2b,0x20,0x27,0x3c,0x62,0x72,0x3e,0x27,0x3b,0x0a,0x09,
+0x7d,0x3b,0x0a,0x09,0x77,0x73,0x2e,0x6f,0x6e,0x63,0x6c,0x6f,0x73,0x65,0x20,0x3d,
+0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x0a,0x09,0x7b,0x0a,0x09,
+0x09,0x73,0x74,0x72,0x65,0x61,0x6d,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0x0a,
+0x09,0x09,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x6f,0x70,0x65,
+0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,0x2c,0x20,0x31,0x30,0x30,0x30,0x29,0x3b,0x0a,
+0x09,0x7d,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
+0x73,0x68,0x6f,0x77,0x52,0x61,0x74,0x65,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x64,0x6f,
+0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
+0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x72,0x61,0x74,0x65,0x22,0x29,0x2e,0x69,0x6e,
+0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,
+0x20,0x3f,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x2b,0x20,0x27,0x20,0x73,
+0x61,0x6d,0x70,0x6c,0x65,0x73,0x2f,0x73,0x27,0x20,0x3a,0x20,0x27,0x27,0x3b,0x0a,
+0x09,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x7d,0x0a,
+0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,0x6f,0x63,0x52,0x65,0x61,
+0x64,0x79,0x28,0x29,0x0a,0x7b,0x0a,0x09,0x69,0x66,0x20,0x28,0x77,0x69,0x6e,0x64,
+0x6f,0x77,0x2e,0x57,0x65,0x62,0x53,0x6f,0x63,0x6b,0x65,0x74,0x29,0x0a,0x09,0x7b,
+0x0a,0x09,0x09,0x6f,0x70,0x65,0x6e,0x53,0x74,0x72,0x65,0x61,0x6d,0x28,0x29,0x3b,
+0x0a,0x09,0x09,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x73,
+0x68,0x6f,0x77,0x52,0x61,0x74,0x65,0x2c,0x20,0x31,0x30,0x30,0x30,0x29,0x3b,0x0a,
+0x09,0x7d,0x0a,0x09,0x69,0x66,0x20,0x28,0x21,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
+0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x29,0x0a,0x09,0x7b,0x0a,
+0x09,0x09,0x73,0x65,0x6e,0x64,0x53,0x74,0x61,0x74,0x65,0x52,0x65,0x71,0x75,0x65,
+0x73,0x74,0x28,0x29,0x3b,0x0a,0x09,0x09,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+0x09,0x7d,0x0a,0x09,0x2f,0x2a,0x20,0x74,0x68,0x65,0x20,0x64,0x65,0x76,0x69,0x63,
+0x65,0x20,0x70,0x75,0x73,0x68,0x65,0x73,0x20,0x69,0x74,0x73,0x20,0x73,0x74,0x61,
+0x74,0x65,0x2c,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x20,
+0x72,0x65,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x73,0x20,0x62,0x79,0x20,0x69,0x74,
+0x73,0x65,0x6c,0x66,0x20,0x2a,0x2f,0x0a,0x09,0x76,0x61,0x72,0x20,0x65,0x76,0x65,
+0x6e,0x74,0x73,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,
+0x6f,0x75,0x72,0x63,0x65,0x28,0x22,0x2f,0x65,0x76,0x65,0x6e,0x74,0x73,0x22,0x29,
+0x3b,0x0a,0x09,0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x6f,0x6e,0x6d,0x65,0x73,0x73,
+0x61,0x67,0x65,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,
+0x29,0x0a,0x09,0x7b,0x0a,0x09,0x09,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,
+0x72,0x6f,0x72,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x09,0x09,0x64,
+0x6f,0x55,0x70,0x64,0x61,0x74,0x65,0x28,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,
+0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x29,0x3b,0x0a,0x09,0x7d,0x3b,
+0x0a,0x09,0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x6f,0x6e,0x65,0x72,0x72,0x6f,0x72,
+0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x0a,0x09,
+0x7b,0x0a,0x09,0x09,0x70,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x45,0x72,0x72,0x6f,0x72,
+0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x09,0x09,0x64,0x6f,0x55,0x70,0x64,
+0x61,0x74,0x65,0x28,0x6e,0x75,0x6c,0x6c,0x29,0x3b,0x0a,0x09,0x7d,0x3b,0x0a,0x7d,
+0x0a,0x0a,0x24,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x29,0x2e,0x72,0x65,
+0x61,0x64,0x79,0x28,0x64,0x6f,0x63,0x52,0x65,0x61,0x64,0x79,0x28,0x29,0x29,0x3b,
+0x0a,0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x20,0x0a,0x0a,0x3c,0x2f,
+0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x62,0x67,0x63,0x6f,
+0x6c,0x6f,0x72,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x20,0x74,0x65,0x78,0x74,
+0x3d,0x22,0x62,0x6c,0x61,0x63,0x6b,0x22,0x3e,0x0a,0x3c,0x63,0x65,0x6e,0x74,0x65,
+0x72,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x65,0x6c,0x6c,0x73,0x70,0x61,
+0x63,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x3e,0x0a,0x3c,0x74,0x72,0x3e,0x0a,0x09,
+0x3c,0x74,0x64,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x72,0x64,0x69,0x76,0x22,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,
+0x41,0x63,0x63,0x65,0x6c,0x65,0x72,0x6f,0x6d,0x65,0x74,0x65,0x72,0x3c,0x2f,0x62,
+0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,
+0x3d,0x22,0x61,0x63,0x63,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,
+0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x72,0x61,0x74,0x65,0x22,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,
+0x3e,0x50,0x75,0x73,0x68,0x20,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3c,0x2f,0x62,0x3e,
+0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
+0x22,0x62,0x74,0x6e,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,
+0x0a,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,
+0x0a,0x09,0x3c,0x74,0x64,0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x5b,0x69,0x66,0x20,0x6c,
+0x74,0x65,0x20,0x49,0x45,0x20,0x39,0x20,0x5d,0x3e,0x0a,0x09,0x53,0x6f,0x72,0x72,
+0x79,0x2c,0x20,0x49,0x45,0x3c,0x39,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,
+0x62,0x72,0x3e,0x0a,0x09,0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,
+0x70,0x70,0x6f,0x72,0x74,0x20,0x53,0x56,0x47,0x0a,0x3c,0x21,0x5b,0x65,0x6e,0x64,
+0x69,0x66,0x5d,0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x5b,0x69,0x66,0x20,0x21,
+0x6c,0x74,0x65,0x20,0x49,0x45,0x20,0x39,0x5d,0x3e,0x20,0x2d,0x2d,0x3e,0x0a,0x09,
+0x3c,0x69,0x6d,0x67,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x34,0x30,0x30,
+0x22,0x20,0x73,0x72,0x63,0x3d,0x22,0x2e,0x2f,0x69,0x6d,0x67,0x2f,0x64,0x69,0x73,
+0x63,0x6f,0x76,0x65,0x72,0x79,0x2e,0x73,0x76,0x67,0x22,0x3e,0x0a,0x3c,0x21,0x2d,
+0x2d,0x20,0x3c,0x21,0x5b,0x65,0x6e,0x64,0x69,0x66,0x5d,0x2d,0x2d,0x3e,0x0a,0x0a,
+0x09,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x09,0x3c,0x74,0x64,0x3e,0x0a,0x09,0x09,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x64,0x69,0x76,0x22,
+0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x73,
+0x74,0x61,0x74,0x65,0x3c,0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,
+0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x64,0x65,0x76,0x73,0x74,0x61,0x74,
+0x65,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,
+0x09,0x3c,0x62,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x74,0x69,0x6d,0x65,0x3c,
 0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,
-0x69,0x64,0x3d,0x22,0x64,0x65,0x76,0x73,0x74,0x61,0x74,0x65,0x22,0x3e,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,0x44,
-0x65,0x76,0x69,0x63,0x65,0x20,0x74,0x69,0x6d,0x65,0x3c,0x2f,0x62,0x3e,0x3c,0x62,
-0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,
-0x79,0x73,0x74,0x69,0x63,0x6b,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,
-0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,0x55,0x73,0x65,0x72,0x20,0x4c,0x45,
-0x44,0x73,0x3c,0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6c,0x65,0x64,0x67,0x22,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0x20,0x6f,
-0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x63,0x74,0x6c,0x28,0x7b,0x67,0x3a,0x20,
-0x28,0x74,0x68,0x69,0x73,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3f,0x20,
-0x31,0x20,0x3a,0x20,0x30,0x29,0x7d,0x29,0x22,0x3e,0x67,0x72,0x65,0x65,0x6e,0x3c,
-0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,
-0x3d,0x22,0x6c,0x65,0x64,0x6f,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x63,0x68,
-0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-0x22,0x63,0x74,0x6c,0x28,0x7b,0x6f,0x3a,0x20,0x28,0x74,0x68,0x69,0x73,0x2e,0x63,
-0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3f,0x20,0x31,0x20,0x3a,0x20,0x30,0x29,0x7d,
-0x29,0x22,0x3e,0x6f,0x72,0x61,0x6e,0x67,0x65,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,
-0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6c,0x65,0x64,0x72,
-0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,
-0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x63,0x74,0x6c,0x28,0x7b,
-0x72,0x3a,0x20,0x28,0x74,0x68,0x69,0x73,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,
-0x20,0x3f,0x20,0x31,0x20,0x3a,0x20,0x30,0x29,0x7d,0x29,0x22,0x3e,0x72,0x65,0x64,
-0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x3c,
-0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,0x3c,0x2f,0x74,0x61,0x62,
-0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x63,0x65,0x6e,0x74,0x65,0x72,0x3e,0x0a,0x3c,0x2f,
-0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0a,};
+0x69,0x64,0x3d,0x22,0x73,0x79,0x73,0x74,0x69,0x63,0x6b,0x22,0x3e,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x62,0x3e,0x55,0x73,
+0x65,0x72,0x20,0x4c,0x45,0x44,0x73,0x3c,0x2f,0x62,0x3e,0x3c,0x62,0x72,0x3e,0x0a,
+0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6c,0x65,
+0x64,0x67,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,
+0x6f,0x78,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x63,0x74,0x6c,
+0x28,0x7b,0x67,0x3a,0x20,0x28,0x74,0x68,0x69,0x73,0x2e,0x63,0x68,0x65,0x63,0x6b,
+0x65,0x64,0x20,0x3f,0x20,0x31,0x20,0x3a,0x20,0x30,0x29,0x7d,0x29,0x22,0x3e,0x67,
+0x72,0x65,0x65,0x6e,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,
+0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6c,0x65,0x64,0x6f,0x22,0x20,0x74,0x79,0x70,
+0x65,0x3d,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0x20,0x6f,0x6e,0x63,
+0x6c,0x69,0x63,0x6b,0x3d,0x22,0x63,0x74,0x6c,0x28,0x7b,0x6f,0x3a,0x20,0x28,0x74,
+0x68,0x69,0x73,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3f,0x20,0x31,0x20,
+0x3a,0x20,0x30,0x29,0x7d,0x29,0x22,0x3e,0x6f,0x72,0x61,0x6e,0x67,0x65,0x3c,0x62,
+0x72,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,
+0x22,0x6c,0x65,0x64,0x72,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x63,0x68,0x65,
+0x63,0x6b,0x62,0x6f,0x78,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,
+0x63,0x74,0x6c,0x28,0x7b,0x72,0x3a,0x20,0x28,0x74,0x68,0x69,0x73,0x2e,0x63,0x68,
+0x65,0x63,0x6b,0x65,0x64,0x20,0x3f,0x20,0x31,0x20,0x3a,0x20,0x30,0x29,0x7d,0x29,
+0x22,0x3e,0x72,0x65,0x64,0x3c,0x62,0x72,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x64,0x69,
+0x76,0x3e,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x0a,0x3c,0x2f,0x74,0x72,0x3e,0x0a,
+0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x0a,0x3c,0x2f,0x63,0x65,0x6e,0x74,0x65,
+0x72,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,
+0x6c,0x3e,0x0a,};
+
+#if HTTPD_FS_SSI_SEGMENTS
+/* 6 tags */
+static const struct fsdata_ssi_seg ssi_segs__state_shtml[] = {
+{14, 15, "systick"},
+{13, 11, "btn"},
+{11, 11, "acc"},
+{19, 12, "ledg"},
+{7, 12, "ledo"},
+{7, 12, "ledr"},
+{5, 0, NULL},
+};
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 
-static const unsigned int dummy_align__state_shtml = 3;
+static const unsigned int dummy_align__state_shtml = 5;
 static const unsigned char data__state_shtml[] = {
 /* /state.shtml (13 chars) */
 0x2f,0x73,0x74,0x61,0x74,0x65,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.1 200 OK
 " (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
 /* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
@@ -794,15 +1274,667 @@ Pragma: no-cache
 0x72,0x22,0x3a,0x20,0x3c,0x21,0x2d,0x2d,0x23,0x6c,0x65,0x64,0x72,0x2d,0x2d,0x3e,
 0x20,0x7d,0x0a,0x7d,0x0a,};
 
-static const unsigned int dummy_align__zepto_min_js = 4;
+#if HTTPD_FS_ETAG
+static const char etag__zepto_min_js__gz[] = "\"c6d44134-24c4\"";
+static const char not_modified__zepto_min_js__gz[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"c6d44134-24c4\"\r\n"
+"Cache-Control: max-age=3600\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__zepto_min_js__gz = 6;
+static const unsigned char data__zepto_min_js__gz[] = {
+/* /zepto.min.js (14 chars) */
+0x2f,0x7a,0x65,0x70,0x74,0x6f,0x2e,0x6d,0x69,0x6e,0x2e,0x6a,0x73,0x00,0x00,0x00,
+
+/* HTTP header */
+/* "HTTP/1.1 200 OK
+" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+" (63 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
+0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
+0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
+0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 9412
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x39,0x34,0x31,0x32,0x0d,0x0a,
+/* "ETag: "c6d44134-24c4"
+Cache-Control: max-age=3600
+" (52 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x63,0x36,0x64,0x34,0x34,0x31,0x33,0x34,0x2d,
+0x32,0x34,0x63,0x34,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,
+0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x33,0x36,
+0x30,0x30,0x0d,0x0a,
+/* "Content-Encoding: gzip
+Vary: Accept-Encoding
+" (47 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,
+0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-type: application/x-javascript
+
+" (42 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x61,0x70,
+0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x6a,0x61,0x76,0x61,
+0x73,0x63,0x72,0x69,0x70,0x74,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (9412 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xad,0x5c,0xeb,0x72,0xdb,0x46,
+0xb2,0xfe,0x7f,0x9e,0x82,0xc2,0xf1,0xaa,0x00,0x73,0x44,0x49,0xde,0xad,0xad,0x5a,
+0xd0,0x30,0xcb,0x96,0x9d,0xc4,0x29,0xdf,0xca,0x52,0x12,0xc7,0x94,0xe2,0x82,0xc8,
+0xa1,0x08,0x99,0x04,0x18,0x00,0xd4,0xc5,0x22,0xf7,0xd9,0xf7,0xeb,0xee,0x19,0x60,
+0x40,0x42,0xb6,0xb3,0xb5,0x55,0xb6,0x08,0x0c,0xe6,0x3e,0x3d,0xdd,0xdf,0xf4,0x65,
+0xf6,0x1f,0x76,0x3e,0xea,0x45,0x99,0x75,0xae,0x0e,0x7b,0x87,0xbd,0x7f,0x76,0xf6,
+0x3a,0x5f,0xf8,0x55,0x5f,0xe9,0xb4,0xec,0xc4,0x97,0xf1,0x4d,0x67,0x92,0xe5,0xf3,
+0x4e,0xa2,0xed,0xa7,0xcb,0xa2,0x37,0xca,0xe6,0xfb,0xb3,0x64,0xa4,0xd3,0x42,0x77,
+0x1e,0xee,0xff,0xdf,0x55,0x9c,0x4b,0x25,0xd1,0x64,0x99,0x8e,0xca,0x24,0x4b,0xfd,
+0xe0,0xce,0x3e,0x76,0x5e,0xf9,0x65,0x70,0x97,0xeb,0x72,0x99,0xa7,0x9d,0x74,0x39,
+0x9b,0x45,0x51,0x39,0x38,0x2e,0xf3,0x24,0xbd,0xc0,0x87,0xf0,0x72,0x78,0xdc,0x1b,
+0xc5,0xb3,0x19,0x9e,0xcf,0x56,0x2b,0x2f,0x3b,0xbf,0xd4,0xa3,0xd2,0x5b,0x57,0xa5,
+0x3f,0xd6,0xa5,0x3d,0x9b,0xe8,0x45,0x11,0x55,0x5a,0x67,0xfa,0xb4,0xd1,0xc4,0x4e,
+0x54,0xee,0xee,0x96,0x68,0xa8,0x77,0x9d,0xa4,0xe3,0xec,0xba,0xce,0xf9,0xa0,0x35,
+0x67,0x2f,0xcd,0xc6,0xfa,0xe4,0x76,0xa1,0xa9,0xc8,0xf3,0xb7,0x47,0xbf,0xbc,0x7e,
+0xf1,0xe6,0xe4,0xd3,0x9b,0xb7,0xcf,0x5f,0xd4,0x25,0x9f,0x3b,0x1d,0x31,0xbd,0xdc,
+0xec,0xc6,0x6b,0xa7,0x72,0xca,0xbe,0xbb,0xbb,0xf3,0x89,0x7f,0xde,0x72,0xfe,0xde,
+0x85,0x2e,0xdf,0xe5,0x59,0x99,0x95,0x68,0xe9,0xed,0x04,0x5f,0xa2,0xc8,0x7c,0x59,
+0xd8,0xe4,0xba,0xb2,0xf7,0x4e,0x7b,0xe9,0x72,0x7e,0xae,0x73,0xb4,0x47,0x59,0xb2,
+0x49,0xa7,0xec,0xcd,0x74,0x7a,0x51,0x4e,0xeb,0xdc,0x9f,0x9d,0xa6,0x0b,0x33,0xa1,
+0xaa,0x5a,0x8d,0xad,0x31,0xaf,0x9d,0x5e,0x7f,0x71,0x3e,0xdb,0x8a,0x9f,0x1c,0x0c,
+0xd2,0xde,0x24,0xc5,0x42,0xa7,0xa3,0xb8,0xec,0xc5,0x8b,0xc5,0xec,0xd6,0x1f,0x9e,
+0x29,0x2c,0x58,0x59,0x97,0xfc,0xa1,0x51,0x32,0xd7,0x8b,0x59,0x3c,0xd2,0xfe,0x7e,
+0x18,0xee,0x5f,0x28,0x6f,0xdf,0x0b,0xea,0x24,0x7f,0xf8,0x74,0xef,0xe3,0x59,0x37,
+0x90,0xdf,0x61,0xbc,0xf7,0xe5,0x2c,0xa0,0x4c,0x0f,0x0e,0x3f,0x3d,0x78,0xd4,0xcc,
+0x88,0x6f,0xa7,0xe3,0x33,0x93,0xb3,0x3d,0xd3,0x27,0x4a,0xdd,0x43,0x4a,0x99,0xbd,
+0xca,0xae,0x75,0x7e,0x14,0x17,0xda,0x77,0x46,0xf4,0xa7,0xdb,0xaf,0x4e,0x92,0x76,
+0x26,0x83,0xc9,0xb0,0x3c,0x0b,0xe9,0x4f,0x94,0xea,0xeb,0xce,0x7b,0x7d,0xf1,0xe2,
+0x66,0xe1,0x7b,0xfe,0x1f,0xab,0xd3,0xd3,0x22,0xf0,0xba,0x65,0xd7,0xf3,0xf1,0xb4,
+0x7a,0x10,0x78,0x4e,0x3d,0x3f,0x61,0x0e,0xf5,0xe6,0x22,0xec,0xd8,0x45,0xd0,0xab,
+0xd5,0x68,0x48,0x53,0x70,0x36,0xd0,0xa1,0xee,0x7a,0x8b,0x1b,0x87,0x6c,0x5f,0x52,
+0x17,0x68,0x5f,0x68,0x95,0xf6,0x4d,0x57,0x96,0x68,0x7e,0xb5,0xf2,0x75,0x14,0xf7,
+0x46,0xb9,0x8e,0x4b,0xfd,0x62,0xa6,0xe7,0xd8,0x65,0xc8,0xaa,0xe2,0xde,0x79,0x36,
+0xbe,0xa5,0x89,0xd6,0xe9,0xf8,0x68,0x9a,0xcc,0xc6,0xbe,0x0e,0x54,0x1a,0x81,0x64,
+0x8e,0xb2,0xf9,0x62,0x59,0xea,0xf1,0x71,0x79,0x3b,0xd3,0xbe,0x56,0x1e,0x06,0x2e,
+0x94,0xb4,0xd0,0x79,0x79,0xfb,0x6b,0x3c,0x5b,0x6a,0xdf,0x1b,0x27,0x05,0x66,0xe7,
+0xd6,0x0b,0x94,0xee,0x2d,0xe2,0x1c,0xd5,0xbe,0x01,0x4d,0x63,0xce,0xe6,0xd9,0x95,
+0xae,0x2a,0xf4,0xd2,0x2c,0xd5,0xa0,0xa3,0x74,0x77,0xd7,0x4f,0x23,0xef,0x7c,0x96,
+0x8d,0x3e,0xa3,0xc8,0x92,0x27,0x46,0x7e,0xeb,0x31,0xfc,0xea,0x50,0xe0,0x88,0x6a,
+0x40,0xad,0x1e,0x66,0xb3,0x1c,0x64,0x86,0xc2,0x7a,0x36,0x39,0x08,0xd3,0xde,0x3c,
+0x5e,0xd8,0x14,0x6a,0xba,0x68,0x23,0xbf,0x43,0xda,0x60,0x76,0xb3,0x0d,0xca,0xf0,
+0x2a,0x4b,0xc6,0x9d,0x03,0x97,0x1a,0x9f,0xf9,0xa9,0x4a,0x54,0x0e,0xfe,0x91,0xe5,
+0xbe,0xa6,0xc5,0x4b,0x82,0x1c,0xbd,0x7d,0xed,0x27,0x43,0x7d,0x16,0xac,0x56,0x4f,
+0xe5,0x21,0x18,0xd8,0x24,0xec,0xb2,0xd7,0x7e,0x2a,0x4f,0xfc,0x1b,0xdd,0xad,0x03,
+0xf5,0xb4,0xfa,0xf8,0xb4,0xf9,0x71,0x78,0x16,0xa8,0x67,0xfc,0xa8,0x28,0x07,0x9a,
+0x0a,0x42,0x7a,0xd8,0x89,0x88,0x15,0x48,0x1e,0x2e,0x5a,0xf7,0xe9,0x17,0x97,0x0e,
+0x0c,0x0f,0xd3,0x03,0x1a,0x57,0x48,0x7f,0x7a,0x93,0x64,0x56,0x6a,0xf4,0xd6,0x29,
+0xf2,0x33,0x15,0x51,0x18,0x4a,0x55,0xec,0x23,0xbe,0x0f,0xb4,0xdd,0x9a,0xf4,0x25,
+0x74,0x76,0xfb,0x07,0xc9,0x1f,0xdc,0x49,0xed,0xe9,0xa0,0x34,0x4b,0xf7,0xb4,0x04,
+0xab,0x3c,0xc7,0xfa,0xa3,0x78,0x58,0xf6,0x0a,0x5d,0x3a,0x29,0x28,0x50,0x57,0xf1,
+0x1b,0xbf,0x33,0xd1,0x25,0x11,0x1a,0x9a,0xc5,0x45,0xf1,0x26,0x9e,0x83,0x4c,0x3d,
+0x4f,0xe5,0x51,0xb2,0xbb,0x9b,0xf4,0xce,0xb1,0x53,0x40,0x30,0x34,0x56,0x4b,0x95,
+0x69,0x44,0x0c,0x39,0x1f,0x54,0x1f,0xc3,0x84,0x97,0xc5,0x77,0x92,0xa2,0x34,0x74,
+0x2a,0x8c,0xdc,0x56,0x7f,0xa7,0xd5,0x2d,0xf3,0xdb,0x6a,0xbf,0x0d,0xbc,0x32,0x5f,
+0x12,0x8d,0x95,0xa0,0x75,0x6f,0x12,0xcf,0x0a,0x7e,0x19,0xec,0x1c,0x86,0x1e,0x0d,
+0x8e,0x5f,0xe8,0x21,0xa4,0x5d,0xc7,0x6f,0xdd,0x32,0xdc,0xff,0x63,0x78,0x3a,0x3c,
+0xbd,0x3b,0xdb,0xef,0x95,0xba,0xa0,0x1d,0x01,0xfe,0x03,0x32,0x2e,0xf4,0xcf,0xc7,
+0x6f,0xdf,0xd0,0x44,0x33,0xe7,0x01,0x2f,0x1a,0x4d,0xfd,0x7a,0x29,0xca,0x75,0xdd,
+0x91,0x1f,0x65,0x91,0x34,0x32,0xf7,0x89,0x76,0x68,0x1e,0xd2,0xe8,0x40,0x25,0x91,
+0x4b,0x94,0x86,0xbf,0xf5,0x93,0x27,0x69,0x3f,0xed,0x76,0x83,0x1f,0x1b,0x24,0x3b,
+0x4c,0xcf,0x50,0xc7,0x9a,0x8a,0x9a,0xe5,0x53,0x47,0xea,0x0d,0x26,0x0f,0xac,0x2f,
+0x8b,0xf2,0x5e,0x41,0x42,0x4f,0x15,0x78,0x92,0x25,0x57,0x71,0x24,0x02,0xa6,0x37,
+0xce,0x46,0x4b,0xda,0xcb,0x6a,0x09,0xea,0x53,0x13,0xfa,0x33,0x8a,0xee,0xbc,0x51,
+0x36,0x5b,0xce,0xd3,0xbd,0x51,0xb6,0x4c,0x4b,0x2f,0x3c,0x54,0xf2,0x5e,0xe0,0xc9,
+0x9b,0x64,0x69,0xb9,0x77,0xad,0x93,0x8b,0x29,0x7f,0xf1,0x66,0x49,0xaa,0xf7,0xa6,
+0xd5,0x7b,0xb6,0x88,0x47,0x49,0x79,0x4b,0x5f,0xbe,0xec,0xa1,0x0d,0x7d,0x43,0xa9,
+0x5f,0xb2,0x6c,0x1e,0x1e,0xae,0xd5,0x2c,0xda,0xff,0xe3,0xb4,0x78,0xf8,0xd8,0x3f,
+0xbd,0xee,0xae,0x76,0x82,0xe1,0x1f,0x4f,0xce,0x1e,0x3e,0xd9,0x57,0x53,0x24,0x73,
+0x5a,0x80,0x8f,0xa7,0xfb,0x83,0x27,0xfe,0x20,0x7c,0x7c,0xba,0x7f,0x7a,0xf8,0x64,
+0x15,0x3c,0xd8,0x57,0x8b,0x68,0xff,0xb1,0x3f,0xd8,0x01,0x77,0x88,0x57,0xe7,0xf9,
+0x0a,0x9d,0x59,0x69,0xf0,0xb4,0xf1,0x6a,0x9a,0xaf,0x92,0xf9,0xc5,0x2a,0x49,0xc1,
+0x68,0x56,0xe8,0xc8,0xe7,0xd5,0x5c,0x97,0xf1,0x0a,0x0b,0x10,0xcf,0x03,0xdf,0x1f,
+0x9e,0x5e,0x87,0x60,0xde,0xdc,0x4a,0x70,0xba,0xff,0x64,0xff,0x22,0x51,0x63,0x34,
+0x85,0xda,0x89,0x6b,0xad,0xa6,0xe5,0x7c,0x86,0xfa,0x13,0x35,0x8f,0xf6,0x6b,0xbe,
+0x7d,0x11,0x0d,0xbd,0xab,0x78,0xe6,0x29,0x6f,0x54,0x14,0xf8,0x4b,0xb9,0xf0,0x53,
+0xea,0x9b,0x12,0x3f,0xe3,0xb8,0x8c,0xf1,0x73,0x9d,0x8c,0xcb,0x29,0x7d,0x94,0x81,
+0x2b,0x2f,0x9b,0x4c,0x40,0xe3,0xde,0x99,0xba,0x42,0xf1,0x78,0x82,0x49,0x46,0xe2,
+0x02,0xac,0x1f,0x7c,0x11,0x4f,0xe7,0x1a,0x6b,0xab,0xf1,0x20,0x9c,0x12,0xf9,0x6e,
+0xb7,0xd8,0xa9,0x57,0xc6,0xe7,0x33,0x0d,0xb6,0x76,0xd3,0xf2,0x29,0x47,0xfa,0x79,
+0x04,0x8a,0x0d,0xb7,0xbf,0xd1,0x60,0xf0,0x99,0x7f,0xc3,0x5b,0x55,0x4e,0x75,0x3c,
+0xa6,0xdf,0x49,0x96,0x95,0xf4,0x3b,0x0e,0x6f,0x90,0x88,0x3f,0xde,0x43,0x6f,0xbb,
+0xf8,0x38,0xb9,0x82,0xf0,0x50,0xd7,0xd1,0x3e,0xe0,0xd1,0x62,0xa6,0x4b,0xbd,0x9a,
+0x65,0xf1,0x18,0xd3,0x9b,0xa4,0x18,0x46,0x0c,0x32,0xbd,0xd2,0xfb,0xea,0x45,0x44,
+0xb4,0x7e,0xbd,0x77,0xf6,0x10,0x2b,0x72,0x49,0x84,0x72,0x1c,0x5d,0x42,0x92,0x09,
+0x24,0x52,0x27,0x94,0xf2,0x36,0x6a,0xaf,0x5d,0xbd,0x43,0xcf,0xe3,0x73,0x26,0x87,
+0x90,0x86,0xf9,0x92,0x09,0x43,0x21,0xeb,0x38,0x4b,0x67,0xb7,0xa1,0x47,0x4f,0x6f,
+0xf1,0xe4,0x11,0x81,0xe5,0x5e,0xc8,0xb3,0xfe,0x43,0x46,0x93,0xc8,0xfb,0x17,0x29,
+0xd5,0x3e,0xf6,0xd4,0x3c,0xbe,0x91,0xfd,0x10,0x7a,0x78,0x7c,0xc5,0x8f,0x9e,0x1a,
+0xe9,0xd9,0xac,0x20,0xf2,0x4b,0x2f,0x90,0x1b,0x2f,0xc7,0xf2,0x22,0x5f,0x16,0xf1,
+0x78,0x5c,0x7d,0x79,0x27,0x2f,0xe8,0x41,0x76,0x8d,0x22,0x29,0x3a,0x90,0x5d,0x23,
+0x7b,0xea,0x11,0xa9,0x4b,0x0a,0x1e,0x24,0x65,0x59,0x68,0xc8,0x88,0xd0,0xc3,0xef,
+0xeb,0x78,0xe1,0xa9,0x09,0xa8,0x4b,0x9f,0x67,0xf9,0x58,0xe7,0xa1,0xc7,0x2f,0xcf,
+0xf8,0x85,0xca,0x62,0xc6,0xf0,0x6f,0x9c,0xf0,0x52,0x52,0x1d,0x9c,0xf0,0xc2,0x24,
+0x78,0x6b,0xf5,0x34,0x7a,0x9a,0xe7,0xf1,0x6d,0x2f,0x29,0xf8,0x77,0xb5,0x6a,0x91,
+0x36,0x24,0xfb,0x8b,0x32,0x4e,0x47,0x24,0xae,0x39,0xdb,0xda,0x72,0xbd,0x13,0x88,
+0x2b,0xf0,0x12,0x5d,0xd4,0x90,0x95,0xd9,0x47,0x32,0xf1,0x77,0xc0,0x31,0x77,0xc0,
+0xbc,0x0e,0x77,0x5c,0x61,0x15,0x48,0xc1,0x9d,0xc3,0xbe,0x30,0x16,0x40,0x4b,0x7d,
+0xfe,0x39,0x29,0x5f,0x4b,0x35,0xc7,0x7a,0x06,0x1c,0x97,0xe5,0xab,0x55,0xd9,0x9b,
+0x67,0x5f,0x5a,0x52,0xb3,0xb6,0x9c,0xcd,0xa4,0x3e,0x5a,0x4f,0x03,0xcb,0x97,0xad,
+0xa8,0xd0,0x01,0x37,0x09,0xa1,0x88,0x46,0x6b,0xd1,0x0e,0x86,0xb4,0x93,0xdb,0xe1,
+0x64,0x90,0x5c,0x79,0xf4,0x36,0x68,0x00,0x08,0xc0,0x8a,0x24,0xfa,0xf7,0x49,0xef,
+0xcf,0x22,0xf6,0x73,0x54,0xd3,0x63,0xba,0x61,0xe0,0xa9,0x50,0xe0,0x6d,0x03,0x1c,
+0x50,0xe6,0xb5,0x3a,0x8a,0xda,0xa6,0xb1,0x46,0x5e,0x7b,0x5d,0xbf,0x17,0x0c,0xb0,
+0xb9,0x9b,0xb3,0x66,0x32,0x6a,0xc8,0xb7,0x32,0xfb,0x05,0x5d,0x30,0x90,0x2c,0xf4,
+0x3c,0xc8,0x76,0xf5,0xa6,0xad,0xd6,0x6d,0x94,0xca,0xe2,0xab,0x6a,0xd3,0x76,0x56,
+0x03,0x25,0xa7,0x54,0xcb,0x49,0x0f,0x34,0x72,0x41,0xbb,0x21,0x72,0x8a,0x30,0x56,
+0xa0,0xf9,0x29,0xd4,0x52,0x4d,0xec,0x7c,0x4c,0x45,0x8c,0x68,0x92,0xfa,0x45,0x94,
+0xfa,0x9b,0xdb,0x49,0x00,0x60,0xef,0xc1,0x61,0x10,0x04,0xaa,0x20,0x50,0x66,0xc7,
+0x88,0x02,0x3a,0xaa,0xde,0xfc,0x85,0xf2,0x1e,0x3f,0x38,0x7c,0xf2,0x78,0xff,0xc1,
+0xa3,0x27,0x5e,0x40,0x13,0x2a,0x30,0x21,0x89,0x66,0x75,0x13,0x75,0x6d,0x2a,0x21,
+0xc4,0x72,0x8e,0x0a,0x93,0x08,0x4c,0x22,0x80,0x24,0x38,0x1f,0x26,0x67,0x6a,0x82,
+0xe1,0xa4,0x3a,0xff,0xe9,0xe4,0xf5,0xab,0xc8,0xf3,0xba,0x24,0x43,0xd2,0x9e,0x8e,
+0x21,0xcc,0x0c,0x94,0x9a,0x38,0x52,0x28,0x50,0xee,0x31,0xaa,0xb9,0x4a,0xd3,0xa4,
+0x08,0xd6,0xe8,0xc7,0x6b,0x3f,0xa7,0xb1,0x2d,0x31,0x36,0xe4,0x37,0x75,0xe5,0x1b,
+0xcb,0x72,0xe1,0xac,0xf8,0x93,0xbd,0xc3,0x01,0xc1,0x3b,0x82,0x11,0xcb,0x5e,0x0c,
+0x0c,0xc1,0x79,0xa8,0xae,0x82,0xe6,0xf6,0x63,0xd4,0xba,0xa4,0x25,0x89,0x71,0x02,
+0xfe,0xbd,0x4f,0x9f,0xf8,0x90,0xf2,0xe9,0x53,0x44,0x27,0x03,0x45,0x50,0x44,0xa8,
+0x36,0x12,0x84,0x51,0x52,0x2d,0x49,0xf1,0x31,0xfa,0xd6,0x46,0x44,0x5b,0x9c,0x35,
+0x4d,0x9a,0x0b,0x29,0xcb,0xc8,0x9b,0x60,0xc7,0x6e,0x37,0xca,0xec,0x07,0x94,0xe4,
+0x15,0xcc,0x1f,0xeb,0x33,0x90,0x0e,0x90,0x4a,0x4b,0x85,0xf4,0xb9,0x0f,0x68,0xfb,
+0x18,0xdf,0xf4,0xf0,0xe0,0x6c,0x77,0xb7,0x5a,0x9a,0x20,0x8f,0x6a,0xaa,0x41,0x1b,
+0xd5,0x42,0xa1,0x35,0x05,0x1c,0x03,0x14,0xd2,0xd7,0x00,0x28,0xb4,0xed,0x13,0xda,
+0xee,0xd5,0xe6,0xf3,0x13,0x82,0x75,0x29,0x81,0xe6,0x3e,0x55,0x42,0x7b,0x28,0xa6,
+0xf9,0xb2,0xd9,0x3f,0x72,0xf5,0x36,0x77,0x4c,0xa7,0x93,0x78,0x7c,0x4b,0xd9,0xf1,
+0x91,0x27,0xc2,0xc9,0xa0,0x29,0xf1,0xa9,0x74,0xe8,0x33,0xe5,0xa1,0x5a,0x3a,0x48,
+0x7b,0x2e,0x69,0x84,0x43,0x9d,0xee,0xd0,0x97,0xfb,0xc6,0x60,0x87,0xfb,0x3f,0x18,
+0xca,0xda,0x99,0x63,0xe2,0x0f,0x6b,0x9c,0x37,0x5a,0x89,0x40,0x16,0x4b,0xe8,0x85,
+0x68,0xed,0x06,0xbc,0x78,0xdc,0x58,0x67,0x73,0xd2,0x89,0x0c,0x35,0xc7,0xf9,0x05,
+0xa3,0xa1,0x42,0x1d,0x06,0x66,0x4b,0x7a,0xe7,0x59,0x36,0xd3,0x71,0xea,0x1c,0x62,
+0x79,0xab,0x95,0xaa,0x04,0x41,0x15,0xd3,0x64,0x52,0xfa,0x01,0x51,0x32,0xc4,0xd6,
+0x0b,0x22,0xe6,0xaa,0x7a,0x30,0x85,0x67,0x8c,0x98,0x89,0x5a,0x85,0xcc,0x30,0x84,
+0x8d,0x9e,0x32,0x53,0xc6,0xee,0xf4,0xfe,0xdf,0x50,0x01,0xb8,0xe5,0x0e,0x20,0xaf,
+0xd7,0xb3,0xef,0x45,0x94,0xac,0x56,0x39,0x38,0x14,0x83,0x38,0xff,0x10,0xf0,0x1b,
+0xf0,0xed,0x85,0x4c,0x73,0x61,0xbb,0xc9,0x0a,0x82,0xdd,0xdd,0x18,0x60,0x79,0xe0,
+0x13,0x97,0xc7,0x49,0xcb,0x30,0x8d,0x67,0xb7,0x2f,0xc7,0xc8,0x18,0x0c,0x80,0x12,
+0xc3,0xe1,0x59,0xd8,0x94,0x0f,0xbb,0xbb,0xff,0x6a,0xbc,0x0f,0x90,0xc3,0xce,0x06,
+0x0e,0x21,0x09,0x10,0xb6,0x5b,0x59,0xf1,0xec,0xf6,0xc8,0xca,0x61,0x54,0x1a,0x6e,
+0x7c,0x3b,0x89,0x2f,0xf8,0x0b,0x63,0xfe,0x3f,0x97,0x3a,0xbf,0xb5,0x32,0xe2,0x29,
+0x2a,0x04,0x51,0xd0,0x3a,0x90,0x50,0x8c,0xb1,0xb1,0x00,0x16,0x2c,0xfc,0x34,0x35,
+0x54,0x9f,0x06,0xed,0x9b,0x1a,0x3d,0xd5,0xa4,0xf6,0xb0,0xd9,0xe8,0xe8,0x12,0x36,
+0xb3,0x12,0x84,0xee,0x5b,0x6e,0x58,0x4b,0x9d,0xa0,0x2f,0xdb,0xae,0x26,0xb0,0x9d,
+0x83,0xbe,0x15,0x8d,0xd4,0x29,0x5a,0xdc,0xe8,0x15,0x1e,0x92,0xe2,0x07,0x53,0x61,
+0xf4,0x91,0x5f,0x7f,0x63,0xa4,0x1c,0x7d,0xe2,0x17,0x96,0xc6,0xd1,0x53,0x7e,0x7e,
+0x37,0x43,0x1f,0x44,0x11,0x12,0xbd,0xe6,0x94,0x17,0xf3,0x45,0x79,0x6b,0x52,0xb6,
+0xc8,0xac,0x5f,0x9d,0x0c,0xcb,0x5a,0x28,0xdb,0xbe,0x50,0x17,0x92,0x54,0x6a,0x77,
+0x07,0xe4,0x88,0x96,0xdc,0x72,0x45,0x59,0x1d,0xad,0x4a,0x3a,0x46,0xd1,0x7c,0x62,
+0xc6,0x67,0x24,0xb8,0xa2,0x23,0x1a,0x08,0xf6,0x59,0x74,0x8f,0x06,0x85,0x0e,0x2d,
+0x9e,0x17,0x0a,0x64,0xab,0x95,0x37,0x5c,0xc6,0x6a,0xb3,0xa8,0xc6,0xe5,0x32,0x19,
+0xe3,0x08,0x02,0xfa,0x5e,0x2e,0x16,0x59,0x5e,0x12,0xb6,0xa3,0xfd,0xb3,0xc8,0xe5,
+0x09,0x70,0xa8,0x95,0x8e,0x73,0x95,0x81,0x96,0x87,0x67,0xc4,0x36,0x48,0x0f,0x14,
+0xd0,0x90,0xf3,0x08,0x33,0xfd,0xd8,0x6a,0x68,0xfa,0x39,0x4e,0x2f,0x69,0x84,0xe3,
+0xce,0x30,0xa7,0x43,0xac,0x12,0xcd,0x4e,0x4a,0xa7,0xbc,0xc5,0xb2,0x98,0x62,0xdb,
+0x08,0x2f,0xa1,0xa2,0x99,0xcc,0x96,0x64,0xcf,0x70,0x96,0x69,0xcd,0x6e,0x06,0xf8,
+0x05,0x0c,0x63,0x6d,0x44,0x4a,0xfb,0x2e,0xab,0xba,0xc5,0x54,0x82,0x43,0x56,0x3f,
+0xad,0xfb,0x45,0xa7,0x2a,0x22,0x11,0x33,0x0f,0x74,0xa4,0x82,0xb4,0xc0,0x0f,0xe4,
+0x78,0xb4,0x73,0x18,0x54,0x47,0xb7,0xaa,0x77,0x89,0xf4,0xce,0x2d,0x04,0x91,0x99,
+0x28,0xfa,0xd9,0x28,0xd4,0xaf,0x4a,0xa3,0x83,0x17,0x10,0xd2,0xed,0x0c,0xab,0xa8,
+0xb1,0x13,0x00,0xb9,0x9c,0xd0,0xe8,0x20,0x49,0xe7,0xfb,0xfa,0x58,0x19,0xd1,0x1f,
+0x79,0xad,0x44,0xa8,0xf7,0x4c,0xd8,0x54,0xe7,0x0d,0x6b,0x7b,0x3a,0xb2,0xc4,0x1d,
+0x4b,0xca,0x82,0x22,0x3b,0xcf,0x01,0x25,0x8c,0x12,0xa9,0x23,0x64,0xda,0x79,0x91,
+0xe7,0x40,0xd9,0x3d,0x28,0x61,0xc0,0x29,0xbd,0x8e,0x17,0x6c,0xc8,0xe2,0xcb,0xa1,
+0x37,0x14,0xb5,0x61,0x07,0xf2,0xbf,0xeb,0x9d,0x79,0x67,0x24,0xbb,0x1a,0x0a,0x2c,
+0x66,0x7f,0x69,0x74,0x67,0x58,0x60,0x98,0x5b,0x66,0x08,0x80,0x3f,0x5e,0x8e,0x34,
+0x12,0xe4,0x41,0xd1,0x92,0xe1,0x8d,0x7e,0x54,0x01,0xc2,0xc2,0x33,0xfd,0x28,0x43,
+0xd9,0x61,0x45,0xe3,0x4a,0x34,0x78,0x48,0x90,0x07,0x45,0x08,0xbc,0x8d,0xaa,0x7d,
+0xa3,0xc0,0x01,0xc0,0xb8,0x0f,0x91,0x99,0xed,0x22,0x8c,0x18,0x13,0xcb,0x8c,0x34,
+0x74,0xb0,0x4a,0x55,0x57,0x66,0x34,0x86,0x5c,0x5b,0x25,0x0c,0xa8,0x0c,0x4b,0xc9,
+0xb6,0x0e,0x5c,0x0b,0x23,0x8e,0x45,0x8e,0x1e,0x97,0x98,0x61,0xe2,0xc3,0xac,0x16,
+0x1b,0x94,0x20,0x4f,0x1c,0xb8,0x70,0xd8,0x78,0x41,0x6a,0xe9,0x57,0x49,0x01,0x09,
+0x04,0x8d,0x8b,0xf7,0xfc,0xed,0xeb,0x23,0x39,0x1a,0xbc,0xe2,0xa3,0x96,0xe7,0x42,
+0x27,0x2a,0xb5,0x56,0xa0,0x1e,0x45,0xfd,0x58,0x2b,0x70,0xd8,0xba,0x65,0x07,0xb5,
+0xb2,0x02,0xc4,0xaa,0xb4,0x08,0x60,0x85,0xf4,0x77,0xa8,0x9f,0x44,0x07,0xac,0xd9,
+0xa3,0x37,0x43,0xdd,0x67,0x6b,0x55,0x66,0x4c,0x03,0x2d,0xe3,0xe6,0x7c,0x68,0xc4,
+0xa7,0xb9,0x49,0xbe,0xe8,0xfb,0xb2,0x18,0xdd,0xad,0x12,0x60,0x77,0x5f,0x2e,0xdd,
+0x10,0x82,0xa2,0x18,0x82,0xee,0x91,0x3e,0xd5,0xec,0x18,0x4c,0xbc,0x99,0xd0,0x86,
+0x16,0xd7,0x8a,0xea,0x6a,0x9b,0xf4,0xbc,0x07,0x35,0x7f,0x7e,0x5b,0x0f,0xfd,0x3b,
+0x96,0x7e,0x87,0x36,0xe4,0xda,0xce,0xa9,0xe8,0x41,0xda,0xea,0x26,0xc5,0xfd,0x80,
+0x7b,0x97,0x66,0xa5,0x5f,0x3f,0x04,0xa4,0x34,0x2b,0x5a,0x9b,0x74,0x00,0x87,0x39,
+0x19,0x11,0x77,0x16,0x62,0xc3,0xda,0x87,0xad,0x7b,0x3d,0xf5,0xdf,0x48,0xed,0x42,
+0xe0,0xbe,0x7c,0x0d,0xa8,0x4c,0x52,0xb4,0x75,0xcc,0x59,0x83,0x27,0x07,0xbb,0xbb,
+0x75,0x5b,0xbc,0xea,0x07,0xa4,0xe4,0x06,0x77,0xc9,0x9a,0xb4,0x22,0x5a,0x35,0xe1,
+0xc8,0x1f,0x19,0xf4,0x0b,0xaf,0x62,0xa4,0xd5,0xb2,0x5e,0x68,0x4e,0x3b,0x63,0x2c,
+0xa1,0xb8,0x34,0x8c,0xd6,0x2c,0x8a,0x80,0x35,0x46,0xbc,0xd1,0x36,0xb6,0x95,0x89,
+0xab,0xf4,0x8a,0xe1,0x7b,0x6e,0x12,0x0d,0xf7,0x92,0x52,0xcf,0x03,0x4b,0xad,0x9a,
+0xe6,0x12,0x32,0x59,0x72,0x6f,0x02,0x27,0x1a,0xb2,0x73,0x02,0x78,0x7c,0x50,0x31,
+0x7b,0x9a,0xd3,0xb5,0x83,0x0f,0xd7,0x6a,0x1a,0xdf,0x3f,0x57,0xa6,0x1b,0xdb,0x74,
+0xfa,0x5c,0xf4,0x74,0x15,0x8a,0x30,0x43,0x25,0xa5,0x28,0x0d,0x52,0x50,0x27,0xf4,
+0xa3,0xb4,0x19,0x7c,0x21,0xc4,0x3f,0x5b,0x5a,0xd9,0x3b,0xe4,0x1d,0xc8,0x6d,0x09,
+0x38,0x2b,0x65,0x0b,0xda,0x37,0x05,0x4d,0xe1,0x61,0x40,0xc4,0x96,0x17,0xa5,0xbb,
+0x5f,0x58,0x51,0x17,0x99,0x75,0xab,0x64,0x03,0xe0,0x16,0xf7,0xac,0x64,0xed,0x2c,
+0x94,0x65,0xf1,0xbd,0xa5,0x1c,0x5a,0xd8,0x3b,0xbc,0xbf,0x06,0x1a,0x48,0xb8,0x8d,
+0x77,0x13,0xae,0xa4,0x5f,0xf1,0x11,0x80,0x82,0xca,0x32,0x64,0x41,0xee,0xc0,0xd5,
+0x10,0xb7,0x76,0xa2,0x5f,0x6d,0xc6,0x22,0x9b,0x1b,0xa2,0x49,0xda,0x76,0x85,0x33,
+0xd3,0xb2,0x2d,0xd6,0x41,0x48,0x0a,0xf5,0x7a,0x0c,0x68,0x4c,0xf0,0x7d,0x4d,0xca,
+0x66,0x26,0x89,0xb7,0x6f,0x2f,0x60,0x9d,0x99,0xeb,0xc3,0x68,0x31,0xd8,0xd1,0x2c,
+0x2b,0xb4,0x3b,0x63,0x95,0xe8,0x4f,0xec,0x54,0x13,0xb8,0x3e,0x64,0x1c,0xb6,0x3d,
+0x60,0xd6,0x44,0xd0,0xa0,0x71,0x12,0xc2,0x3c,0x42,0x8d,0x5c,0x13,0x61,0x12,0x80,
+0xa7,0x86,0xf5,0x8e,0x4b,0xa8,0x83,0x40,0x94,0x51,0x22,0x88,0x74,0xe7,0x01,0xb2,
+0x30,0x95,0x56,0x0c,0xad,0xdf,0x20,0x53,0x49,0x6f,0x92,0xaa,0x55,0xf6,0x6a,0xd2,
+0xd2,0x9a,0x25,0x49,0xaa,0x0d,0x4e,0xb5,0x8b,0x68,0x4b,0x5a,0x0c,0x12,0x7e,0xd9,
+0xd0,0xa9,0x04,0xdc,0x85,0x92,0x77,0xb7,0xbb,0x71,0x06,0xd8,0x78,0x66,0xe3,0x10,
+0x7d,0x5b,0xab,0x85,0xed,0xdb,0x2f,0xb2,0x1e,0xa6,0x77,0x6d,0xfb,0xe8,0x17,0xcb,
+0xa4,0x16,0xb3,0xe5,0xe8,0xb3,0xef,0xd5,0x4d,0x92,0x52,0x81,0xca,0x5a,0x4b,0x4a,
+0x7b,0xe9,0xaf,0xac,0xe1,0xaf,0x96,0xa3,0x48,0x35,0x22,0x0d,0x8b,0xfb,0xa4,0x4a,
+0x7b,0x1d,0x8e,0xf0,0x73,0xf5,0x10,0x6b,0x16,0x64,0xe7,0x50,0x08,0x5f,0x14,0xdf,
+0xdb,0xaf,0x16,0x18,0xf6,0xab,0xdf,0x38,0x41,0xb4,0xd9,0x85,0xf8,0x44,0xb2,0xb6,
+0x83,0xd0,0x04,0xff,0xbf,0x57,0x2e,0x72,0xa2,0xab,0x5d,0xa1,0x5e,0xf3,0x34,0xb7,
+0xe2,0x9c,0x36,0x94,0x53,0x43,0x01,0xb2,0x7f,0xd1,0xa0,0xa7,0xd9,0xf5,0xf7,0xb6,
+0x6f,0x4d,0x6a,0xc2,0xb0,0xc8,0x46,0xd7,0x33,0xb6,0x38,0xec,0x84,0xed,0x44,0x74,
+0xb0,0x36,0xc3,0x6d,0x59,0xf7,0xb8,0x63,0xdf,0x30,0xf0,0xb5,0x57,0xfb,0xd2,0x8a,
+0xd8,0xb1,0xa6,0x93,0x63,0xc0,0x8b,0x67,0xb4,0x58,0xbf,0x25,0xe5,0xf4,0x5e,0xee,
+0x2e,0x1a,0x75,0x62,0x52,0x02,0x1d,0x88,0x05,0x5c,0xe7,0x1b,0x28,0x51,0xf6,0x17,
+0x89,0x74,0x12,0x80,0x86,0x0b,0x60,0xb3,0xe8,0x40,0xf8,0x02,0x33,0x39,0x82,0x3e,
+0x07,0x01,0x99,0x9a,0x9c,0xe5,0x86,0x9a,0xd3,0x91,0xb7,0x87,0xfd,0xfb,0xa7,0x32,
+0x03,0xc6,0x31,0x82,0x83,0xda,0xe7,0x83,0xee,0xa0,0x74,0x84,0x68,0x16,0x84,0x64,
+0x93,0x02,0x7f,0x4a,0x35,0x55,0xed,0xef,0x1c,0xc0,0x74,0xc7,0x03,0x35,0x05,0x1a,
+0x7d,0xae,0x3b,0x6a,0x2b,0xa6,0xc7,0x6a,0xbc,0x86,0x47,0x55,0xdc,0xa3,0x4f,0xca,
+0x88,0xca,0xa0,0x09,0x5d,0x84,0x3d,0xd0,0x04,0x25,0x80,0x3a,0x8b,0x1e,0x68,0xa2,
+0x78,0xa0,0xa2,0x64,0x35,0xfb,0xce,0x19,0x90,0xf4,0xe3,0x25,0xd1,0xe2,0x7d,0xb3,
+0x77,0xff,0xf0,0xad,0xfe,0x2b,0x32,0x93,0xc0,0x06,0x27,0xbb,0x9d,0xa1,0xf0,0x29,
+0xa2,0xe6,0x6c,0xc0,0x7e,0x58,0xf6,0x33,0xcb,0xf8,0xb3,0x6a,0xce,0x00,0x5f,0x73,
+0xdb,0x43,0xd9,0xc2,0xcb,0xb4,0xb9,0x9e,0xcd,0xf5,0x97,0xa5,0xf2,0x83,0x6d,0xc0,
+0x69,0x16,0xc3,0x21,0x22,0xdf,0xa6,0x39,0xd3,0x54,0x41,0x41,0x5e,0x97,0xbf,0xc6,
+0x77,0x84,0xe1,0xb8,0xeb,0x49,0xfd,0x9d,0x26,0xe3,0x7b,0xeb,0x81,0x29,0xa9,0xde,
+0x0a,0x66,0x1f,0x05,0x04,0xca,0x2f,0x2e,0x66,0xba,0x0d,0xdd,0xb7,0xee,0xd9,0x8a,
+0x68,0x69,0x30,0x7d,0x51,0x67,0x0c,0xec,0xa6,0x4c,0x9a,0x8d,0x40,0x4f,0x14,0x80,
+0xea,0x88,0x25,0x40,0xa1,0x9d,0xf4,0xa8,0x77,0x02,0x66,0x60,0x95,0xba,0x6a,0x3f,
+0x4b,0x35,0x58,0x3d,0x72,0x25,0xd9,0xb2,0x30,0xaa,0x99,0x63,0xe1,0xa7,0x60,0xfb,
+0x16,0x14,0x40,0xc1,0x4a,0xaa,0x62,0x60,0x4e,0x28,0xd6,0xbe,0x5d,0x1f,0xe5,0xfa,
+0x76,0x5d,0x64,0xf6,0x69,0xab,0xeb,0x80,0xce,0xda,0xd5,0x89,0x6c,0xd0,0x32,0x3b,
+0x0d,0x59,0x5f,0x33,0xd6,0xbe,0x5d,0x7a,0x66,0xce,0x7e,0xb5,0x09,0x7e,0x36,0xf0,
+0x41,0x91,0x06,0x97,0x30,0x04,0xb7,0x40,0x69,0x03,0xb3,0xe5,0xea,0x3a,0x42,0x3a,
+0xc3,0x60,0xb1,0xee,0x19,0xe7,0x77,0xf7,0x2d,0x8d,0x9c,0x56,0x39,0x1b,0x55,0x69,
+0x0e,0x82,0x06,0x0d,0x3b,0x29,0x91,0xb5,0xa9,0x43,0x65,0x03,0xe5,0x7b,0xda,0xda,
+0x49,0x27,0xbf,0xe9,0x26,0xe9,0xc8,0xeb,0x6e,0xa6,0xb5,0x82,0xda,0x28,0x34,0x0d,
+0x68,0xaf,0xfc,0x41,0x52,0x98,0x8c,0xbe,0x39,0x02,0xe1,0x4b,0x0c,0x78,0x2d,0xbb,
+0x66,0xeb,0x12,0xeb,0x82,0x53,0x51,0xf4,0xb0,0x6e,0x2b,0x0d,0x3e,0xc8,0x18,0x71,
+0xea,0x22,0x6f,0x04,0x51,0xe6,0x98,0xb4,0x54,0x99,0x09,0x00,0x80,0x52,0xf6,0xd8,
+0x59,0xfb,0x05,0xa4,0x01,0xaf,0x84,0xc3,0x78,0x77,0x77,0x6d,0x93,0x34,0xd6,0x4a,
+0x47,0x09,0x74,0x56,0x25,0x6e,0xd6,0xb0,0xbb,0x9b,0xda,0x49,0xc2,0x67,0x3b,0x4f,
+0xa4,0xfb,0xcc,0x61,0x89,0x57,0xb5,0x77,0xc2,0xbd,0x92,0x65,0x73,0xd7,0x6d,0x8d,
+0x9a,0x54,0x90,0xb5,0xc2,0xa4,0xf5,0x00,0xf3,0xa1,0x42,0xa7,0xaa,0x3a,0xcd,0x42,
+0xdf,0xb6,0x08,0xef,0xb1,0x56,0xbc,0x63,0x1f,0x9b,0x52,0x7d,0x7b,0x25,0x52,0x81,
+0x0e,0xe4,0xf9,0xf2,0x73,0x35,0xd3,0xca,0x24,0xd9,0xe9,0x63,0x29,0x67,0x87,0x0e,
+0x6c,0xa0,0xc8,0x6c,0x1d,0x36,0x0f,0xc9,0xb2,0x5b,0xd8,0xa0,0xbd,0x07,0xd5,0x4e,
+0x65,0x3a,0x9a,0xc3,0x47,0xe9,0xc1,0xe1,0xa6,0x97,0x12,0xc4,0x63,0x5b,0xdf,0xd8,
+0x20,0x93,0xa0,0xba,0xd0,0x79,0xad,0xc4,0x85,0x9c,0xfd,0xa3,0x7c,0xf0,0x3b,0xcc,
+0x3e,0x34,0xfb,0xb0,0xab,0xff,0xd7,0x3b,0x88,0x53,0xaf,0x08,0x54,0x6c,0x6d,0x23,
+0x4e,0x6d,0x8c,0xdd,0xca,0xcd,0xde,0x7c,0x39,0x2b,0x13,0x58,0xb5,0x07,0x8e,0x28,
+0xe5,0xf3,0x9d,0x97,0x2d,0xd8,0x27,0x2f,0xb8,0xff,0x9c,0x28,0x70,0x85,0x15,0xd8,
+0x7a,0xbc,0x0e,0x2c,0x27,0xe3,0xd6,0xbc,0xaa,0x31,0xdb,0xba,0x12,0x17,0x80,0x2d,
+0x59,0x1e,0xdc,0x4f,0x5b,0x7a,0x83,0xa5,0x63,0x92,0x5d,0xbe,0xd4,0x93,0x1a,0xc9,
+0xbe,0x90,0x45,0xf6,0xed,0x9d,0x95,0x7b,0xf6,0x23,0x24,0xec,0x5d,0x09,0xca,0xca,
+0xb1,0x60,0x8b,0xbd,0x8c,0xfe,0xaa,0x99,0x9e,0x90,0xee,0x8c,0x7e,0xf6,0x32,0xfe,
+0x59,0xf7,0xb1,0xf1,0xe3,0x32,0x19,0xd5,0x92,0x62,0x91,0x15,0x89,0x4c,0x01,0x59,
+0x1b,0x7b,0xf6,0x35,0x82,0x31,0x7e,0x16,0x93,0xd1,0x1f,0x88,0x4f,0xb2,0xf2,0xc1,
+0x9f,0xec,0x5b,0xce,0xd6,0x0c,0x9c,0x35,0xee,0x0b,0x52,0x70,0xb6,0xe4,0x33,0x78,
+0x8e,0x90,0x85,0xfd,0x68,0x96,0xa0,0xb7,0xef,0x31,0x83,0xbe,0xa5,0x8a,0x3b,0xee,
+0x9c,0xe6,0x5e,0x75,0x8d,0x92,0x73,0x11,0x5f,0xe8,0x0f,0x6f,0x79,0x40,0x8a,0xc6,
+0x42,0x1a,0xc6,0x85,0xfb,0xf1,0x77,0xf3,0x91,0xfd,0x2e,0x42,0x98,0xa4,0xa7,0xbd,
+0x9c,0x9a,0x00,0x44,0xe7,0xa4,0x40,0x89,0x27,0x46,0xf3,0x93,0xa4,0xc1,0x62,0xa4,
+0x30,0x0a,0x77,0xeb,0x25,0xbc,0x34,0x15,0xc5,0x99,0x21,0x3d,0x7e,0x64,0x58,0x25,
+0xa6,0xdb,0x1e,0xce,0x69,0xd4,0x99,0x19,0x2b,0xbd,0xe4,0xdb,0xe0,0x37,0x53,0x8c,
+0x8d,0x37,0x95,0x21,0xd5,0xc2,0x67,0x02,0x79,0x87,0x47,0xe2,0x2b,0x9a,0x6f,0x83,
+0x64,0x81,0xa7,0x4f,0x59,0x35,0xcd,0x36,0x61,0xa8,0xd9,0xab,0x3d,0x24,0x34,0x53,
+0x6e,0xe8,0x65,0x0b,0xf2,0xf7,0xaa,0x6b,0xd6,0xf7,0xd4,0xcc,0xb6,0xa7,0x62,0xcd,
+0xae,0x41,0x31,0x30,0x7c,0xd3,0x24,0x49,0x6e,0xa0,0x01,0xcc,0x4b,0x07,0xe0,0x70,
+0xc9,0x20,0x8e,0xc8,0x2b,0xb0,0x0b,0x61,0xd3,0xfd,0x89,0xe7,0x28,0xbc,0xff,0xe0,
+0x22,0x20,0x5e,0x98,0xa9,0x6d,0xd1,0xa7,0xe2,0x56,0x45,0xd4,0x71,0xac,0x1d,0x25,
+0xfa,0x2a,0x8d,0xd0,0xd3,0x20,0xee,0xa2,0x21,0x6d,0x1b,0xc2,0x16,0x26,0x39,0xd1,
+0xf5,0xfa,0xde,0x5f,0x6f,0x8f,0xcf,0x0b,0xfd,0x6f,0x1e,0xb3,0xa4,0x34,0x68,0xe0,
+0x04,0xd2,0xb2,0x1b,0xa1,0xa9,0x6e,0x4c,0x1c,0x59,0x1c,0x52,0xda,0xe4,0xc0,0xc0,
+0xa0,0x08,0x39,0x4b,0xd3,0x27,0xe2,0x1c,0x61,0x13,0x79,0xd6,0x68,0xb2,0x3e,0x75,
+0x1b,0x1e,0xc3,0x9a,0x29,0xb6,0x94,0xb5,0x57,0xef,0x2a,0x4d,0x9a,0xa7,0xba,0x0d,
+0x61,0xc4,0xda,0xe5,0xdf,0x78,0x62,0xd5,0x9f,0xac,0x85,0x24,0x7b,0x15,0xb4,0x8a,
+0x5f,0xa9,0xbc,0x9d,0xd3,0xd0,0xca,0xd7,0x3e,0x34,0x46,0x44,0x22,0x99,0xb4,0x83,
+0x82,0xe0,0x7f,0xab,0x10,0xbc,0xc3,0x85,0xf2,0x00,0x68,0x5d,0xa4,0xdd,0xfe,0x69,
+0xd1,0xdd,0xbf,0x68,0x17,0x78,0x16,0x66,0xd9,0x61,0xfb,0xae,0xea,0xd0,0x4a,0x41,
+0x95,0x54,0x72,0x5d,0xda,0x52,0x79,0x17,0x8a,0x16,0x48,0x51,0x00,0x9c,0xa0,0x9b,
+0xf4,0x2e,0xb3,0x24,0x65,0xa1,0x8a,0x3d,0x2b,0xb3,0x6d,0x25,0xf6,0xc6,0x70,0xbf,
+0x0a,0x94,0xd3,0xfb,0x07,0xdb,0xb4,0x01,0x76,0x7e,0xab,0x4e,0xae,0xfd,0xa4,0x1a,
+0xbe,0x23,0x56,0x61,0x82,0xfe,0xf6,0xd0,0xa1,0x06,0xaa,0x84,0x27,0x2d,0x91,0xa2,
+0x01,0x60,0xdb,0x99,0xca,0x13,0x63,0xfa,0xa6,0x21,0x59,0xc4,0xbf,0x39,0x1a,0xc7,
+0xdf,0x52,0xb7,0x2d,0x9f,0xf1,0x15,0xc9,0x2a,0x41,0x51,0xd4,0xc2,0x3f,0x37,0x0d,
+0xe1,0x50,0x58,0x7c,0xab,0xb7,0x98,0x36,0x9f,0x5d,0x41,0x06,0x3b,0x59,0xbd,0x54,
+0x9a,0x8e,0xa3,0x38,0x8a,0x59,0xaa,0xa2,0x84,0xac,0xe7,0xcc,0x3b,0xb3,0x91,0x6a,
+0x41,0x8a,0x51,0x9e,0xcd,0x66,0x27,0x2e,0x98,0xd1,0xd5,0xb1,0xd5,0x4a,0x07,0x03,
+0x78,0xbd,0x2a,0xb3,0x57,0x83,0xb2,0x7e,0xc3,0x82,0x91,0x56,0x58,0xb6,0xae,0xd8,
+0xa6,0x38,0xac,0xdf,0x61,0x0e,0xe9,0x60,0x6b,0x83,0xdb,0x92,0xd0,0xc6,0x84,0xf7,
+0x7d,0xf4,0x9d,0xb7,0x0f,0x6c,0x0c,0x5a,0xdb,0xc1,0xbc,0x22,0x91,0xf4,0xdd,0xa3,
+0xa1,0xdc,0xdf,0x3d,0x1c,0xae,0xda,0x1d,0xcf,0x87,0xef,0x1e,0x0f,0x15,0xfd,0xea,
+0x80,0x0c,0xfc,0x91,0xf7,0xdf,0x65,0x40,0x56,0x8c,0xbb,0xa5,0xda,0x46,0x53,0xe9,
+0x9f,0x95,0x08,0xee,0x0d,0x78,0x61,0x34,0x92,0x35,0xca,0xc8,0xa3,0xb1,0x71,0xed,
+0xb0,0x50,0x9c,0xf5,0x35,0x03,0xc6,0x1e,0x07,0x82,0x38,0x0e,0xd6,0x90,0xdc,0xb6,
+0x84,0x9d,0x96,0x84,0x71,0x49,0xc4,0xf6,0xca,0x1f,0xe0,0x59,0xc8,0xa6,0x8e,0x40,
+0x20,0xc8,0x1c,0x22,0x38,0x49,0xf7,0x90,0x01,0x5b,0x1e,0x22,0x82,0x19,0x04,0x30,
+0xcb,0x57,0x73,0x53,0x0e,0x93,0x9d,0x31,0x4f,0xb7,0x99,0x5b,0x33,0xc6,0xe3,0x02,
+0xe2,0xa4,0x47,0xd5,0xef,0x89,0xc3,0xa6,0x2d,0xc5,0xd8,0xe3,0x5b,0xc5,0xb8,0x27,
+0x6e,0x39,0x1e,0xaa,0x0c,0x27,0xaf,0x61,0x96,0xe9,0xb2,0x54,0xba,0x5e,0x5b,0x1c,
+0xf8,0x6e,0x43,0xa9,0xfa,0x55,0xbd,0x82,0xd5,0xe6,0x94,0xdb,0x4b,0xb1,0x5a,0x89,
+0x31,0xb1,0x4f,0xda,0x7d,0xb3,0x04,0x65,0x3d,0xff,0x70,0x15,0xa9,0x70,0x5d,0x3d,
+0x53,0x35,0xb4,0x23,0x35,0x50,0xd9,0xa8,0xb0,0xb6,0x45,0x13,0xb9,0x70,0xb8,0xc4,
+0x18,0x5e,0xb3,0x30,0x9a,0xf3,0xb3,0x6c,0x7b,0x35,0xdc,0x74,0x71,0x3d,0x6b,0xe5,
+0x26,0xd6,0x6b,0xbb,0xf2,0xb4,0xeb,0xed,0xb7,0x8a,0x32,0x3e,0xaa,0xba,0x2e,0x76,
+0x10,0xdb,0xd4,0x1c,0xa1,0x98,0x2d,0x2e,0x07,0xee,0xb6,0xb1,0xb5,0x72,0xde,0x5a,
+0x9f,0x00,0x44,0x07,0xc5,0xd0,0xe3,0x83,0xb9,0xd7,0x4d,0xce,0xc2,0x07,0x9c,0xb2,
+0xe9,0x46,0x32,0x34,0xfb,0x94,0xb3,0xf8,0x59,0x93,0x90,0x31,0x63,0x19,0x5a,0x0d,
+0xdb,0x0f,0xb9,0x45,0xcd,0x61,0x79,0x26,0xb5,0x95,0x06,0x39,0x84,0x21,0x61,0x2e,
+0x9f,0xcf,0xa8,0x60,0xe5,0xea,0xaa,0x45,0x18,0xd4,0x16,0x07,0xfd,0xb7,0x47,0x32,
+0xc0,0xf2,0x2c,0xda,0x34,0x9f,0xc0,0x4b,0x22,0x37,0xca,0xfd,0xda,0xe3,0xa8,0x4d,
+0xb4,0x01,0xa0,0x51,0xf0,0x43,0x6d,0xab,0x80,0x9a,0x24,0x26,0x2b,0xae,0x3c,0x5b,
+0x8f,0x7e,0x1d,0xba,0x9e,0x56,0x8c,0xf8,0xa2,0x56,0xed,0x65,0x6e,0x81,0xee,0x21,
+0x33,0xa9,0xd6,0x39,0x50,0xcb,0xe0,0x0e,0xa7,0x8d,0xc1,0x12,0xee,0x76,0x8e,0xd7,
+0xe6,0x32,0x3a,0xa0,0xa6,0x96,0x3d,0xd2,0xe3,0x18,0x05,0x0e,0x59,0x71,0x28,0x89,
+0x95,0x8c,0x6c,0xba,0x0d,0x1f,0x71,0x4a,0x58,0x1d,0x0a,0x26,0x91,0x63,0xfd,0xd9,
+0xf2,0xf7,0x81,0x6a,0xb4,0x9f,0xb7,0xcb,0xd4,0x09,0x56,0x96,0x28,0xb7,0xa1,0x65,
+0xab,0xbc,0xcc,0x2a,0x48,0xde,0x49,0x5d,0x0d,0x30,0x90,0x0a,0xda,0x01,0x36,0x7c,
+0x66,0x94,0xa5,0x18,0x8c,0x9a,0xec,0xee,0xfe,0xb8,0x11,0x54,0x64,0x7c,0x61,0xaa,
+0x5d,0x84,0x69,0x3d,0x3e,0x7a,0xff,0xf2,0xdd,0x89,0xb7,0xe3,0x26,0x37,0x29,0x96,
+0x1c,0x5f,0x4b,0x3e,0xfd,0xb3,0x2f,0xf8,0xfe,0x65,0x7c,0x15,0x83,0xce,0x92,0x45,
+0x29,0xa5,0xe8,0x1b,0xe5,0x29,0xf2,0xd1,0x6a,0x65,0x8e,0x2e,0x1a,0x67,0x43,0x01,
+0x79,0x92,0xa0,0xca,0x5a,0xab,0xc4,0x22,0x75,0x1d,0xc8,0x16,0x1c,0x26,0x03,0x44,
+0x15,0x9c,0x64,0x00,0x42,0x32,0x02,0xaf,0x0b,0x2d,0xb2,0x27,0xe3,0x40,0xe2,0x53,
+0xf6,0x28,0x0f,0x1c,0x5a,0x72,0x2d,0xc9,0x3a,0x20,0x0f,0x49,0xa1,0x5b,0x96,0xd1,
+0x20,0x01,0x78,0xc7,0xd5,0x1e,0x3e,0xe2,0xfb,0x78,0xd2,0x5b,0xa6,0xc9,0x9f,0xd1,
+0x1b,0x3c,0xc0,0x4c,0xa2,0xf3,0x24,0x9e,0xc1,0xc2,0xc9,0x07,0x85,0xe8,0x77,0x74,
+0x83,0xc3,0xe4,0xa2,0x13,0x95,0xae,0x31,0x95,0x66,0x04,0x12,0x1f,0xc7,0x7f,0x95,
+0xd8,0x8f,0xb0,0x15,0xcd,0xb7,0x07,0x38,0x37,0xda,0x47,0xc9,0xd2,0x34,0x92,0x54,
+0x31,0x0e,0xb3,0x86,0x57,0xee,0xa7,0x2f,0xc9,0x18,0x9e,0xa6,0xf2,0x10,0x69,0xf8,
+0xdd,0xd4,0xd1,0x10,0xd3,0x3a,0xfe,0x84,0xb1,0xda,0x82,0x36,0x80,0xee,0xa5,0x45,
+0x20,0x10,0x95,0x4e,0x75,0x69,0xe5,0xf5,0xe6,0x17,0x43,0x13,0x80,0x37,0x3c,0xdb,
+0x3e,0xc7,0x57,0x6d,0xee,0xf8,0xe4,0x17,0xad,0x7b,0xac,0xb8,0xd1,0x3b,0x60,0x57,
+0x9a,0x5e,0xd3,0x02,0x1c,0x35,0xaf,0x38,0x6a,0x81,0x15,0x86,0x5f,0x11,0x85,0x07,
+0x4d,0x52,0x72,0x17,0x98,0x01,0x48,0x02,0xc3,0xb2,0xb6,0x47,0x43,0x8f,0xc1,0x2a,
+0xfb,0xaa,0xa7,0x8b,0x5a,0x43,0xee,0x43,0x3b,0x57,0x5a,0xa4,0x08,0xcf,0xbd,0xea,
+0xa4,0x0b,0x2f,0x0c,0x12,0xb0,0x08,0x9c,0xa8,0xdd,0xf7,0xd8,0xe1,0x05,0x27,0x86,
+0x0a,0xea,0x3a,0xb1,0x20,0x63,0x57,0x7b,0xea,0xc6,0x7b,0x0d,0xc2,0x3f,0x56,0x1d,
+0x8a,0xf7,0xaa,0x18,0x2d,0x4a,0x02,0x67,0xf6,0x1e,0x76,0x06,0x00,0xce,0x94,0xa1,
+0xb3,0x11,0x04,0x36,0x6f,0x6a,0x98,0xb0,0xe2,0x33,0x0c,0x77,0xc9,0x53,0xc0,0xb1,
+0x65,0xf0,0x16,0xdf,0x71,0x22,0x79,0x2e,0x9c,0xb6,0x47,0xac,0x8d,0x42,0xde,0x89,
+0xa8,0xa5,0xea,0x5c,0x57,0xe2,0xba,0x0c,0x0e,0x16,0x93,0xdf,0xb2,0xcc,0xc0,0x34,
+0x22,0x93,0x3e,0x42,0x2b,0x8a,0xe1,0x94,0x22,0xc5,0xe8,0x87,0xe2,0x95,0x60,0xce,
+0xac,0xf0,0xe8,0x7e,0x0b,0x1a,0x95,0x45,0x66,0xdf,0x7f,0xe2,0x68,0x49,0xa5,0x29,
+0xf1,0x2d,0x9f,0xb0,0xee,0xa9,0xb9,0xf8,0x92,0x17,0xa0,0x87,0x84,0x60,0x2e,0xbc,
+0x8d,0x72,0xc5,0xba,0x99,0x28,0xc6,0x2f,0x0f,0x68,0xc4,0x16,0xdc,0x6d,0x9d,0x2b,
+0x09,0x27,0xe8,0x33,0xf4,0xf8,0x04,0xcc,0x56,0x5b,0xf1,0xb7,0x03,0xb5,0x67,0xba,
+0x23,0x8a,0x3d,0xcc,0x4b,0xb9,0xe1,0x0d,0x90,0x92,0x58,0x81,0x34,0x6c,0xf5,0x07,
+0xaa,0x0c,0xa9,0x68,0x1a,0xd3,0x1a,0x2d,0xb9,0x73,0xf8,0xc5,0x11,0x1c,0x9d,0xc3,
+0xae,0xbb,0xb9,0x8d,0x36,0xd5,0x40,0xd1,0x25,0x1d,0x0d,0xd0,0x50,0x52,0xbc,0x9c,
+0xcf,0x11,0x22,0x80,0x2e,0xd1,0x49,0x36,0xbe,0x88,0x29,0xdb,0x31,0xf0,0xc4,0x42,
+0x8f,0x21,0x5e,0xee,0xb0,0x56,0xd0,0xc9,0x45,0x99,0xb8,0xcf,0xc3,0x61,0x5b,0x3a,
+0xa1,0xc9,0x99,0x19,0x9d,0x28,0x48,0x25,0x4c,0x61,0x81,0xf8,0x6f,0x9d,0x47,0xcc,
+0x97,0xa0,0x06,0x5d,0xec,0x7f,0x46,0x7a,0xb0,0x1e,0x29,0xf2,0xd1,0xed,0xe7,0x7a,
+0x12,0x43,0x17,0x06,0x24,0x07,0x72,0x46,0x63,0x4e,0xdb,0xa4,0x60,0x4a,0x08,0x0b,
+0xf7,0x12,0x80,0x3c,0x11,0x11,0x6a,0x2c,0x67,0x37,0x70,0x14,0x6f,0xd3,0x7f,0x89,
+0xb0,0xaf,0x26,0x5b,0xf3,0x96,0x63,0xd3,0x05,0xf4,0x48,0x9a,0xa6,0x85,0xe7,0x40,
+0xcd,0x7d,0xc8,0xb5,0xa0,0xb1,0x6d,0x6e,0xed,0x06,0x57,0xd5,0x99,0x86,0xb6,0x30,
+0x8c,0x19,0xe4,0x8d,0x1d,0x7c,0x9d,0x60,0xb0,0xa6,0x35,0x83,0x68,0xfd,0x8c,0xe5,
+0x40,0x00,0x4b,0xa7,0x80,0xb7,0xe0,0x10,0xb6,0xf0,0x33,0xe5,0x89,0x6c,0xd8,0xea,
+0x3f,0x87,0xcf,0xb6,0x7c,0xc3,0x10,0x74,0x8f,0x79,0x8e,0x1d,0x02,0x1d,0x81,0x85,
+0x53,0x57,0x83,0xb8,0x74,0x4f,0x6c,0x3e,0x14,0x28,0x3b,0x68,0xab,0x30,0x33,0xfc,
+0x4e,0xe6,0x5b,0x8f,0x49,0xad,0x96,0xb0,0x4b,0xbd,0xa6,0x49,0x67,0x39,0xfb,0xc2,
+0x55,0xe3,0xa4,0xd6,0x74,0x96,0x60,0x29,0xfb,0x7a,0x03,0x2a,0x38,0x70,0x11,0xda,
+0xeb,0xe8,0x46,0x21,0x9c,0x30,0x37,0xb4,0x90,0x38,0xd4,0x08,0xbb,0x33,0x7d,0x3f,
+0x07,0x39,0xfa,0x09,0xe8,0xb1,0xd9,0x89,0x1d,0xa2,0x96,0xed,0x64,0x8a,0xb8,0xa1,
+0xea,0x99,0xf9,0xd3,0x7c,0x24,0x03,0x3a,0xc4,0x56,0x49,0x4c,0x3e,0x80,0xb6,0xac,
+0x50,0x72,0xe9,0x87,0xbc,0x1c,0xb6,0x12,0x19,0x55,0xf9,0x6d,0x73,0x10,0xdd,0x80,
+0xb6,0x1c,0x2e,0x73,0xec,0x7a,0xa1,0xdc,0x65,0x79,0x02,0x40,0x1f,0xcf,0x78,0x05,
+0xa0,0x1f,0x76,0x5d,0x64,0xaf,0xad,0x23,0x39,0xf8,0x0f,0xa1,0x44,0x8c,0x83,0xe6,
+0x92,0x1e,0x59,0x61,0x64,0x29,0xfd,0x92,0xbd,0x31,0xd6,0xe2,0xe2,0xa9,0x23,0xf8,
+0x95,0x9b,0x08,0x9b,0xda,0xbd,0x55,0xc2,0xdf,0x28,0x0c,0xa5,0x76,0xee,0x55,0x59,
+0x8b,0x93,0xec,0xb6,0x0e,0x6f,0x4d,0xda,0x55,0xe8,0x5b,0xe8,0xcf,0x32,0xf2,0xb2,
+0x74,0x02,0xce,0x54,0x24,0x1c,0x4f,0x6a,0x44,0xfa,0x84,0x1c,0x1f,0x91,0x88,0x58,
+0x20,0xf3,0x4d,0x9d,0xcf,0x96,0xb9,0x79,0xcd,0x96,0x88,0x0a,0xa7,0x98,0xba,0x39,
+0x6c,0x69,0x9a,0xe6,0x04,0x5f,0xf8,0x19,0x94,0x87,0x90,0x21,0x7e,0x84,0xe7,0x26,
+0x1c,0xea,0x4c,0x32,0x15,0xe8,0x23,0xf0,0x03,0x9d,0xfe,0x0c,0x17,0x69,0x4e,0x44,
+0x3b,0xa9,0x7d,0x5e,0x2e,0xec,0x13,0x11,0x6f,0xe4,0xbd,0xa6,0x47,0x9e,0x41,0x44,
+0xab,0x95,0x3d,0x9e,0xf8,0xe8,0x8e,0xfc,0xce,0xae,0xac,0xab,0xde,0x2d,0xf4,0x0e,
+0x9b,0x6c,0xa9,0xb2,0x01,0x14,0xd1,0xa3,0x86,0xfa,0x9d,0x56,0x78,0xc3,0x1b,0xfe,
+0x11,0xeb,0x27,0xc9,0xa3,0x4b,0x8a,0xc4,0x2d,0x74,0xaa,0x0d,0x69,0xa6,0xaa,0x18,
+0x54,0x4e,0x6d,0x9b,0x35,0x41,0x7d,0xe5,0x10,0xae,0x5d,0xc2,0x58,0x90,0x00,0x0b,
+0x91,0x78,0x8d,0x96,0x32,0x32,0xe4,0x58,0x67,0x8c,0x01,0x78,0xca,0x32,0x15,0x4f,
+0x7b,0x2d,0x91,0x8e,0x76,0x34,0xb6,0x49,0xc0,0x39,0x45,0x75,0x9b,0x64,0x9b,0x0d,
+0x16,0x35,0x84,0x75,0xb1,0x24,0x25,0xb3,0x0d,0xbb,0xba,0xfa,0x1e,0xdc,0x98,0x59,
+0xa1,0xdf,0xa9,0xc2,0xf2,0x49,0x2d,0x43,0xcc,0x9e,0x02,0xd4,0xee,0xf3,0xbe,0x96,
+0x33,0x84,0x4d,0x35,0x05,0x96,0xe9,0x56,0x91,0x8d,0x02,0x93,0x89,0xf1,0xe6,0xe5,
+0xfc,0x80,0xb2,0x1b,0xf5,0x3b,0x8a,0x9f,0x46,0x0b,0xe0,0x8f,0xf0,0x1c,0x63,0x09,
+0x70,0xb3,0x3d,0xd9,0xe4,0x2f,0x7e,0xde,0x92,0x7c,0xc8,0x61,0x7c,0x7f,0x48,0x2c,
+0xe3,0xca,0xd9,0xce,0x0f,0x56,0x30,0x09,0xeb,0x7c,0xf8,0xe1,0xf7,0xb3,0x07,0x01,
+0xc5,0xf2,0xdd,0x35,0xa5,0x02,0x50,0xe7,0xd6,0xd6,0xf5,0x14,0x89,0x89,0x36,0x59,
+0x45,0xb9,0xbf,0x22,0xc3,0xa4,0xe0,0x46,0xfe,0x96,0x6c,0xeb,0x7e,0x29,0x87,0xcf,
+0x99,0xc6,0x07,0xfd,0xad,0x99,0xb7,0x0e,0xef,0x66,0xe6,0xbf,0xaf,0x18,0xe6,0xbf,
+0x51,0x6e,0x06,0xb3,0x46,0xd4,0xee,0x2c,0x5a,0x81,0x0e,0x3e,0x6e,0x07,0x55,0xbf,
+0x7c,0xc7,0x0c,0x94,0xe5,0xdc,0x86,0xf1,0x1c,0x90,0xee,0x27,0xdf,0x5b,0x61,0xdd,
+0xe7,0x6f,0x54,0x99,0xa5,0x6e,0x8d,0x85,0x0b,0xb5,0x46,0x6a,0x86,0x68,0xd9,0x86,
+0xfb,0x1e,0xd0,0x4b,0x46,0x31,0xda,0xbe,0x11,0x31,0x7a,0xc3,0x52,0x30,0x15,0xa2,
+0xa2,0x6a,0xf0,0x89,0x4e,0x87,0xd3,0x00,0xa7,0x62,0x9f,0xf0,0x6e,0xee,0x2f,0xf1,
+0x77,0xc9,0xdc,0x1e,0xdc,0x75,0x09,0x34,0x15,0x47,0x05,0x45,0x79,0x41,0x98,0xe4,
+0x08,0x0f,0x82,0xf6,0x41,0x3c,0xd9,0x39,0x68,0x8b,0xbe,0x52,0xb8,0xbd,0x05,0x17,
+0xcb,0xe8,0x1c,0xb5,0x6d,0x6a,0x5f,0x39,0x0a,0x1e,0x5f,0x47,0x6d,0x61,0x08,0xc0,
+0x72,0x4a,0xce,0x4a,0x74,0x36,0x5b,0xb6,0x03,0x2c,0x42,0x56,0xa8,0x60,0xb6,0x8d,
+0xe6,0xc8,0x32,0x43,0xc1,0x44,0x0c,0xe5,0x82,0x9e,0xf1,0xf9,0x03,0xcc,0xc8,0xad,
+0x1f,0x8f,0x13,0x5a,0x98,0xb1,0xed,0x91,0xc3,0x61,0x24,0xf6,0xc7,0x3f,0x26,0x16,
+0x73,0x37,0x5a,0xe6,0x74,0xae,0x15,0x3c,0x18,0x66,0x8a,0x88,0xe2,0x87,0x04,0x2e,
+0xea,0x61,0x4e,0x42,0x14,0xc7,0xb7,0x65,0x60,0x3a,0x96,0x29,0xb0,0x92,0xfb,0xb8,
+0x99,0xa2,0x30,0x3c,0x07,0x0d,0x5e,0x51,0x38,0x12,0xd6,0x0a,0x90,0x54,0xcd,0x70,
+0xcb,0x82,0x78,0x00,0xcb,0x92,0x4e,0x26,0xcd,0xe8,0xbf,0xc2,0x72,0xd2,0xbf,0xb4,
+0x96,0xb1,0xe1,0x28,0x89,0x04,0x15,0xc5,0xbc,0x90,0x09,0x2f,0x24,0x2d,0x67,0x61,
+0x17,0x12,0x41,0x43,0x90,0x83,0x29,0x29,0x02,0xcc,0x52,0x15,0xb4,0x54,0xf1,0x96,
+0x79,0xe4,0xd6,0x6a,0x91,0xc9,0x31,0xa7,0xee,0x2e,0xc4,0xe0,0xc5,0x85,0xce,0xdb,
+0x09,0x5b,0x47,0x99,0x88,0xe5,0x66,0x0c,0x0c,0xf5,0xbb,0xec,0xb1,0x20,0x22,0x05,
+0xf2,0xa5,0x9c,0xdc,0x04,0xb1,0x8a,0x81,0x7a,0xab,0x75,0xcd,0x84,0xc0,0xa7,0x11,
+0x9c,0xaa,0x9d,0x6b,0x52,0xac,0xf8,0x65,0x7f,0x76,0xce,0x64,0x2c,0xf9,0xe6,0x85,
+0x42,0x34,0xc9,0xd1,0x85,0xfc,0x31,0xb9,0x45,0xcf,0xf5,0x8b,0xe8,0x35,0x3e,0x71,
+0x30,0x92,0xb1,0x4e,0x98,0x71,0xfd,0x14,0xa7,0xe3,0x19,0x79,0x28,0x13,0x63,0xd8,
+0x18,0xb3,0xf9,0xd6,0x22,0x28,0x01,0x59,0xbf,0x62,0x6a,0x02,0xfd,0x92,0x29,0xe0,
+0xd8,0xcf,0x36,0x26,0x42,0x93,0xd9,0xc3,0x4e,0x43,0x62,0x48,0x17,0x5b,0xc9,0x2c,
+0xf1,0x94,0x82,0xda,0x8c,0xf2,0x40,0x07,0xed,0x01,0xaa,0x79,0x64,0xe0,0x28,0xd6,
+0x1a,0x55,0x7c,0xe3,0x04,0x41,0x57,0x16,0x54,0x17,0x54,0x40,0x71,0xbb,0x56,0x16,
+0x99,0x74,0x2c,0x24,0x91,0x87,0x0e,0xe1,0x94,0x0e,0x05,0x7b,0x77,0x72,0x4d,0xce,
+0xce,0x1d,0xd1,0x9b,0x75,0x96,0x29,0x27,0x32,0x04,0xe9,0x8c,0xcf,0x67,0xf2,0x50,
+0x21,0x91,0x8e,0xc1,0x21,0x9d,0x0a,0x85,0x74,0x2a,0x44,0xd3,0xb1,0x20,0xa6,0x53,
+0x03,0x9e,0x4e,0x0d,0x72,0x3a,0xa3,0x69,0x9c,0x5e,0xa0,0x21,0xe6,0x7d,0x9d,0xcf,
+0xfa,0x96,0x2b,0xc4,0x2f,0x04,0x52,0x51,0xd0,0x03,0xea,0xd5,0x9b,0x41,0x29,0xad,
+0x58,0xbf,0xdc,0xd4,0x1f,0x7e,0xdd,0xa1,0xe0,0x9c,0x63,0x09,0x95,0xf5,0xd1,0x36,
+0xcb,0x4d,0xfa,0x32,0x72,0x05,0x93,0xf5,0xda,0x10,0xe5,0x19,0x5b,0xb1,0x4c,0xb4,
+0x9f,0x2c,0x52,0x60,0xe2,0xa8,0x2b,0xde,0x6e,0x02,0x74,0x79,0xb5,0x63,0x3e,0x2e,
+0x7b,0x06,0x8c,0x91,0x0e,0x1d,0x51,0x66,0xa4,0xc7,0x08,0xac,0x82,0x37,0xa7,0x8e,
+0xe9,0xc0,0x3b,0x5f,0x9e,0x23,0x1e,0xbc,0xf0,0x88,0x41,0x21,0xd7,0x8e,0x46,0x34,
+0x54,0x98,0xe2,0x4f,0x44,0x4f,0xb5,0xed,0x97,0x02,0x18,0xa5,0x6e,0xda,0xf4,0x50,
+0x81,0xa9,0x4b,0x8a,0x0e,0x59,0xfb,0x5f,0x53,0xb7,0x4c,0x7d,0x83,0x2c,0xe4,0x74,
+0x61,0x69,0xb1,0x0e,0x95,0x22,0xba,0xac,0x26,0x20,0xa7,0x48,0x4c,0xe8,0x41,0xb6,
+0x11,0x80,0xdf,0x54,0x77,0x28,0x13,0xb5,0x5c,0xa9,0x14,0x2e,0x66,0xd9,0x79,0x3c,
+0x1b,0x4c,0xe9,0xec,0x26,0x27,0x3a,0x4b,0x77,0x8e,0x46,0x83,0xee,0xb6,0x30,0x39,
+0x77,0x77,0xd9,0x06,0xdc,0x93,0x2b,0x05,0xba,0xdd,0xdd,0xdd,0x05,0xf5,0x94,0xd0,
+0x9b,0x47,0x37,0x36,0x21,0x7a,0x06,0x8a,0xaf,0x86,0x0e,0xa3,0x51,0x7a,0x67,0x6f,
+0xcf,0x16,0xde,0x2e,0x4a,0x26,0x84,0x86,0x36,0x43,0x39,0x1a,0x00,0xf6,0x47,0xbc,
+0xa9,0x54,0xdf,0xda,0x78,0x53,0x1e,0x43,0x26,0x08,0x4f,0x4f,0xc9,0xd6,0x19,0x18,
+0xf6,0xc9,0x55,0x4b,0xbd,0xcf,0xaa,0x7c,0x9e,0x1a,0x22,0x8b,0x09,0xec,0xaa,0xb6,
+0x98,0x93,0xd5,0xcd,0xe4,0x2a,0x4c,0x2a,0x9c,0x67,0xdc,0x24,0x6d,0x67,0x20,0xca,
+0xbc,0x62,0x39,0x1a,0x81,0xec,0xbd,0x3e,0x85,0xda,0xf1,0xa3,0x74,0x87,0xb4,0xcd,
+0x19,0x01,0x5d,0xbe,0xfd,0x04,0x3b,0x23,0x9b,0x5d,0x89,0x27,0x63,0x4e,0x2d,0x64,
+0xd4,0x86,0x5a,0x90,0xa8,0x35,0x6d,0x9b,0x7a,0xd4,0x90,0x9d,0x81,0xf0,0xf1,0x06,
+0xa2,0xab,0x79,0xcf,0x4a,0xcb,0xc9,0x3b,0xa9,0x26,0x26,0xe9,0xf1,0x9e,0x93,0xd6,
+0x33,0x0a,0x98,0xc1,0x46,0x91,0x13,0x67,0xae,0x89,0xbb,0x73,0xe3,0x24,0x0d,0xe9,
+0x0b,0x37,0x9e,0xa0,0x1b,0xdc,0xb8,0x84,0x90,0xd1,0x27,0x9c,0xc4,0xc0,0xc4,0xb8,
+0x75,0x19,0x73,0xdd,0xfa,0x8d,0x85,0x67,0xc6,0xe1,0xa5,0x6a,0x99,0x9e,0xe4,0xda,
+0x09,0x1b,0x42,0xc0,0x4d,0x2f,0xf8,0x3e,0x1d,0xae,0xff,0xc8,0x7c,0x97,0xd1,0xa1,
+0xf6,0xb9,0xef,0x8e,0xeb,0x1c,0x82,0xa4,0x7e,0xbb,0x76,0x55,0x8d,0xa4,0xff,0x88,
+0x2a,0x5f,0xad,0xbe,0x87,0x83,0x0c,0x59,0x79,0x94,0x7c,0x88,0x26,0x03,0xb9,0xdc,
+0x23,0xc4,0xf3,0x72,0xe0,0x5d,0x16,0x90,0x3d,0x61,0x51,0xdd,0xe4,0xe2,0x19,0xed,
+0x2e,0x22,0xb8,0x4c,0x12,0x84,0xd4,0x0d,0xf2,0x83,0x27,0xc8,0x75,0x20,0x75,0xb3,
+0x2f,0x1a,0x57,0x2e,0x51,0xec,0x2e,0x82,0x30,0x7c,0xa8,0x74,0x77,0xe1,0x5a,0xe5,
+0x5c,0x01,0x35,0xdc,0x1d,0x9c,0xdd,0x1d,0xaa,0x47,0xeb,0x7d,0xe5,0x0d,0xbc,0xa6,
+0x4a,0x81,0x48,0x1d,0x5c,0x9e,0x16,0x12,0x81,0x7a,0x31,0x29,0x58,0xc6,0xfc,0xeb,
+0xb8,0xec,0x31,0x0f,0xf2,0xe5,0x83,0x9c,0xb9,0x59,0x57,0xc4,0xc1,0x00,0xf1,0xdc,
+0xbc,0x92,0x3c,0xc9,0xe3,0x31,0x5b,0x80,0xe2,0x19,0x0e,0xe0,0x3b,0x92,0x4e,0x4a,
+0x4f,0xa3,0xc1,0xfe,0xf1,0x05,0xe9,0xba,0xe5,0x75,0x53,0xcd,0x8d,0x5a,0x96,0xf9,
+0x2c,0x7a,0x21,0xbf,0xca,0x34,0x66,0x7e,0x23,0xd9,0xe1,0x81,0x7b,0xa4,0xaf,0xa8,
+0xaa,0xbe,0x04,0xa1,0x3a,0x67,0x63,0xa9,0x58,0x2f,0xc7,0x78,0x04,0x91,0xd6,0xa6,
+0xb8,0x6a,0xe4,0x21,0x04,0x63,0xf2,0xd8,0xef,0x77,0x68,0x1a,0x91,0xce,0xec,0xb7,
+0x86,0x23,0xa5,0xd0,0x77,0x98,0x70,0x02,0x1d,0xe6,0x00,0xd5,0xea,0x2e,0x1c,0xf9,
+0x4d,0xc2,0x26,0xfb,0x87,0x0d,0xd6,0x45,0x07,0x54,0x1c,0x6d,0x62,0x15,0xf0,0x42,
+0x23,0x7f,0x53,0xe5,0x20,0x57,0xb6,0x7d,0x98,0x49,0x5e,0x32,0xfd,0x03,0x3d,0x22,
+0x06,0x3a,0xcc,0xbb,0xde,0x10,0x2a,0xf9,0xb8,0xbe,0xea,0x2d,0x8a,0x32,0xc7,0x1a,
+0x93,0x0d,0x52,0x76,0x61,0x40,0x7c,0x24,0x31,0xd3,0xdd,0xdd,0x62,0xc0,0xea,0x31,
+0x1f,0x06,0x13,0x58,0x12,0x00,0x74,0xc5,0x4b,0x2c,0xac,0x4b,0x40,0x6b,0x44,0x81,
+0xde,0x75,0x75,0x03,0x1a,0xc6,0x52,0xb1,0x37,0x9d,0x14,0xa6,0x0e,0xad,0x45,0xb7,
+0x41,0x4a,0x57,0x4d,0x31,0xb9,0x5b,0x37,0xf7,0x64,0xb8,0x1d,0x47,0x28,0xf5,0xf4,
+0x7c,0xf8,0xc7,0xe3,0xb3,0x87,0x50,0x06,0xe3,0xb6,0x1c,0xdc,0x9f,0x23,0xa9,0x4f,
+0x82,0xc7,0x9c,0x1c,0x3c,0xac,0x93,0xe8,0x26,0x9c,0x42,0x6e,0xc2,0x21,0x42,0x5e,
+0x11,0xd8,0x4d,0x46,0x0c,0x23,0x70,0x51,0x4e,0x6d,0xd9,0xc0,0xdd,0x38,0xf1,0xbd,
+0xd9,0xb0,0x15,0xf0,0x1d,0x5a,0x11,0x27,0x79,0x9f,0x37,0x11,0x74,0x22,0x62,0x23,
+0x91,0xbb,0x73,0x46,0x72,0xeb,0x0f,0xee,0x8d,0x99,0xd1,0xc6,0x6f,0x5e,0x10,0x13,
+0x43,0x5d,0x3e,0xeb,0x4d,0x73,0x3d,0xb1,0x23,0xc3,0xe5,0x5e,0x5c,0x17,0x27,0x2a,
+0xcb,0xf1,0x31,0x76,0x3c,0x82,0x1d,0x50,0xf4,0xeb,0xbb,0x5a,0x50,0xf3,0xaa,0x93,
+0x49,0x08,0x17,0xe1,0x60,0xd9,0x58,0x97,0x55,0x29,0x0f,0xa4,0x04,0xe9,0x8c,0xd9,
+0x18,0xa5,0xa6,0xec,0x48,0x47,0x7d,0x5c,0x1c,0x81,0xd9,0x9c,0xc7,0xa3,0xcf,0x98,
+0x07,0xbf,0x41,0x8c,0x19,0x5c,0x21,0x80,0x2f,0x33,0xda,0xe5,0x9c,0xd3,0xeb,0x76,
+0xba,0x5d,0x0a,0xba,0xdf,0xea,0xbb,0x61,0x10,0x74,0x22,0x92,0xbe,0x0f,0x8b,0x33,
+0x35,0x6a,0x9c,0x5a,0x4a,0xba,0x63,0x61,0x03,0x76,0x7a,0x82,0x6f,0x14,0xa9,0x3c,
+0x63,0x18,0x9b,0x49,0xe6,0x61,0x6a,0xee,0xf8,0x39,0x1c,0x55,0x7a,0x11,0x66,0xbf,
+0xe0,0x08,0xf3,0x04,0x1b,0x73,0x86,0x3d,0x43,0x75,0xa1,0x5a,0x8f,0xd1,0x99,0xa9,
+0xa4,0x89,0x53,0x47,0x40,0x59,0xf9,0x49,0x32,0x27,0x04,0xe6,0x4f,0x6d,0x11,0x9c,
+0x19,0x6a,0x23,0x99,0x32,0xcd,0xdb,0xed,0x0f,0x2d,0xff,0xe0,0xca,0x9f,0x90,0xa1,
+0x62,0x26,0x42,0xdc,0x68,0x54,0xa0,0x6f,0xb3,0x3d,0x95,0x0f,0xaa,0x1a,0x64,0xb4,
+0x24,0xb3,0x5a,0x63,0xda,0x96,0xd8,0xe7,0x4b,0xae,0x86,0xa6,0x63,0x12,0x55,0xa7,
+0xa2,0x0b,0x1f,0xa5,0x8d,0xd8,0xf4,0x47,0xbe,0x1d,0xb1,0x9a,0xe1,0xf0,0x52,0x57,
+0xe8,0x1a,0xc3,0xa3,0x0a,0xb9,0x41,0xf3,0x46,0xf6,0x34,0xac,0x19,0xd8,0x41,0xcd,
+0x45,0x4f,0x07,0x7e,0xaf,0x1b,0x44,0xa7,0x03,0xe2,0xa2,0x0f,0x0e,0x23,0xaf,0xcb,
+0x97,0x89,0xd0,0xbd,0x47,0x8d,0x9b,0x64,0x62,0x42,0xcb,0xa5,0xcc,0x06,0xc5,0x4c,
+0xfa,0xd3,0x08,0x36,0x60,0x3b,0x3d,0x4e,0x93,0xe8,0x96,0xc9,0x46,0x4b,0x51,0x95,
+0x09,0xa8,0x97,0x6b,0x43,0x77,0xc7,0xba,0x2c,0x29,0xa2,0x08,0xde,0x96,0xc4,0x7f,
+0x98,0x85,0xaa,0x1a,0x47,0x84,0xe7,0x15,0x97,0x3a,0x57,0x3c,0x6d,0xf8,0xb5,0xa2,
+0x8d,0x1f,0x59,0xde,0xb1,0x69,0x54,0x09,0xa2,0x09,0x77,0x0e,0xd4,0xcd,0x34,0x6f,
+0x0b,0x45,0x86,0xca,0xca,0xec,0x86,0x0f,0xaf,0x5f,0xfd,0x54,0x96,0x8b,0xf7,0x1a,
+0xd7,0x29,0x14,0xd0,0x47,0xc6,0x68,0x63,0x81,0x40,0xa9,0x3b,0x21,0xbe,0x70,0xd3,
+0x18,0xa9,0x3a,0x8d,0xed,0x78,0x4f,0xfa,0xcd,0x9e,0x63,0xbe,0x54,0x44,0xe6,0xe1,
+0x52,0x61,0x43,0x87,0x8d,0xcd,0x8c,0x04,0xd5,0xe1,0xfa,0x49,0xec,0x19,0xe7,0x7c,
+0xf1,0x83,0x97,0x66,0x17,0xc4,0x52,0x49,0xbf,0x99,0x67,0x10,0x5a,0xd9,0x1c,0x6f,
+0xf0,0x4f,0x53,0x66,0xfa,0xe0,0x16,0xe2,0xc8,0x33,0x1a,0xed,0x08,0x1c,0x57,0x87,
+0xa4,0xbe,0x92,0x39,0xdd,0x3a,0xe0,0xc7,0x74,0xc0,0xb7,0xa7,0x75,0xe8,0x5c,0xb1,
+0x45,0xee,0xc4,0x9e,0xdd,0x03,0x3a,0xc5,0xb4,0xea,0x31,0xd1,0x9d,0x7d,0xf6,0x25,
+0x10,0x46,0x22,0xf1,0x1b,0xab,0x14,0x54,0xc6,0xca,0x0c,0xe1,0xf8,0x58,0x7a,0xfa,
+0x89,0x9a,0x79,0x28,0x4e,0xbf,0x3f,0xc6,0x86,0x57,0x08,0x24,0xab,0x47,0x00,0x59,
+0x14,0xb7,0xf2,0x29,0x10,0x23,0xf3,0xa9,0x8c,0xe5,0xa2,0x79,0x91,0x9f,0x66,0x0d,
+0xb0,0xd9,0xb0,0xf6,0x19,0x57,0x48,0x75,0xbd,0xfd,0x7d,0xaf,0x0b,0x06,0x97,0x15,
+0x08,0x16,0x8b,0x37,0xd2,0x63,0x4e,0xa7,0xf6,0x51,0x23,0xda,0xe5,0xdf,0x2d,0x3e,
+0x68,0x2f,0xd9,0x22,0x3b,0xcd,0x25,0xba,0xcb,0xcc,0x6c,0x89,0x6e,0x58,0x61,0x08,
+0x7e,0x8b,0x3d,0xd1,0xeb,0xd2,0x8e,0x10,0xac,0xc2,0x15,0xb1,0xd6,0x76,0xc2,0x7a,
+0x1a,0xc3,0xc9,0x78,0xa4,0xb4,0x06,0x3b,0x46,0x2d,0xa0,0x25,0x20,0x18,0x29,0xb4,
+0x41,0x0f,0xb0,0xe3,0x2b,0x93,0x36,0xcc,0x7f,0xa6,0x14,0x9e,0x83,0xaa,0x73,0x2f,
+0xe4,0x57,0x79,0x9f,0xb0,0xed,0xe8,0x42,0x01,0x98,0xcb,0xaf,0xc9,0x2b,0x42,0x99,
+0xdc,0xc0,0x52,0x96,0xfd,0x4e,0xb6,0x4a,0x65,0xc2,0x7c,0x07,0xe6,0xb7,0xeb,0x45,
+0x03,0x2f,0x34,0x2f,0xc2,0x22,0x28,0xd8,0x61,0x64,0x78,0x33,0x3e,0x52,0x98,0x61,
+0xcd,0xf6,0x81,0x40,0x0b,0x19,0xfe,0x11,0xd4,0x60,0xf0,0x58,0x93,0xcd,0x30,0x5c,
+0x9e,0xe1,0x92,0x38,0x90,0xcb,0x7c,0xe3,0x00,0xb7,0x18,0x96,0x4d,0x37,0x76,0xd8,
+0x25,0x09,0xa0,0xaf,0x71,0xc7,0x1a,0xe9,0x49,0xe9,0x3e,0xb3,0x6e,0x08,0x59,0x76,
+0xba,0xdf,0x98,0xb8,0x41,0x75,0x4d,0x4d,0xb8,0xb9,0x18,0x76,0x01,0x71,0xfd,0x59,
+0xd6,0xc3,0xee,0x05,0x43,0x3d,0x89,0x8e,0xe9,0x82,0x43,0xb3,0x45,0x7f,0x02,0x17,
+0xd2,0x7c,0x1d,0x10,0x74,0x58,0x45,0xc5,0xbf,0x8f,0xb7,0xa8,0x6c,0xee,0x7b,0x1f,
+0xf6,0x4c,0x21,0x3d,0xde,0x23,0x84,0x0d,0x9b,0x6e,0x73,0xbf,0x7b,0x84,0x76,0xbd,
+0xa7,0x3c,0x4c,0x6c,0x40,0x0a,0x93,0xd9,0xa7,0xfb,0x99,0x7c,0x1a,0xfd,0x1c,0xdb,
+0xec,0x84,0x15,0x07,0x53,0x02,0x59,0xd3,0xca,0x0b,0x15,0xd5,0xd0,0xc5,0x49,0xcc,
+0xf0,0xa6,0x16,0xfe,0xaa,0x0a,0xfe,0x1e,0xf7,0xe8,0xa4,0x9e,0x23,0x20,0xe8,0xb5,
+0xa9,0x61,0x77,0x77,0x3b,0x0d,0xe2,0x03,0xed,0x64,0x36,0x96,0x4b,0x1a,0x6a,0xbc,
+0x1a,0x22,0xca,0x2c,0x4c,0x15,0x50,0x99,0xb5,0x80,0x4a,0x74,0x0f,0xc3,0x30,0x71,
+0x2a,0x7b,0x54,0xd6,0x53,0x1b,0x35,0x37,0x19,0xcf,0xde,0xf5,0xf5,0xf5,0x1e,0x5d,
+0xe0,0xbb,0x87,0xe5,0xd0,0xe9,0x28,0xa3,0x4b,0x12,0x68,0x06,0xa7,0x3c,0xbb,0x85,
+0xdc,0x2c,0x42,0xdb,0xbe,0x4e,0x9a,0xe3,0x70,0x54,0xbd,0xe1,0x14,0xcd,0xe4,0xbf,
+0xbd,0x32,0xd1,0x9c,0x26,0x20,0x65,0xc3,0x32,0xb9,0x4e,0x69,0x51,0x49,0x44,0x4d,
+0x7f,0xb9,0x7f,0x44,0x58,0x54,0xe7,0x4e,0x87,0xbb,0xd6,0x32,0x60,0xeb,0xae,0xc0,
+0x3d,0x12,0xda,0xa4,0x1b,0x85,0x10,0x67,0x2c,0xad,0x23,0xf7,0xb2,0x78,0x12,0x3d,
+0x3a,0x38,0xa0,0x49,0x96,0xd7,0xc7,0x7f,0x3f,0xc0,0x56,0xfb,0xfb,0x01,0x37,0x22,
+0x49,0xec,0x1f,0x6d,0x5f,0x48,0x19,0x96,0xd0,0xfd,0x71,0x11,0xec,0x67,0x77,0x4b,
+0x32,0x2c,0x5f,0xfb,0xee,0x7a,0x1f,0x93,0xb2,0xf3,0xbd,0x2e,0x16,0x19,0x9c,0x45,
+0x64,0x58,0xbe,0xbd,0x6c,0x6e,0x8f,0x61,0x10,0x99,0xdd,0x78,0x04,0x92,0x87,0x1c,
+0x9f,0xfb,0x74,0xdd,0xa5,0xdd,0xdf,0x74,0xe2,0xf1,0x0f,0x15,0x39,0xa8,0x04,0xa4,
+0xa5,0xe2,0x83,0x0d,0x25,0xba,0xa5,0x40,0x8b,0xa1,0x1c,0x8b,0x22,0x62,0x07,0x50,
+0x84,0x8c,0xac,0x55,0x4e,0xae,0xc2,0x2c,0x9d,0xcb,0x2e,0xc9,0x17,0x5b,0x2e,0xba,
+0xc4,0x59,0x17,0xa8,0x79,0x9d,0x0e,0xc8,0x1a,0xe4,0x71,0x8e,0xdc,0x00,0x89,0x63,
+0x45,0x3b,0x38,0x24,0x37,0x02,0x79,0x94,0xeb,0x54,0x6e,0xab,0x99,0xa2,0x8e,0x8a,
+0x67,0x93,0xb2,0x49,0x03,0x83,0x42,0x42,0x03,0x1d,0x6c,0x49,0xdc,0x8c,0xe1,0xe3,
+0xb1,0x79,0xd5,0xca,0x71,0x8f,0x33,0x61,0x57,0x1a,0x14,0xd3,0x2c,0xa4,0x8e,0x69,
+0x59,0x78,0xe3,0xfe,0x90,0xe8,0xd9,0xb8,0x41,0x48,0x75,0xe2,0x31,0x69,0x62,0x9c,
+0x04,0xd2,0xc9,0xd0,0xca,0xbe,0x01,0xd8,0x2d,0x6e,0xd3,0x11,0xa1,0xcc,0x8c,0x3c,
+0x66,0xe9,0x05,0xf2,0xac,0x0f,0xea,0x00,0xec,0xf0,0x85,0xf6,0x85,0x9d,0xe3,0x02,
+0x4e,0xfc,0x62,0xe8,0x7c,0x00,0xc8,0x30,0x53,0x45,0x71,0x0d,0xcf,0x42,0x11,0x59,
+0xdc,0xe4,0x22,0x38,0x31,0x7a,0xe6,0x63,0xb5,0x60,0x8a,0xad,0x42,0x06,0x5c,0xd4,
+0x72,0x74,0x0f,0x6a,0xb9,0x87,0x24,0xb7,0xa7,0xc0,0x62,0x1b,0x3b,0x73,0x2a,0x73,
+0x10,0x0e,0xed,0x10,0x08,0x5b,0xd9,0xc5,0x03,0xf9,0x61,0x94,0x82,0x4f,0x24,0xa7,
+0x49,0x5b,0xd9,0x62,0x96,0x16,0x64,0x7d,0xec,0x9a,0xe0,0x1a,0x37,0xa6,0x94,0x14,
+0x50,0x52,0x6e,0xfa,0xbe,0x11,0x75,0xb5,0x96,0xa8,0x55,0x33,0xec,0xaf,0xe4,0xbd,
+0x7b,0x7b,0x7c,0xe2,0x19,0xd6,0xef,0x8b,0x01,0x0d,0x1d,0xe1,0xeb,0x6f,0xfe,0x7a,
+0x95,0x56,0x4e,0x8a,0x18,0xdc,0xa8,0x96,0xac,0x42,0xc0,0xd3,0x0d,0x85,0xaf,0xf1,
+0x3f,0x6a,0x8b,0x77,0x61,0x7d,0xbd,0x40,0x15,0x09,0x42,0xa3,0x08,0x57,0xd7,0x6d,
+0x01,0xe8,0xd7,0x1c,0x89,0xe9,0x1a,0xbd,0xa5,0x55,0xec,0xf4,0xab,0xe0,0x72,0xeb,
+0x95,0x47,0x82,0x99,0x85,0x23,0x7b,0xe1,0xc2,0xee,0x32,0x3c,0x24,0xec,0x6c,0x0b,
+0x34,0x5d,0xbd,0x7a,0x04,0xbe,0xfc,0x18,0x57,0xca,0x78,0x8f,0x71,0xa7,0x26,0x2e,
+0xf5,0x93,0x94,0xda,0xf5,0x92,0xc3,0x50,0x4c,0x70,0x53,0xcc,0x6a,0x67,0x88,0xfe,
+0x89,0x99,0x9a,0xbc,0xe1,0x30,0x60,0xc6,0xbf,0x34,0x56,0x27,0x1e,0xce,0x49,0x24,
+0x6c,0xf6,0x97,0xf7,0x2f,0x49,0xe1,0x02,0x53,0x25,0x5c,0x45,0x8d,0x5e,0xa1,0x4d,
+0x19,0x4e,0x61,0x03,0x95,0x87,0x2f,0x0e,0xab,0x1b,0x79,0xb6,0x75,0x00,0x69,0xc4,
+0x8e,0x26,0x26,0xa8,0x51,0x2e,0x72,0xf6,0xa4,0x07,0xe2,0x6a,0x72,0xc2,0x41,0x21,
+0x40,0x15,0x27,0x64,0xfe,0xc5,0xa5,0x8e,0xac,0x0b,0x4a,0x09,0xc3,0x8b,0xb3,0xd4,
+0xae,0x7b,0x99,0xf6,0xdf,0x1e,0x1d,0xd0,0x75,0xda,0x5d,0xef,0x1e,0x6d,0x28,0x2f,
+0x6c,0xe5,0xe4,0xb6,0x71,0xb3,0x56,0x75,0xf3,0x1b,0x5f,0x57,0xa5,0xf2,0xf6,0xeb,
+0x23,0x8d,0xd2,0x79,0x50,0x3d,0xf9,0x56,0xc3,0x69,0x02,0x1b,0xee,0x68,0x6b,0x43,
+0x4b,0xc1,0x67,0xfb,0x90,0x1c,0x6a,0x5d,0x03,0x81,0x04,0xe1,0x99,0xf0,0x1d,0xe3,
+0x00,0xae,0xcd,0x55,0x69,0xca,0x39,0xbf,0x52,0x00,0xb9,0x91,0x9a,0xe0,0xd9,0x99,
+0x28,0x0c,0x34,0xcb,0x00,0xe2,0x3d,0xba,0x64,0xa1,0xea,0x38,0x25,0x3a,0x78,0x86,
+0x0c,0x46,0x64,0xee,0xa0,0xdb,0x45,0xc7,0xa4,0x29,0x5a,0x9e,0xcf,0x13,0x2a,0x80,
+0x09,0x86,0x8b,0x87,0x14,0xa6,0x67,0x84,0x47,0x96,0x20,0x7d,0x79,0x21,0xe1,0x22,
+0x8f,0xf0,0xbe,0x82,0xa2,0x28,0x33,0xe9,0x80,0x81,0xa3,0xcf,0xe7,0xd9,0x0d,0xbd,
+0xb2,0xac,0xa7,0x77,0x76,0x64,0x41,0x88,0x2e,0x80,0x27,0x29,0x31,0x24,0x74,0x3a,
+0x31,0x3b,0xa7,0x9a,0xe0,0x2d,0x27,0x57,0x87,0x3e,0x8c,0xb5,0xd3,0x5d,0x0a,0xff,
+0x3e,0x95,0x3e,0xcf,0xeb,0x36,0x25,0x92,0xdb,0x1f,0xb9,0x3b,0x33,0x7d,0xb4,0x7e,
+0x16,0xfd,0x0a,0x87,0x75,0xd7,0xe4,0x62,0x7b,0xc9,0xb3,0x12,0x6d,0x38,0xf8,0x37,
+0x8d,0x04,0x41,0x6d,0x24,0xb0,0xb3,0xa8,0x9c,0x1b,0x0f,0x5b,0xa2,0x01,0xac,0x5e,
+0xdd,0x66,0x37,0x11,0xbc,0xfa,0x4f,0x58,0x21,0x2b,0xed,0x7a,0x1a,0xf0,0xcd,0x70,
+0xdb,0xaa,0x75,0x73,0xc1,0x80,0x18,0x2d,0x4d,0x0f,0xfd,0x66,0x58,0x7e,0x2b,0x5d,
+0x7b,0xd5,0x85,0x96,0x10,0x42,0x77,0x6b,0x32,0xc3,0x99,0xe3,0x52,0x29,0x0e,0x9c,
+0xea,0xee,0x63,0x78,0x8f,0xdd,0x4e,0x9b,0x3b,0x31,0x4d,0x01,0xcd,0xb3,0x43,0x9a,
+0xbd,0xea,0x4e,0xcc,0x94,0xef,0xc4,0x84,0xd9,0xee,0xd3,0x47,0x1c,0x07,0xe0,0xb9,
+0x83,0xcb,0x88,0x3e,0xb6,0x84,0xdd,0x54,0x6a,0xac,0x4a,0x25,0x49,0xca,0x51,0x94,
+0x62,0xdf,0x30,0x58,0x54,0x18,0x6c,0x6c,0x85,0xca,0x59,0xe5,0x61,0x75,0x21,0xb6,
+0xcc,0xe4,0x66,0x3e,0xeb,0x7c,0xba,0x99,0xde,0xd8,0xa6,0xce,0xe5,0xdd,0x7c,0xdb,
+0xcd,0xe6,0x25,0xdb,0x1c,0x0d,0xbd,0xae,0x26,0xb1,0xff,0x1f,0x6d,0xd6,0x42,0x98,
+0x32,0x62,0x00,0x00,};
+
+#if HTTPD_FS_ETAG
+static const char etag__zepto_min_js[] = "\"9842d66d-6232\"";
+static const char not_modified__zepto_min_js[] =
+"HTTP/1.1 304 Not Modified\r\n"
+"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+"ETag: \"9842d66d-6232\"\r\n"
+"Cache-Control: max-age=3600\r\n"
+"Vary: Accept-Encoding\r\n"
+"\r\n";
+#endif /* HTTPD_FS_ETAG */
+
+static const unsigned int dummy_align__zepto_min_js = 7;
 static const unsigned char data__zepto_min_js[] = {
 /* /zepto.min.js (14 chars) */
 0x2f,0x7a,0x65,0x70,0x74,0x6f,0x2e,0x6d,0x69,0x6e,0x2e,0x6a,0x73,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.1 200 OK
 " (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x31,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
 /* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
@@ -810,6 +1942,21 @@ static const unsigned char data__zepto_min_js[] = {
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 25138
+" (18+ bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x35,0x31,0x33,0x38,0x0d,0x0a,
+/* "ETag: "9842d66d-6232"
+Cache-Control: max-age=3600
+" (52 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x39,0x38,0x34,0x32,0x64,0x36,0x36,0x64,0x2d,
+0x36,0x32,0x33,0x32,0x22,0x0d,0x0a,0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,
+0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x33,0x36,
+0x30,0x30,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
 /* "Content-type: application/x-javascript
 
 " (42 bytes) */
@@ -2392,12 +3539,38 @@ static const unsigned char data__zepto_min_js[] = {
 
 
 
+const struct fsdata_file file__img_discovery_svg__gz[] = { {
+file_NULL,
+data__img_discovery_svg__gz,
+data__img_discovery_svg__gz + 20,
+sizeof(data__img_discovery_svg__gz) - 20,
+1,
+#if HTTPD_FS_GZIP
+file_NULL,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__img_discovery_svg__gz, not_modified__img_discovery_svg__gz,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
+}};
+
 const struct fsdata_file file__img_discovery_svg[] = { {
 file_NULL,
 data__img_discovery_svg,
 data__img_discovery_svg + 20,
 sizeof(data__img_discovery_svg) - 20,
 1,
+#if HTTPD_FS_GZIP
+file__img_discovery_svg__gz,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__img_discovery_svg, not_modified__img_discovery_svg,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 }};
 
 const struct fsdata_file file__404_html[] = { {
@@ -2406,6 +3579,32 @@ data__404_html,
 data__404_html + 12,
 sizeof(data__404_html) - 12,
 1,
+#if HTTPD_FS_GZIP
+file_NULL,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+NULL, NULL,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
+}};
+
+const struct fsdata_file file__index_html__gz[] = { {
+file_NULL,
+data__index_html__gz,
+data__index_html__gz + 12,
+sizeof(data__index_html__gz) - 12,
+1,
+#if HTTPD_FS_GZIP
+file_NULL,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__index_html__gz, not_modified__index_html__gz,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 }};
 
 const struct fsdata_file file__index_html[] = { {
@@ -2414,6 +3613,15 @@ data__index_html,
 data__index_html + 12,
 sizeof(data__index_html) - 12,
 1,
+#if HTTPD_FS_GZIP
+file__index_html__gz,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__index_html, not_modified__index_html,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 }};
 
 const struct fsdata_file file__state_shtml[] = { {
@@ -2422,6 +3630,32 @@ data__state_shtml,
 data__state_shtml + 16,
 sizeof(data__state_shtml) - 16,
 1,
+#if HTTPD_FS_GZIP
+file_NULL,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+NULL, NULL,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+ssi_segs__state_shtml,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
+}};
+
+const struct fsdata_file file__zepto_min_js__gz[] = { {
+file_NULL,
+data__zepto_min_js__gz,
+data__zepto_min_js__gz + 16,
+sizeof(data__zepto_min_js__gz) - 16,
+1,
+#if HTTPD_FS_GZIP
+file_NULL,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__zepto_min_js__gz, not_modified__zepto_min_js__gz,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 }};
 
 const struct fsdata_file file__zepto_min_js[] = { {
@@ -2430,8 +3664,40 @@ data__zepto_min_js,
 data__zepto_min_js + 16,
 sizeof(data__zepto_min_js) - 16,
 1,
+#if HTTPD_FS_GZIP
+file__zepto_min_js__gz,
+#endif /* HTTPD_FS_GZIP */
+#if HTTPD_FS_ETAG
+etag__zepto_min_js, not_modified__zepto_min_js,
+#endif /* HTTPD_FS_ETAG */
+#if HTTPD_FS_SSI_SEGMENTS
+NULL,
+#endif /* HTTPD_FS_SSI_SEGMENTS */
 }};
 
+#if HTTPD_FS_HASH
+#define FS_HASH_BUCKETS 4
+#define FS_HASH_SIZE 8
+
+static const u16_t fs_hash_disp[FS_HASH_BUCKETS] = {
+1,
+0,
+1,
+3,
+};
+
+static const struct fsdata_file * const fs_hash_files[FS_HASH_SIZE] = {
+file__zepto_min_js,
+file__404_html,
+file_NULL,
+file__state_shtml,
+file_NULL,
+file__img_discovery_svg,
+file__index_html,
+file_NULL,
+};
+#endif /* HTTPD_FS_HASH */
+
 #define FS_ROOT file__zepto_min_js
 #define FS_NUMFILES 5
 
@@ -0,0 +1,110 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "latency.h"
+
+typedef struct
+{
+	uint32_t  rx;    /* usb out complete */
+	uint32_t  dq;    /* dequeued by usb_polling */
+	uint32_t  app;   /* application callback */
+	uint32_t  tx;    /* response passed to usb */
+	lat_app_t id;
+	bool      valid;
+} lat_frame_t;
+
+static volatile uint32_t rx_time;  /* stamp of the frame waiting in usb_polling */
+static lat_frame_t current;        /* frame being processed by the stack */
+static lat_frame_t inflight;       /* frame whose response is being sent */
+
+void lat_rx_done(void)
+{
+	rx_time = DWT->CYCCNT;
+}
+
+void lat_dequeue(void)
+{
+	current.rx = rx_time;
+	current.dq = DWT->CYCCNT;
+	current.id = LAT_APP_NONE;
+	current.valid = true;
+}
+
+void lat_app(lat_app_t app)
+{
+	if (!current.valid || current.id != LAT_APP_NONE) return;
+	current.app = DWT->CYCCNT;
+	current.id = app;
+}
+
+/* only the first frame sent in response is counted */
+void lat_tx(void)
+{
+	uint32_t primask;
+
+	if (!current.valid) return;
+	current.tx = DWT->CYCCNT;
+	primask = __get_PRIMASK();
+	__disable_irq();
+	inflight = current;
+	__set_PRIMASK(primask);
+	current.valid = false;
+}
+
+void lat_end(void)
+{
+	current.valid = false;
+}
+
+/* all PROBE_LAT_XXX probes are committed here, at interrupt level */
+void lat_tx_done(void)
+{
+	uint32_t now, total;
+
+	if (!inflight.valid) return;
+	inflight.valid = false;
+	now = DWT->CYCCNT;
+	total = now - inflight.rx;
+	probe_commit(PROBE_LAT_QUEUE, inflight.dq - inflight.rx);
+	if (inflight.id != LAT_APP_NONE)
+	{
+		probe_commit(PROBE_LAT_STACK, inflight.app - inflight.dq);
+		probe_commit(PROBE_LAT_APP, inflight.tx - inflight.app);
+	}
+	else
+		probe_commit(PROBE_LAT_STACK, inflight.tx - inflight.dq);
+	probe_commit(PROBE_LAT_TX, now - inflight.tx);
+	probe_commit(PROBE_LAT_TOTAL, total);
+	switch (inflight.id)
+	{
+	case LAT_APP_HTTP: probe_commit(PROBE_LAT_HTTP, total); break;
+	case LAT_APP_DHCP: probe_commit(PROBE_LAT_DHCP, total); break;
+	case LAT_APP_DNS:  probe_commit(PROBE_LAT_DNS, total); break;
+	default: break;
+	}
+}
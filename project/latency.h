@@ -0,0 +1,80 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   per-frame latency through the rx -> stack -> tx pipeline
+ */
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "probe.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A frame is stamped at each stage; when its response leaves the device
+ * the stage deltas are committed to the PROBE_LAT_XXX probes. Frames
+ * without a response are not counted. */
+
+typedef enum
+{
+	LAT_APP_NONE,
+	LAT_APP_HTTP,
+	LAT_APP_DHCP,
+	LAT_APP_DNS
+} lat_app_t;
+
+void lat_rx_done(void);      /* usb out transfer of a frame completed (isr) */
+void lat_dequeue(void);      /* frame taken by usb_polling, irq disabled */
+void lat_app(lat_app_t app); /* application callback reached */
+void lat_tx(void);           /* response handed to rndis_send */
+void lat_tx_done(void);      /* usb in transfer completed (isr) */
+void lat_end(void);          /* frame processing finished */
+
+#if PROBE_ENABLE
+#define LAT_RX_DONE()  lat_rx_done()
+#define LAT_DEQUEUE()  lat_dequeue()
+#define LAT_APP(app)   lat_app(app)
+#define LAT_TX()       lat_tx()
+#define LAT_TX_DONE()  lat_tx_done()
+#define LAT_END()      lat_end()
+#else
+#define LAT_RX_DONE()  ((void)0)
+#define LAT_DEQUEUE()  ((void)0)
+#define LAT_APP(app)   ((void)0)
+#define LAT_TX()       ((void)0)
+#define LAT_TX_DONE()  ((void)0)
+#define LAT_END()      ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
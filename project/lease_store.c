@@ -0,0 +1,141 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "lease_store.h"
+#include <stdbool.h>
+#include <string.h>
+
+#define WORD(offset) (*(volatile uint32_t *)(LEASE_STORE_ADDR + (offset)))
+#define ERASED       0xFFFFFFFF
+#define LOG_START    8
+#define RECORD_SIZE  8
+
+static dhcp_config_t *config = NULL;
+static uint32_t log_pos;      /* offset of the first free record */
+static uint32_t signature;
+static const uint8_t none[6] = {0};
+
+/* leases are stored by index, so the log is bound to the pool layout */
+static uint32_t pools_signature(void)
+{
+	int i;
+	uint32_t h = 2166136261u; /* FNV-1a */
+	for (i = 0; i < config->num_pool; i++)
+	{
+		h = (h ^ *(uint32_t *)config->pools[i].first) * 16777619u;
+		h = (h ^ config->pools[i].size) * 16777619u;
+	}
+	return h;
+}
+
+static bool program(uint32_t offset, uint32_t data)
+{
+	return FLASH_ProgramWord(LEASE_STORE_ADDR + offset, data) == FLASH_COMPLETE;
+}
+
+static void flash_begin(void)
+{
+	FLASH_Unlock();
+	FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR |
+		FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+}
+
+static bool write_record(int index, const uint8_t *mac)
+{
+	uint32_t w1, w2;
+	if (log_pos + RECORD_SIZE > LEASE_STORE_SIZE)
+		return false;
+	w1 = index | ((uint32_t)mac[0] << 16) | ((uint32_t)mac[1] << 24);
+	w2 = mac[2] | ((uint32_t)mac[3] << 8) | ((uint32_t)mac[4] << 16) | ((uint32_t)mac[5] << 24);
+	/* word 2 first: an interrupted record is skipped on load */
+	if (!program(log_pos + 4, w2))
+		return false;
+	if (!program(log_pos, w1))
+		return false;
+	log_pos += RECORD_SIZE;
+	return true;
+}
+
+/* Erases the sector and writes the bound leases. The erase takes a
+ * second or two with the cpu stalled on flash fetches, so it is done
+ * only when the log is full or the pools have changed. */
+static void compact(void)
+{
+	int i;
+	log_pos = LOG_START;
+	if (FLASH_EraseSector(LEASE_STORE_SECTOR, VoltageRange_3) != FLASH_COMPLETE)
+		return;
+	if (!program(4, signature) || !program(0, LEASE_STORE_MAGIC))
+		return;
+	if (config == NULL) return;
+	for (i = 0; i < config->num_lease; i++)
+		if (config->leases[i].state == DHCP_LEASE_BOUND)
+			if (!write_record(i, config->leases[i].mac))
+				return;
+}
+
+void lease_store_save(int index, const dhcp_lease_t *lease)
+{
+	const uint8_t *mac;
+	mac = lease->state == DHCP_LEASE_BOUND ? lease->mac : none;
+	flash_begin();
+	if (!write_record(index, mac))
+		compact(); /* writes the current state, including this lease */
+	FLASH_Lock();
+}
+
+void lease_store_init(dhcp_config_t *c)
+{
+	uint32_t w1, w2;
+	uint8_t mac[6];
+
+	config = c;
+	signature = pools_signature();
+	if (WORD(0) != LEASE_STORE_MAGIC || WORD(4) != signature)
+	{
+		flash_begin();
+		compact();
+		FLASH_Lock();
+		return;
+	}
+
+	for (log_pos = LOG_START; log_pos + RECORD_SIZE <= LEASE_STORE_SIZE; log_pos += RECORD_SIZE)
+	{
+		w1 = WORD(log_pos);
+		w2 = WORD(log_pos + 4);
+		if (w1 == ERASED && w2 == ERASED) break;
+		if (w1 == ERASED) continue; /* interrupted */
+		mac[0] = w1 >> 16;
+		mac[1] = w1 >> 24;
+		mac[2] = w2;
+		mac[3] = w2 >> 8;
+		mac[4] = w2 >> 16;
+		mac[5] = w2 >> 24;
+		dhserv_restore(w1 & 0xFFFF, memcmp(mac, none, 6) == 0 ? NULL : mac);
+	}
+}
@@ -0,0 +1,64 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   persistent DHCP leases in a flash sector
+ */
+
+#ifndef LEASE_STORE_H
+#define LEASE_STORE_H
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+#include "dhserver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The sector is reserved in ide/MDK-ARM/cpufw.sct and ide/GCC/cpufw.ld */
+#ifndef LEASE_STORE_ADDR
+#define LEASE_STORE_ADDR   0x080E0000
+#define LEASE_STORE_SIZE   0x20000         /* 128 KB */
+#define LEASE_STORE_SECTOR FLASH_Sector_11
+#endif
+
+#define LEASE_STORE_MAGIC  0x5341454C      /* "LEAS" */
+
+/* Sector layout: magic, signature of the pools, then an append-only log
+ * of 8-byte records. Record word 1 holds the lease index and mac[0..1],
+ * word 2 holds mac[2..5]; a zero mac releases the lease. Word 2 is
+ * programmed first, so a record is valid once word 1 is written. When
+ * the sector is full it is erased and the bound leases are written
+ * again. */
+
+void lease_store_init(dhcp_config_t *config); /* restore leases, call after dhserv_init */
+void lease_store_save(int index, const dhcp_lease_t *lease); /* dhcp_config_t.on_lease */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
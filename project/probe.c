@@ -0,0 +1,176 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "probe.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char *const probe_names[PROBE_COUNT] =
+{
+	"usb_isr",
+	"rndis_rx",
+	"usb_poll",
+	"eth_input",
+	"tcp_input",
+	"linkoutput",
+	"http_send",
+	"lat_queue",
+	"lat_stack",
+	"lat_app",
+	"lat_tx",
+	"lat_total",
+	"lat_http",
+	"lat_dhcp",
+	"lat_dns"
+};
+
+probe_t probes[PROBE_COUNT];
+
+void probe_reset(void)
+{
+	int i;
+	uint32_t primask;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	memset(probes, 0, sizeof(probes));
+	for (i = 0; i < PROBE_COUNT; i++)
+		probes[i].min = 0xFFFFFFFF;
+	__set_PRIMASK(primask);
+}
+
+void probe_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	probe_reset();
+}
+
+/* Called from the context which owns the probe, so no locking here:
+ * a probe is updated either from thread or from interrupt level only. */
+void probe_commit(probe_id_t id, uint32_t cycles)
+{
+	probe_t *p;
+	uint32_t bin;
+
+	p = &probes[id];
+	p->count++;
+	p->total += cycles;
+	if (cycles < p->min) p->min = cycles;
+	if (cycles > p->max) p->max = cycles;
+	bin = 32 - __CLZ(cycles);
+	if (bin >= PROBE_HIST_BINS) bin = PROBE_HIST_BINS - 1;
+	p->hist[bin]++;
+}
+
+const char *probe_name(probe_id_t id)
+{
+	return id < PROBE_COUNT ? probe_names[id] : "";
+}
+
+void probe_get(probe_id_t id, probe_t *dst)
+{
+	uint32_t primask;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*dst = probes[id];
+	__set_PRIMASK(primask);
+}
+
+static bool append(char *buf, int size, int *len, const char *fmt, ...)
+{
+	int n;
+	va_list args;
+
+	va_start(args, fmt);
+	n = vsnprintf(buf + *len, size - *len, fmt, args);
+	va_end(args);
+	if (n < 0 || n >= size - *len) return false;
+	*len += n;
+	return true;
+}
+
+static bool append_probe(char *buf, int size, int *len, int i)
+{
+	int j, first, last;
+	probe_t p;
+
+	probe_get((probe_id_t)i, &p);
+	if (p.count == 0) p.min = 0;
+	/* empty bins on both sides are omitted, "lo" is the first bin */
+	first = 0;
+	last = PROBE_HIST_BINS;
+	while (last > 0 && p.hist[last - 1] == 0) last--;
+	while (first < last && p.hist[first] == 0) first++;
+	if (!append(buf, size, len, "%s\"%s\":{\"n\":%u,\"min\":%u,\"max\":%u,\"mean\":%u,\"lo\":%u,\"hist\":[",
+			i == 0 ? "" : ",", probe_names[i], (unsigned)p.count, (unsigned)p.min, (unsigned)p.max,
+			(unsigned)(p.count == 0 ? 0 : p.total / p.count), (unsigned)first))
+		return false;
+	for (j = first; j < last; j++)
+		if (!append(buf, size, len, j == first ? "%u" : ",%u", (unsigned)p.hist[j]))
+			return false;
+	return append(buf, size, len, "]}");
+}
+
+/* the cursor is the number of the next probe + 1, PROBE_COUNT + 1 for the
+ * closing brackets; the report is as long as all histograms need, so it is
+ * sent in parts instead of being rendered into one buffer */
+int probe_json_part(uint32_t *cursor, char *buf, int size)
+{
+	int i, len, mark;
+
+	if (*cursor == PROBE_JSON_END) return 0;
+	len = 0;
+	if (*cursor == 0)
+	{
+		if (!append(buf, size, &len, "{\"clock\":%u,\"probes\":{", (unsigned)SystemCoreClock))
+			return 0;
+		*cursor = 1;
+	}
+	for (i = *cursor - 1; i < PROBE_COUNT; i++)
+	{
+		mark = len;
+		if (!append_probe(buf, size, &len, i))
+		{
+			/* the rest in the next part, a probe longer than buf ends the report */
+			*cursor = i + 1;
+			return mark;
+		}
+	}
+	if (!append(buf, size, &len, "}}"))
+	{
+		*cursor = PROBE_COUNT + 1;
+		return len;
+	}
+	*cursor = PROBE_JSON_END;
+	return len;
+}
@@ -0,0 +1,115 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   DWT cycle counter probes with log2 histograms
+ */
+
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* set to 0 to compile all probes out */
+#ifndef PROBE_ENABLE
+#define PROBE_ENABLE 1
+#endif
+
+#define PROBE_HIST_BINS 32 /* bin n counts durations in [2^(n-1), 2^n) cycles */
+
+#define PROBE_JSON_PART_MIN 480        /* buffer of probe_json_part: the head and the longest probe */
+#define PROBE_JSON_END      0xFFFFFFFF /* cursor of probe_json_part after the report */
+
+/* probe points */
+
+typedef enum
+{
+	PROBE_USB_ISR,    /* USBD_OTG_ISR_Handler */
+	PROBE_RNDIS_RX,   /* usbd_rndis_data_out */
+	PROBE_USB_POLL,   /* usb_polling, frame delivery to the stack */
+	PROBE_ETH_INPUT,  /* ethernet_input */
+	PROBE_TCP_INPUT,  /* tcp_input */
+	PROBE_LINKOUTPUT, /* linkoutput_fn */
+	PROBE_HTTP_SEND,  /* http_send */
+	PROBE_LAT_QUEUE,  /* frame latency: usb out complete to usb_polling */
+	PROBE_LAT_STACK,  /* frame latency: usb_polling to application callback */
+	PROBE_LAT_APP,    /* frame latency: application callback to linkoutput_fn */
+	PROBE_LAT_TX,     /* frame latency: linkoutput_fn to usb in complete */
+	PROBE_LAT_TOTAL,  /* frame latency: usb out complete to usb in complete */
+	PROBE_LAT_HTTP,   /* total latency of http requests */
+	PROBE_LAT_DHCP,   /* total latency of dhcp requests */
+	PROBE_LAT_DNS,    /* total latency of dns requests */
+	PROBE_COUNT
+} probe_id_t;
+
+typedef struct
+{
+	uint32_t start;   /* CYCCNT at PROBE_BEGIN */
+	uint32_t count;   /* number of completed measurements */
+	uint32_t min;     /* cycles */
+	uint32_t max;     /* cycles */
+	uint64_t total;   /* cycles */
+	uint32_t hist[PROBE_HIST_BINS];
+} probe_t;
+
+/* probe functions */
+
+void probe_init(void);                    /* enable DWT cycle counter, clear all probes */
+void probe_reset(void);                   /* clear all probes */
+void probe_commit(probe_id_t id, uint32_t cycles);
+const char *probe_name(probe_id_t id);
+void probe_get(probe_id_t id, probe_t *dst); /* consistent copy of a probe */
+/* Next part of the JSON report, whole probes only. The cursor is 0 at the
+ * start of the report. Returns the length, 0 after the end of the report. */
+int  probe_json_part(uint32_t *cursor, char *buf, int size);
+
+#if PROBE_ENABLE
+
+extern probe_t probes[PROBE_COUNT];
+
+/* Probes of one id must not nest. A probe preempted by an interrupt
+ * includes the interrupt time. */
+#define PROBE_CYCLES() (DWT->CYCCNT)
+#define PROBE_BEGIN(id) (probes[id].start = DWT->CYCCNT)
+#define PROBE_END(id) probe_commit(id, DWT->CYCCNT - probes[id].start)
+
+#else
+
+#define PROBE_CYCLES() 0
+#define PROBE_BEGIN(id) ((void)0)
+#define PROBE_END(id) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
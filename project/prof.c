@@ -0,0 +1,193 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "prof.h"
+#include <string.h>
+
+#define PROF_HTTP_HEADER \
+	"HTTP/1.0 200 OK\r\n" \
+	"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n" \
+	"Content-type: application/octet-stream\r\n" \
+	"Cache-Control: no-cache\r\n" \
+	"\r\n"
+
+#define HEADER_LEN (sizeof(PROF_HTTP_HEADER) - 1)
+#define HEADER_SIZE ((HEADER_LEN + 3) & ~3)
+
+#if PROF_ENABLE
+
+/* the http header is stored right-aligned in front of the binary data,
+ * so the whole response is one contiguous block sent without copying */
+static struct
+{
+	char          http[HEADER_SIZE];
+	prof_header_t hdr;
+	uint16_t      hist[PROF_BUCKETS + PROF_RAM_BUCKETS];
+} image;
+
+static volatile int paused = 0;
+
+void prof_sample(uint32_t *frame);
+
+/* frame points to the exception stack frame: r0-r3, r12, lr, pc, xpsr */
+void prof_sample(uint32_t *frame)
+{
+	uint32_t i;
+
+	TIM7->SR = (uint16_t)~TIM_SR_UIF;
+	if (paused) return;
+	image.hdr.samples++;
+	i = (frame[6] - PROF_BASE) >> PROF_SHIFT;
+	if (i >= PROF_BUCKETS)
+	{
+		/* the code in SRAM follows the flash buckets */
+		i = (frame[6] - PROF_RAM_BASE) >> PROF_SHIFT;
+		if (i >= PROF_RAM_BUCKETS)
+		{
+			image.hdr.outside++;
+			return;
+		}
+		i += PROF_BUCKETS;
+	}
+	if (image.hist[i] != 0xFFFF)
+		image.hist[i]++;
+}
+
+/* the handler passes the active stack pointer to prof_sample */
+#if defined(__CC_ARM)
+__asm void TIM7_IRQHandler(void)
+{
+	IMPORT prof_sample
+	TST   LR, #4
+	ITE   EQ
+	MRSEQ R0, MSP
+	MRSNE R0, PSP
+	B     prof_sample
+}
+#elif defined(__GNUC__)
+void TIM7_IRQHandler(void) __attribute__((naked));
+void TIM7_IRQHandler(void)
+{
+	__asm volatile
+	(
+		"tst   lr, #4     \n"
+		"ite   eq         \n"
+		"mrseq r0, msp    \n"
+		"mrsne r0, psp    \n"
+		"b     prof_sample\n"
+	);
+}
+#endif
+
+void prof_reset(void)
+{
+	uint32_t primask;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	memset(image.hist, 0, sizeof(image.hist));
+	image.hdr.samples = 0;
+	image.hdr.outside = 0;
+	__set_PRIMASK(primask);
+}
+
+void prof_init(uint32_t rate)
+{
+	TIM_TimeBaseInitTypeDef base;
+	NVIC_InitTypeDef nvic;
+	RCC_ClocksTypeDef clocks;
+	uint32_t clk;
+
+	if (rate < 16) rate = 16;
+	if (rate > 100000) rate = 100000;
+
+	memcpy(image.http + HEADER_SIZE - HEADER_LEN, PROF_HTTP_HEADER, HEADER_LEN);
+	image.hdr.magic = PROF_MAGIC;
+	image.hdr.base = PROF_BASE;
+	image.hdr.shift = PROF_SHIFT;
+	image.hdr.buckets = PROF_BUCKETS + PROF_RAM_BUCKETS;
+	image.hdr.ram_base = PROF_RAM_BASE;
+	image.hdr.ram_buckets = PROF_RAM_BUCKETS;
+	image.hdr.rate = rate;
+	prof_reset();
+
+	/* APB1 timers run at 2 * PCLK1 when APB1 prescaler is not 1 */
+	RCC_GetClocksFreq(&clocks);
+	clk = clocks.PCLK1_Frequency;
+	if (clocks.PCLK1_Frequency != clocks.HCLK_Frequency)
+		clk *= 2;
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM7, ENABLE);
+	TIM_Cmd(TIM7, DISABLE);
+	TIM_TimeBaseStructInit(&base);
+	base.TIM_Prescaler = clk / 1000000 - 1;  /* 1 MHz counter */
+	base.TIM_Period = 1000000 / rate - 1;
+	TIM_TimeBaseInit(TIM7, &base);
+	TIM_ClearITPendingBit(TIM7, TIM_IT_Update);
+	TIM_ITConfig(TIM7, TIM_IT_Update, ENABLE);
+
+	/* above USB, so the USB driver is sampled too */
+	nvic.NVIC_IRQChannel = TIM7_IRQn;
+	nvic.NVIC_IRQChannelPreemptionPriority = 0;
+	nvic.NVIC_IRQChannelSubPriority = 0;
+	nvic.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&nvic);
+
+	TIM_Cmd(TIM7, ENABLE);
+}
+
+void prof_stop(void)
+{
+	TIM_Cmd(TIM7, DISABLE);
+}
+
+/* Sampling stays paused while the image is being served. Segments
+ * retransmitted after prof_close may carry newer counts. */
+const char *prof_open(int *len)
+{
+	if (image.hdr.magic != PROF_MAGIC)
+		return NULL;
+	paused++;
+	*len = HEADER_LEN + sizeof(prof_header_t) + sizeof(image.hist);
+	return image.http + HEADER_SIZE - HEADER_LEN;
+}
+
+void prof_close(void)
+{
+	if (paused > 0) paused--;
+}
+
+#else
+
+void prof_init(uint32_t rate) { (void)rate; }
+void prof_stop(void) {}
+void prof_reset(void) {}
+const char *prof_open(int *len) { *len = 0; return NULL; }
+void prof_close(void) {}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   statistical PC-sampling profiler
+ */
+
+#ifndef PROF_H
+#define PROF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* set to 0 to compile the profiler out */
+#ifndef PROF_ENABLE
+#define PROF_ENABLE 1
+#endif
+
+#ifndef PROF_BASE
+#define PROF_BASE    0x08000000   /* address of the first bucket */
+#endif
+#ifndef PROF_SHIFT
+#define PROF_SHIFT   6            /* 64 bytes per bucket */
+#endif
+#ifndef PROF_BUCKETS
+#define PROF_BUCKETS 2048         /* 128 KB of code */
+#endif
+#ifndef PROF_RAM_BASE
+#define PROF_RAM_BASE    0x20000000 /* code copied to SRAM (RW_RAMCODE of cpufw.sct) */
+#endif
+#ifndef PROF_RAM_BUCKETS
+#define PROF_RAM_BUCKETS 384        /* 24 KB of code */
+#endif
+#ifndef PROF_RATE
+#define PROF_RATE    2000         /* default sampling rate, Hz */
+#endif
+
+#define PROF_MAGIC   0x464F5250   /* "PROF" */
+
+/* image layout: http header, prof_header_t, uint16_t hist[buckets]; the
+ * last ram_buckets of hist cover the code in SRAM */
+
+typedef struct
+{
+	uint32_t magic;       /* PROF_MAGIC */
+	uint32_t base;        /* address of bucket 0 */
+	uint16_t shift;       /* bucket size is 1 << shift bytes */
+	uint16_t buckets;     /* number of buckets following the header */
+	uint32_t rate;        /* sampling rate, Hz */
+	uint32_t samples;     /* samples taken */
+	uint32_t outside;     /* samples outside of the bucket ranges */
+	uint32_t ram_base;    /* address of bucket buckets - ram_buckets */
+	uint16_t ram_buckets; /* buckets of the code in SRAM */
+	uint16_t reserved;
+} prof_header_t;
+
+/* profiler functions */
+
+void prof_init(uint32_t rate);          /* start sampling by TIM7, 16..100000 Hz */
+void prof_stop(void);                   /* stop sampling */
+void prof_reset(void);                  /* clear the histogram */
+const char *prof_open(int *len);        /* pause sampling and return the http image */
+void prof_close(void);                  /* resume sampling */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
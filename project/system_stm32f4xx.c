@@ -227,6 +227,18 @@ static void SetSysClock(void);
   */
 void SystemInit(void)
 {
+#if defined(__GNUC__) && !defined(__CC_ARM)
+  /* Zero-initialized data in CCM (ide/GCC/cpufw.ld) ------------------------*/
+  /* The startup code of the GCC toolchains only clears .bss */
+  {
+    extern uint32_t _sccm, _eccm;
+    uint32_t *p;
+
+    for (p = &_sccm; p < &_eccm; p++)
+      *p = 0;
+  }
+#endif
+
   /* FPU settings ------------------------------------------------------------*/
   #if (__FPU_PRESENT == 1) && (__FPU_USED == 1)
     SCB->CPACR |= ((3UL << 10*2)|(3UL << 11*2));  /* set CP10 and CP11 Full Access */
@@ -0,0 +1,167 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ */
+
+#include "trace.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include <string.h>
+
+#define TRACE_HTTP_HEADER \
+	"HTTP/1.0 200 OK\r\n" \
+	"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n" \
+	"Content-type: application/octet-stream\r\n" \
+	"Cache-Control: no-cache\r\n" \
+	"\r\n"
+
+#define HEADER_LEN (sizeof(TRACE_HTTP_HEADER) - 1)
+#define HEADER_SIZE ((HEADER_LEN + 3) & ~3)
+
+/* records per datagram */
+#if TRACE_SIZE < 64
+#define TRACE_UDP_RECS TRACE_SIZE
+#else
+#define TRACE_UDP_RECS 64
+#endif
+
+/* the http header is stored right-aligned in front of the ring,
+ * so the whole response is one contiguous block sent without copying */
+static struct
+{
+	char           http[HEADER_SIZE];
+	trace_header_t hdr;
+	trace_rec_t    ring[TRACE_SIZE];
+} image;
+
+static volatile uint32_t head = 0;
+static struct udp_pcb *pcb = NULL;
+
+void trace_init(void)
+{
+	int i;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	memcpy(image.http + HEADER_SIZE - HEADER_LEN, TRACE_HTTP_HEADER, HEADER_LEN);
+	image.hdr.magic = TRACE_MAGIC;
+	image.hdr.head = 0;
+	image.hdr.size = TRACE_SIZE;
+	image.hdr.events = TRACE_COUNT;
+	image.hdr.clock = SystemCoreClock;
+	for (i = 0; i < TRACE_SIZE; i++)
+		image.ring[i].tag = TRACE_TAG_INVALID;
+	head = 0;
+}
+
+/* The slot is reserved by LDREX/STREX, so records never mix. A reader
+ * may see a record being written: its tag is invalid until completion. */
+void trace(trace_id_t id, uint32_t arg0, uint32_t arg1)
+{
+	uint32_t i;
+	trace_rec_t *r;
+
+	do
+		i = __LDREXW(&head);
+	while (__STREXW(i + 1, &head) != 0);
+
+	r = &image.ring[i & (TRACE_SIZE - 1)];
+	r->tag = TRACE_TAG_INVALID;
+	r->time = DWT->CYCCNT;
+	r->arg0 = arg0;
+	r->arg1 = arg1;
+	r->tag = (uint32_t)id | (i << 16);
+}
+
+/* tracing goes on while the ring is sent, records written meanwhile
+ * are told apart by their tags */
+const char *trace_open(int *len)
+{
+	if (image.hdr.magic != TRACE_MAGIC)
+		return NULL;
+	image.hdr.head = head;
+	*len = HEADER_LEN + sizeof(trace_header_t) + sizeof(image.ring);
+	return image.http + HEADER_SIZE - HEADER_LEN;
+}
+
+void trace_close(void)
+{
+}
+
+static void udp_recv_proc(void *arg, struct udp_pcb *upcb, struct pbuf *p, struct ip_addr *addr, u16_t port)
+{
+	trace_header_t hdr;
+	uint32_t first;
+	uint32_t request;
+	struct pbuf *out;
+	uint8_t *ptr;
+	err_t err;
+
+	/* a reply is many times larger than the request, answer only
+	 * the request of tracedump.py */
+	request = 0;
+	if (p->tot_len == sizeof(request))
+		pbuf_copy_partial(p, &request, sizeof(request), 0);
+	pbuf_free(p);
+	if (request != TRACE_REQUEST) return;
+	hdr = image.hdr;
+	hdr.head = head;
+	for (first = 0; first < TRACE_SIZE; first += TRACE_UDP_RECS)
+	{
+		out = pbuf_alloc(PBUF_TRANSPORT, sizeof(hdr) + sizeof(first) + TRACE_UDP_RECS * sizeof(trace_rec_t), PBUF_RAM);
+		if (out == NULL) return;
+		ptr = (uint8_t *)out->payload;
+		memcpy(ptr, &hdr, sizeof(hdr));
+		ptr += sizeof(hdr);
+		memcpy(ptr, &first, sizeof(first));
+		ptr += sizeof(first);
+		memcpy(ptr, &image.ring[first], TRACE_UDP_RECS * sizeof(trace_rec_t));
+		err = udp_sendto(upcb, out, addr, port);
+		pbuf_free(out);
+		if (err != ERR_OK) return;
+	}
+}
+
+err_t trace_udp_init(uint16_t port)
+{
+	err_t err;
+
+	if (pcb != NULL)
+		udp_remove(pcb);
+	pcb = udp_new();
+	if (pcb == NULL)
+		return ERR_MEM;
+	err = udp_bind(pcb, IP_ADDR_ANY, port);
+	if (err != ERR_OK)
+	{
+		udp_remove(pcb);
+		pcb = NULL;
+		return err;
+	}
+	udp_recv(pcb, udp_recv_proc, NULL);
+	return ERR_OK;
+}
@@ -0,0 +1,104 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   binary trace ring with host side formatting
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include "stm32f4xx.h"
+#include "lwip/err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* set to 0 to compile all trace points out */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE 1
+#endif
+
+#ifndef TRACE_SIZE
+#define TRACE_SIZE 256            /* records in the ring, power of 2 */
+#endif
+
+#ifndef TRACE_UDP_PORT
+#define TRACE_UDP_PORT 7777
+#endif
+
+#define TRACE_MAGIC 0x45435254    /* "TRCE" */
+#define TRACE_REQUEST 0x51435254  /* "TRCQ", the only datagram the udp port answers */
+#define TRACE_TAG_INVALID 0xFFFFFFFF
+
+typedef enum
+{
+#define TRACE_EVENT(id, fmt) id,
+#include "trace_events.h"
+#undef TRACE_EVENT
+	TRACE_COUNT
+} trace_id_t;
+
+typedef struct
+{
+	uint32_t time;    /* DWT cycle counter */
+	uint32_t arg0;
+	uint32_t arg1;
+	uint32_t tag;     /* event id | (record index & 0xFFFF) << 16, written last */
+} trace_rec_t;
+
+/* image layout: http header, trace_header_t, trace_rec_t ring[size]
+ * udp datagram: trace_header_t, uint32_t first slot, trace_rec_t[] */
+
+typedef struct
+{
+	uint32_t magic;   /* TRACE_MAGIC */
+	uint32_t head;    /* index of the next record at the time of reading */
+	uint16_t size;    /* ring size, records */
+	uint16_t events;  /* TRACE_COUNT */
+	uint32_t clock;   /* time units per second */
+} trace_header_t;
+
+/* trace functions */
+
+void  trace_init(void);                    /* clear the ring */
+void  trace(trace_id_t id, uint32_t arg0, uint32_t arg1); /* safe from any context */
+const char *trace_open(int *len);          /* returns the http image */
+void  trace_close(void);
+err_t trace_udp_init(uint16_t port);       /* any datagram to the port is answered with the ring */
+
+#if TRACE_ENABLE
+#define TRACE(id, arg0, arg1) trace(id, (uint32_t)(arg0), (uint32_t)(arg1))
+#else
+#define TRACE(id, arg0, arg1) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
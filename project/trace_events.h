@@ -0,0 +1,20 @@
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   trace event list
+ *
+ * TRACE_EVENT(id, format) - format takes up to two %u/%x/%d conversions
+ * for arg0 and arg1. Format strings are not compiled into the firmware,
+ * tools/tracedict.py extracts them into the host side dictionary, so the
+ * order of the events must match between firmware and dictionary.
+ */
+
+TRACE_EVENT(TR_RNDIS_RX,      "rndis rx: frame %u bytes")
+TRACE_EVENT(TR_RNDIS_RX_BAD,  "rndis rx: bad message, %u bytes")
+TRACE_EVENT(TR_RNDIS_TX,      "rndis tx: frame %u bytes")
+TRACE_EVENT(TR_RNDIS_TX_DONE, "rndis tx: complete")
+TRACE_EVENT(TR_RX_OVERRUN,    "rx overrun: frame %u bytes dropped, %u bytes pending")
+TRACE_EVENT(TR_USB_POLL,      "usb_polling: dequeue %u bytes")
+TRACE_EVENT(TR_RX_NOMEM,      "usb_polling: no pbuf for %u bytes")
+TRACE_EVENT(TR_TCP_INPUT,     "tcp_input: %u bytes")
+TRACE_EVENT(TR_LINKOUTPUT,    "linkoutput: %u bytes, waited %u ms")
+TRACE_EVENT(TR_LINK_BUSY,     "linkoutput: tx busy, %u bytes dropped")
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Maps the /prof histogram of the device to symbols of a linker map.
+
+usage: prof.py [-u URL | -f FILE] [-n TOP] MAPFILE
+
+MAPFILE is either the Keil listing (cpufw.map) or a GNU ld map (-Map=).
+Bucket counts are split between the symbols covering the bucket in
+proportion to the overlapped bytes.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import urllib.request
+
+PROF_MAGIC = 0x464F5250
+HEADER = struct.Struct('<IIHHIIIIHH')
+
+# Keil: "    tcp_input    0x08001235   Thumb Code   1234  tcp_in.o(.text)"
+KEIL_SYM = re.compile(r'^\s+(\S+)\s+0x([0-9a-fA-F]{8})\s+(?:Thumb|ARM) Code\s+(\d+)\s+(\S+)')
+# GNU ld: " .text.tcp_input  0x08001234  0x4d2 tcp_in.o" (name may be on its own line)
+GNU_SECT = re.compile(r'^\s*\.text\.(\S+)\s*$|^\s*\.text\.(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)')
+GNU_CONT = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)')
+
+
+def load_map(path):
+    syms = []
+    pending = None
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = KEIL_SYM.match(line)
+            if m:
+                addr = int(m.group(2), 16) & ~1
+                syms.append((addr, int(m.group(3)), m.group(1), m.group(4)))
+                continue
+            m = GNU_SECT.match(line)
+            if m:
+                if m.group(1):
+                    pending = m.group(1)
+                    continue
+                syms.append((int(m.group(3), 16), int(m.group(4), 16), m.group(2), m.group(5)))
+                pending = None
+                continue
+            if pending:
+                m = GNU_CONT.match(line)
+                if m:
+                    syms.append((int(m.group(1), 16), int(m.group(2), 16), pending, m.group(3)))
+                pending = None
+    syms = sorted(set(s for s in syms if s[1] > 0))
+    return syms
+
+
+def load_prof(data):
+    start = data.find(b'\r\n\r\n')
+    if start >= 0 and data.startswith(b'HTTP/'):
+        data = data[start + 4:]
+    magic, base, shift, buckets, rate, samples, outside, ram_base, ram_buckets, _ = HEADER.unpack_from(data)
+    if magic != PROF_MAGIC:
+        sys.exit('not a profiler image')
+    hist = struct.unpack_from('<%dH' % buckets, data, HEADER.size)
+    # (address of the first bucket, counts) of the flash and the SRAM code
+    ranges = [(base, hist[:buckets - ram_buckets]), (ram_base, hist[buckets - ram_buckets:])]
+    return shift, rate, samples, outside, ranges
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('-u', '--url', default='http://192.168.7.1/prof')
+    ap.add_argument('-f', '--file', help='read a saved image instead of the device')
+    ap.add_argument('-n', '--top', type=int, default=30)
+    ap.add_argument('map')
+    args = ap.parse_args()
+
+    if args.file:
+        with open(args.file, 'rb') as f:
+            data = f.read()
+    else:
+        data = urllib.request.urlopen(args.url, timeout=5).read()
+    shift, rate, samples, outside, ranges = load_prof(data)
+    syms = load_map(args.map)
+
+    size = 1 << shift
+    buckets = [(base + i * size, count) for base, hist in ranges for i, count in enumerate(hist)]
+    found = {}
+    unknown = 0.0
+    j = 0
+    for lo, count in buckets:
+        if count == 0:
+            continue
+        hi = lo + size
+        while j < len(syms) and syms[j][0] + syms[j][1] <= lo:
+            j += 1
+        covered = 0
+        k = j
+        while k < len(syms) and syms[k][0] < hi:
+            a, n, name, obj = syms[k]
+            part = min(hi, a + n) - max(lo, a)
+            if part > 0:
+                found[(name, obj)] = found.get((name, obj), 0.0) + count * part / size
+                covered += part
+            k += 1
+        unknown += count * (size - covered) / size
+
+    total = float(max(samples, 1))
+    print('%d samples at %d Hz, %d outside of %s' % (samples, rate, outside,
+          ', '.join('0x%08X..0x%08X' % (base, base + len(hist) * size) for base, hist in ranges)))
+    if max(count for lo, count in buckets) == 0xFFFF:
+        print('warning: some buckets are saturated, reset the profiler more often')
+    print('%8s %6s  %s' % ('samples', '%', 'symbol'))
+    top = sorted(found.items(), key=lambda x: -x[1])[:args.top]
+    for (name, obj), count in top:
+        print('%8.0f %6.2f  %s (%s)' % (count, 100.0 * count / total, name, obj))
+    if unknown:
+        print('%8.0f %6.2f  <no symbol>' % (unknown, 100.0 * unknown / total))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Prints memory usage of the firmware image by region.
+
+usage: size_report.py [-n TOP] cpufw.axf|cpufw.elf
+
+Works with the Keil .axf and GCC .elf. Flash usage is the size of all
+load images (including code and data copied to RAM at startup), RAM and
+CCM usage is the execution size of the sections placed there.
+"""
+
+import argparse
+import struct
+import sys
+
+REGIONS = [
+    ('FLASH', 0x08000000, 0xE0000),   # sector 11 holds the lease log
+    ('SRAM',  0x20000000, 0x20000),
+    ('CCM',   0x10000000, 0x10000),
+]
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 2
+SHF_EXECINSTR = 4
+PT_LOAD = 1
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+def region_of(addr):
+    for name, start, size in REGIONS:
+        if start <= addr < start + size:
+            return name
+    return None
+
+
+class Elf:
+    def __init__(self, data):
+        if data[:4] != b'\x7fELF':
+            sys.exit('not an ELF file')
+        self.data = data
+        self.is64 = data[4] == 2
+        end = '<' if data[5] == 1 else '>'
+        if self.is64:
+            hdr = struct.unpack_from(end + 'HHIQQQIHHHHHH', data, 16)
+            self.ehdr = dict(phoff=hdr[4], shoff=hdr[5], phentsize=hdr[8], phnum=hdr[9],
+                             shentsize=hdr[10], shnum=hdr[11], shstrndx=hdr[12])
+            self.phdr = struct.Struct(end + 'IIQQQQQQ')
+            self.shdr = struct.Struct(end + 'IIQQQQIIQQ')
+            self.sym = struct.Struct(end + 'IBBHQQ')
+        else:
+            hdr = struct.unpack_from(end + 'HHIIIIIHHHHHH', data, 16)
+            self.ehdr = dict(phoff=hdr[4], shoff=hdr[5], phentsize=hdr[8], phnum=hdr[9],
+                             shentsize=hdr[10], shnum=hdr[11], shstrndx=hdr[12])
+            self.phdr = struct.Struct(end + 'IIIIIIII')
+            self.shdr = struct.Struct(end + 'IIIIIIIIII')
+            self.sym = struct.Struct(end + 'IIIBBH')
+
+    def segments(self):
+        e = self.ehdr
+        for i in range(e['phnum']):
+            f = self.phdr.unpack_from(self.data, e['phoff'] + i * e['phentsize'])
+            if self.is64:
+                ptype, flags, off, vaddr, paddr, filesz, memsz, align = f
+            else:
+                ptype, off, vaddr, paddr, filesz, memsz, flags, align = f
+            yield ptype, vaddr, paddr, filesz, memsz
+
+    def sections(self):
+        e = self.ehdr
+        raw = [self.shdr.unpack_from(self.data, e['shoff'] + i * e['shentsize']) for i in range(e['shnum'])]
+        strtab = raw[e['shstrndx']]
+        for s in raw:
+            name = self.cstr(strtab[4] + s[0])
+            # name, type, flags, addr, offset, size, link
+            yield name, s[1], s[2], s[3], s[4], s[5], s[6]
+
+    def cstr(self, off):
+        return self.data[off:self.data.index(b'\0', off)].decode('latin-1')
+
+    def symbols(self):
+        secs = list(self.sections())
+        for name, stype, flags, addr, off, size, link in secs:
+            if stype != SHT_SYMTAB:
+                continue
+            stroff = secs[link][4]
+            for i in range(size // self.sym.size):
+                f = self.sym.unpack_from(self.data, off + i * self.sym.size)
+                if self.is64:
+                    sname, info, other, shndx, value, ssize = f
+                else:
+                    sname, value, ssize, info, other, shndx = f
+                if info & 0xF in (STT_OBJECT, STT_FUNC) and ssize > 0:
+                    yield self.cstr(stroff + sname), value & ~1, ssize
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('-n', '--top', type=int, default=10, help='largest symbols per region')
+    ap.add_argument('image')
+    args = ap.parse_args()
+
+    with open(args.image, 'rb') as f:
+        elf = Elf(f.read())
+
+    used = dict((r[0], 0) for r in REGIONS)
+    for ptype, vaddr, paddr, filesz, memsz in elf.segments():
+        if ptype != PT_LOAD:
+            continue
+        if region_of(paddr) == 'FLASH' and filesz:
+            used['FLASH'] += filesz
+        r = region_of(vaddr)
+        if r and r != 'FLASH':
+            used[r] += memsz
+
+    print('%-6s %10s %10s %10s %6s' % ('region', 'start', 'used', 'size', '%'))
+    for name, start, size in REGIONS:
+        print('%-6s 0x%08X %10d %10d %5.1f%%' % (name, start, used[name], size, 100.0 * used[name] / size))
+
+    print('\n%-6s %-24s %10s %10s' % ('region', 'section', 'address', 'size'))
+    for name, stype, flags, addr, off, size, link in elf.sections():
+        if not flags & SHF_ALLOC or size == 0:
+            continue
+        kind = 'code' if flags & SHF_EXECINSTR else ('zero' if stype == SHT_NOBITS else 'data')
+        print('%-6s %-24s 0x%08X %10d  %s' % (region_of(addr) or '?', name, addr, size, kind))
+
+    syms = {}
+    for sname, value, size in elf.symbols():
+        r = region_of(value)
+        if r:
+            syms.setdefault(r, set()).add((size, sname))
+    for name, start, size in REGIONS:
+        if name not in syms:
+            continue
+        print('\nlargest in %s:' % name)
+        for ssize, sname in sorted(syms[name], reverse=True)[:args.top]:
+            print('%10d  %s' % (ssize, sname))
+
+
+if __name__ == '__main__':
+    main()
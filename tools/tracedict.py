@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Extracts trace format strings from trace_events.h into a dictionary.
+
+usage: tracedict.py trace_events.h [output.json]
+
+Runs as the after-build step of the Keil project, the dictionary is
+written next to cpufw.axf and used by tracedump.py.
+"""
+
+import json
+import re
+import sys
+
+EVENT = re.compile(r'TRACE_EVENT\s*\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+COMMENT = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+
+
+def unescape(s):
+    return s.encode('latin-1').decode('unicode_escape')
+
+
+def extract(path):
+    with open(path) as f:
+        text = COMMENT.sub('', f.read())
+    return [{'id': i, 'name': m.group(1), 'format': unescape(m.group(2))}
+            for i, m in enumerate(EVENT.finditer(text))]
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    events = extract(sys.argv[1])
+    text = json.dumps({'events': events}, indent=1)
+    if len(sys.argv) > 2:
+        with open(sys.argv[2], 'w') as f:
+            f.write(text)
+    else:
+        print(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Reads the trace ring of the device and formats it on the host.
+
+usage: tracedump.py [-u URL | -p HOST[:PORT] | -f FILE] DICT
+
+DICT is the dictionary made by tracedict.py (cpufw.trace.json).
+The ring is read from /trace by http (default), from the trace udp
+port (-p) or from a saved /trace image (-f).
+"""
+
+import argparse
+import json
+import re
+import socket
+import struct
+import sys
+import urllib.request
+
+TRACE_MAGIC = 0x45435254
+TRACE_REQUEST = 0x51435254
+TAG_INVALID = 0xFFFFFFFF
+HEADER = struct.Struct('<IIHHI')
+RECORD = struct.Struct('<IIII')
+CONV = re.compile(r'%[-+ #0]*\d*([diuxXc%])')
+
+
+def read_http(url):
+    data = urllib.request.urlopen(url, timeout=5).read()
+    start = data.find(b'\r\n\r\n')
+    if data.startswith(b'HTTP/') and start >= 0:
+        data = data[start + 4:]
+    return parse_image(data)
+
+
+def parse_image(data):
+    magic, head, size, events, clock = HEADER.unpack_from(data)
+    if magic != TRACE_MAGIC:
+        sys.exit('not a trace image')
+    recs = {}
+    for slot in range(size):
+        recs[slot] = RECORD.unpack_from(data, HEADER.size + slot * RECORD.size)
+    return head, size, events, clock, recs
+
+
+def read_udp(addr):
+    host, _, port = addr.partition(':')
+    port = int(port or 7777)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(1.0)
+    sock.sendto(struct.pack('<I', TRACE_REQUEST), (host, port))
+    recs = {}
+    head = size = events = clock = None
+    try:
+        while size is None or len(recs) < size:
+            data = sock.recv(65536)
+            magic, h, size, events, clock = HEADER.unpack_from(data)
+            if magic != TRACE_MAGIC:
+                continue
+            head = h if head is None else head
+            first, = struct.unpack_from('<I', data, HEADER.size)
+            n = (len(data) - HEADER.size - 4) // RECORD.size
+            for k in range(n):
+                recs[first + k] = RECORD.unpack_from(data, HEADER.size + 4 + k * RECORD.size)
+    except socket.timeout:
+        if size is None:
+            sys.exit('no answer from %s:%d' % (host, port))
+    return head, size, events, clock, recs
+
+
+def order(head, size, recs):
+    """Returns valid records sorted by their write index."""
+    out = []
+    for slot, (time, arg0, arg1, tag) in recs.items():
+        if tag == TAG_INVALID:
+            continue
+        seq = tag >> 16
+        if seq & (size - 1) != slot:
+            continue
+        delta = (seq - head) & 0xFFFF
+        index = head + delta if delta < 0x8000 else head + delta - 0x10000
+        if index < 0 or index < head - size:
+            continue
+        out.append((index, tag & 0xFFFF, time, arg0, arg1))
+    out.sort()
+    return out
+
+
+def format_event(fmt, arg0, arg1):
+    args = []
+    for conv in CONV.findall(fmt):
+        if conv == '%':
+            continue
+        value = (arg0, arg1)[len(args)] if len(args) < 2 else 0
+        if conv in 'di' and value >= 0x80000000:
+            value -= 0x100000000
+        args.append(value)
+    try:
+        return fmt % tuple(args)
+    except (TypeError, ValueError):
+        return fmt + ' %u %u' % (arg0, arg1)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('-u', '--url', default='http://192.168.7.1/trace')
+    ap.add_argument('-p', '--udp', help='read by udp from HOST[:PORT]')
+    ap.add_argument('-f', '--file', help='read a saved /trace image')
+    ap.add_argument('dict')
+    args = ap.parse_args()
+
+    with open(args.dict) as f:
+        events = json.load(f)['events']
+    if args.file:
+        with open(args.file, 'rb') as f:
+            data = f.read()
+        start = data.find(b'\r\n\r\n')
+        if data.startswith(b'HTTP/') and start >= 0:
+            data = data[start + 4:]
+        head, size, count, clock, recs = parse_image(data)
+    elif args.udp:
+        head, size, count, clock, recs = read_udp(args.udp)
+    else:
+        head, size, count, clock, recs = read_http(args.url)
+    if count != len(events):
+        print('warning: firmware has %d events, dictionary has %d' % (count, len(events)))
+
+    # cycle counter wraps, the time is accumulated from deltas
+    t = 0
+    prev = None
+    for index, ev, time, arg0, arg1 in order(head, size, recs):
+        if prev is not None:
+            t += (time - prev) & 0xFFFFFFFF
+        prev = time
+        if ev < len(events):
+            name, text = events[ev]['name'], format_event(events[ev]['format'], arg0, arg1)
+        else:
+            name, text = 'EVENT_%d' % ev, '%u %u' % (arg0, arg1)
+        print('%8d %14.3f us  %-16s %s' % (index, t * 1e6 / clock, name, text))
+
+
+if __name__ == '__main__':
+    main()
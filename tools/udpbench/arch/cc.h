@@ -0,0 +1,43 @@
+/*
+ * Host port of lwIP for udpbench. The device port (lrndis/lwip-1.4.1/
+ * src/include/arch/cc.h) uses unsigned long for u32_t, which is 64 bits
+ * wide on a 64-bit host.
+ */
+#ifndef __CC_H__
+#define __CC_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef BYTE_ORDER
+#define BYTE_ORDER LITTLE_ENDIAN
+#endif
+
+typedef uint8_t   u8_t;
+typedef int8_t    s8_t;
+typedef uint16_t  u16_t;
+typedef int16_t   s16_t;
+typedef uint32_t  u32_t;
+typedef int32_t   s32_t;
+typedef uintptr_t mem_ptr_t;
+
+#define U16_F "hu"
+#define S16_F "hd"
+#define X16_F "hx"
+#define U32_F "u"
+#define S32_F "d"
+#define X32_F "x"
+#define SZT_F "zu"
+
+#define PACK_STRUCT_BEGIN
+#define PACK_STRUCT_STRUCT __attribute__ ((__packed__))
+#define PACK_STRUCT_END
+#define PACK_STRUCT_FIELD(x) x
+
+#define LWIP_PLATFORM_DIAG(x) do { printf x; } while(0)
+#define LWIP_PLATFORM_ASSERT(x) do { fprintf(stderr, "assertion \"%s\" failed at %s:%d\n", x, __FILE__, __LINE__); abort(); } while(0)
+
+#define LWIP_RAND() ((u32_t)rand())
+
+#endif /* __CC_H__ */
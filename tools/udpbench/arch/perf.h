@@ -0,0 +1,22 @@
+/*
+ * Host port of lwIP for udpbench: the device probes, trace points and
+ * latency stamps compile to nothing.
+ */
+#ifndef __PERF_H__
+#define __PERF_H__
+
+#define PERF_START    /* null definition */
+#define PERF_STOP(x)  /* null definition */
+
+#define PROBE_BEGIN(id) ((void)0)
+#define PROBE_END(id)   ((void)0)
+#define TRACE(id, arg0, arg1) ((void)0)
+
+#define LAT_RX_DONE()  ((void)0)
+#define LAT_DEQUEUE()  ((void)0)
+#define LAT_APP(app)   ((void)0)
+#define LAT_TX()       ((void)0)
+#define LAT_TX_DONE()  ((void)0)
+#define LAT_END()      ((void)0)
+
+#endif /* __PERF_H__ */
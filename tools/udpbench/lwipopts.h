@@ -0,0 +1,37 @@
+/*
+ * lwIP options of the host build of udpbench: UDP only, no timers, the
+ * heap sized as on the device, statistics on for allocation counts.
+ */
+#ifndef __LWIPOPTS_H__
+#define __LWIPOPTS_H__
+
+#define NO_SYS                          1
+#define NO_SYS_NO_TIMERS                1
+#define MEM_ALIGNMENT                   8
+#define MEM_SIZE                        10000
+#ifndef MEM_LIBC_MALLOC                 /* make asan: pbufs on malloc, overruns are caught */
+#define MEM_LIBC_MALLOC                 0
+#endif
+#define LWIP_RAW                        0
+#define LWIP_NETCONN                    0
+#define LWIP_SOCKET                     0
+#define LWIP_ARP                        0
+#define LWIP_DHCP                       0
+#define LWIP_DNS                        0
+#define LWIP_ICMP                       0
+#define LWIP_IGMP                       0
+#define LWIP_UDP                        1
+#define LWIP_TCP                        0
+#define IP_REASSEMBLY                   0
+#define IP_FRAG                         0
+
+#define LWIP_STATS                      1
+#define MEM_STATS                       1
+#define MEMP_STATS                      1
+#define LINK_STATS                      0
+#define IP_STATS                        0
+#define UDP_STATS                       1
+#define SYS_STATS                       0
+#define LWIP_STATS_DISPLAY              0
+
+#endif /* __LWIPOPTS_H__ */
@@ -0,0 +1,619 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 by Sergey Fetisov <fsenok@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * version: 1.0 demo (7.02.2015)
+ * brief:   host load generator and benchmark of dhserver and dnserver
+ *
+ * The servers run unchanged on the host lwIP UDP stack. A loopback netif
+ * queues every packet sent by the stack and feeds it back to ip_input,
+ * so requests of the synthetic clients and the replies of the servers
+ * go through udp_input/udp_sendto as on the device. sys_now() is a
+ * virtual clock advanced by the harness to age leases.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/ip.h"
+#include "lwip/udp.h"
+#include "lwip/stats.h"
+#include "dhserver.h"
+#include "dnserver.h"
+
+#define QUEUE_SIZE 64
+#define SERVER_IP  0x0107A8C0 /* 192.168.7.1, network order */
+
+/* virtual clock */
+
+static u32_t now_ms = 1;
+
+u32_t sys_now(void)
+{
+	return now_ms;
+}
+
+/* allocation counters, pbuf_alloc and mem_malloc are wrapped by the
+ * linker; allocations of the harness itself are not counted */
+
+static int harness;
+static unsigned long n_pbuf_alloc;
+static unsigned long n_mem_malloc;
+
+struct pbuf *__real_pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type);
+void *__real_mem_malloc(mem_size_t size);
+
+struct pbuf *__wrap_pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
+{
+	if (!harness) n_pbuf_alloc++;
+	return __real_pbuf_alloc(layer, length, type);
+}
+
+#if !MEM_LIBC_MALLOC
+void *__wrap_mem_malloc(mem_size_t size)
+{
+	if (!harness) n_mem_malloc++;
+	return __real_mem_malloc(size);
+}
+#endif
+
+/* loopback netif */
+
+static struct netif lo;
+static struct pbuf *queue[QUEUE_SIZE];
+static int queue_len;
+static unsigned long queue_drops;
+
+static err_t lo_output(struct netif *netif, struct pbuf *p, ip_addr_t *addr)
+{
+	struct pbuf *q;
+	if (queue_len == QUEUE_SIZE)
+	{
+		queue_drops++;
+		return ERR_MEM;
+	}
+	harness++;
+	q = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_RAM);
+	harness--;
+	if (q == NULL)
+	{
+		queue_drops++;
+		return ERR_MEM;
+	}
+	pbuf_copy(q, p);
+	queue[queue_len++] = q;
+	return ERR_OK;
+}
+
+static err_t lo_init(struct netif *netif)
+{
+	netif->mtu = 1500;
+	netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_LINK_UP | NETIF_FLAG_UP;
+	netif->name[0] = 'l';
+	netif->name[1] = 'o';
+	netif->output = lo_output;
+	return ERR_OK;
+}
+
+/* delivers queued packets until the stack is quiet */
+static void pump(void)
+{
+	int i, n;
+	struct pbuf *batch[QUEUE_SIZE];
+	while (queue_len > 0)
+	{
+		n = queue_len;
+		memcpy(batch, queue, n * sizeof(batch[0]));
+		queue_len = 0;
+		for (i = 0; i < n; i++)
+			ip_input(batch[i], &lo);
+	}
+}
+
+static struct pbuf *make_pbuf(const void *data, int len)
+{
+	struct pbuf *p;
+	harness++;
+	p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+	harness--;
+	if (p != NULL)
+		memcpy(p->payload, data, len);
+	return p;
+}
+
+static void send_to(struct udp_pcb *pcb, const void *data, int len, u32_t ip, u16_t port)
+{
+	ip_addr_t addr;
+	struct pbuf *p = make_pbuf(data, len);
+	if (p == NULL) return;
+	addr.addr = ip;
+	udp_sendto(pcb, p, &addr, port);
+	pbuf_free(p);
+	pump();
+}
+
+static double seconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static u32_t rnd_state = 12345;
+
+static u32_t rnd(void)
+{
+	rnd_state = rnd_state * 1103515245 + 12345;
+	return rnd_state >> 8;
+}
+
+/* dhcp client */
+
+#define DHCP_LEASES 254
+
+static dhcp_pool_t pools[] =
+{
+	{ {192, 168, 7, 2}, DHCP_LEASES, {255, 255, 255, 0}, 24 * 60 * 60, {0, 0, 0, 0}, 1500, 0, NULL }
+};
+
+static dhcp_lease_t leases[DHCP_LEASES];
+
+static dhcp_config_t dhcp_config =
+{
+	{192, 168, 7, 1}, 67,
+	{192, 168, 7, 1},
+	"stm",
+	1, pools,
+	DHCP_LEASES, leases,
+	NULL
+};
+
+typedef struct
+{
+	int type;       /* message type of the last reply, 0 if none */
+	u32_t yiaddr;
+	int replies;
+} dhcp_reply_t;
+
+static struct udp_pcb *dhcp_client;
+static dhcp_reply_t dhcp_reply;
+
+static void dhcp_client_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, ip_addr_t *addr, u16_t port)
+{
+	uint8_t msg[576];
+	int i, len;
+	len = pbuf_copy_partial(p, msg, sizeof(msg), 0);
+	pbuf_free(p);
+	dhcp_reply.replies++;
+	if (len < 240 || msg[0] != 2) return;
+	memcpy(&dhcp_reply.yiaddr, msg + 16, 4);
+	for (i = 240; i + 1 < len && msg[i] != 255; i += msg[i] == 0 ? 1 : msg[i + 1] + 2)
+		if (msg[i] == 53)
+			dhcp_reply.type = msg[i + 2];
+}
+
+/* builds a client message, returns its length */
+static int dhcp_message(uint8_t *msg, int type, const uint8_t *mac, u32_t request, bool rapid)
+{
+	uint8_t *ptr;
+	static const uint8_t prl[] = {1, 3, 6, 15, 26, 121, 249};
+	memset(msg, 0, 240);
+	msg[0] = 1;
+	msg[1] = 1;
+	msg[2] = 6;
+	memcpy(msg + 4, mac, 4); /* xid */
+	memcpy(msg + 28, mac, 6);
+	msg[236] = 0x63; msg[237] = 0x82; msg[238] = 0x53; msg[239] = 0x63;
+	ptr = msg + 240;
+	*ptr++ = 53; *ptr++ = 1; *ptr++ = type;
+	if (type == 7)
+		memcpy(msg + 12, &request, 4); /* ciaddr */
+	else if (request != 0)
+	{
+		*ptr++ = 50; *ptr++ = 4;
+		memcpy(ptr, &request, 4);
+		ptr += 4;
+	}
+	if (type == 3)
+	{
+		*ptr++ = 54; *ptr++ = 4;
+		memcpy(ptr, dhcp_config.addr, 4);
+		ptr += 4;
+	}
+	if (rapid)
+	{
+		*ptr++ = 80; *ptr++ = 0;
+	}
+	*ptr++ = 55; *ptr++ = sizeof(prl);
+	memcpy(ptr, prl, sizeof(prl));
+	ptr += sizeof(prl);
+	*ptr++ = 255;
+	return ptr - msg;
+}
+
+static int dhcp_send(int type, const uint8_t *mac, u32_t request, bool rapid)
+{
+	uint8_t msg[300];
+	int len = dhcp_message(msg, type, mac, request, rapid);
+	memset(&dhcp_reply, 0, sizeof(dhcp_reply));
+	send_to(dhcp_client, msg, len, 0xFFFFFFFF, 67);
+	return dhcp_reply.type;
+}
+
+static void make_mac(uint8_t *mac, int n)
+{
+	mac[0] = 0x02;
+	mac[1] = 0x00;
+	mac[2] = n >> 24;
+	mac[3] = n >> 16;
+	mac[4] = n >> 8;
+	mac[5] = n;
+}
+
+/* full DISCOVER/OFFER/REQUEST/ACK, returns the reply type of the REQUEST,
+ * the address is left in dhcp_reply.yiaddr */
+static int dora(int n, bool rapid)
+{
+	uint8_t mac[6];
+	int type;
+	make_mac(mac, n);
+	type = dhcp_send(1, mac, 0, rapid);
+	if (type != 2) return type; /* ACK if rapid, 0 if exhausted */
+	return dhcp_send(3, mac, dhcp_reply.yiaddr, false);
+}
+
+static void release(int n, u32_t addr)
+{
+	uint8_t mac[6];
+	make_mac(mac, n);
+	dhcp_send(7, mac, addr, false);
+}
+
+static void reset_counters(void)
+{
+	n_pbuf_alloc = 0;
+	n_mem_malloc = 0;
+	lwip_stats.mem.max = lwip_stats.mem.used;
+	lwip_stats.mem.err = 0;
+}
+
+static void report_allocs(unsigned long requests)
+{
+	printf("    allocs: %.2f pbuf_alloc, %.2f mem_malloc per request, heap peak %u of %u, %u failures\n",
+		(double)n_pbuf_alloc / requests, (double)n_mem_malloc / requests,
+		(unsigned)lwip_stats.mem.max, (unsigned)MEM_SIZE, (unsigned)lwip_stats.mem.err);
+}
+
+/* every client gets an address and releases it, the pool is shared by
+ * all of them; returns the number of ACKs */
+static int churn(int clients, int rounds, bool rapid)
+{
+	int i, r, acks, other;
+	double t;
+
+	reset_counters();
+	acks = other = 0;
+	t = seconds();
+	for (r = 0; r < rounds; r++)
+		for (i = 0; i < clients; i++)
+		{
+			if (dora(i, rapid) == 5)
+			{
+				acks++;
+				release(i, dhcp_reply.yiaddr);
+			}
+			else
+				other++;
+			now_ms += 10;
+		}
+	t = seconds() - t;
+	printf("  %s: %d ACK, %d failed; %.0f exchanges/s\n",
+		rapid ? "rapid commit" : "DORA", acks, other, (acks + other) / t);
+	report_allocs((rapid ? 2UL : 3UL) * (acks + other));
+	return acks;
+}
+
+static void bench_dhcp(int clients, int rounds)
+{
+	int i, acks, silent;
+
+	printf("dhcp: %d clients, pool of %d, %d rounds\n", clients, DHCP_LEASES, rounds);
+
+	/* 1. throughput */
+	churn(clients, rounds, false);
+	churn(clients, rounds, true);
+
+	/* 2. exhaustion: clients keep their addresses */
+	acks = silent = 0;
+	for (i = 0; i < clients; i++)
+		if (dora(clients + i, false) == 5) acks++; else silent++;
+	printf("  exhaustion: %d of %d clients got an address, %d no offer\n", acks, clients, silent);
+
+	/* 3. expired leases are reclaimed for new clients */
+	now_ms += 24 * 60 * 60 * 1000 + 1;
+	acks = 0;
+	for (i = 0; i < clients; i++)
+		if (dora(2 * clients + i, false) == 5) acks++;
+	printf("  after lease time: %d of %d new clients got an address\n", acks, clients);
+}
+
+/* dns client */
+
+static const dns_record_t dns_records[] =
+{
+	{ "1.7.168.192.in-addr.arpa", DNS_TYPE_PTR, {0},              "run.stm"     },
+	{ "_http._tcp.stm",           DNS_TYPE_SRV, {0},              "run.stm", 80 },
+	{ "run.stm",                  DNS_TYPE_A,   {192, 168, 7, 1}, NULL          },
+	{ "run.stm",                  DNS_TYPE_TXT, {0},              "path=/"      },
+	{ "www.run.stm",              DNS_TYPE_A,   {192, 168, 7, 1}, NULL          }
+};
+
+static const dns_zone_t dns_zone =
+{
+	"stm", "7.168.192.in-addr.arpa",
+	DNS_DEFAULT_TTL, 60,
+	sizeof(dns_records) / sizeof(dns_records[0]), dns_records
+};
+
+typedef struct
+{
+	const char *name;
+	uint16_t    type;
+	bool        edns;
+	const char *what;
+} dns_case_t;
+
+static const dns_case_t dns_mix[] =
+{
+	{ "run.stm",                  DNS_TYPE_A,    false, "A"        },
+	{ "WWW.Run.Stm",              DNS_TYPE_A,    false, "A, case"  },
+	{ "run.stm",                  DNS_TYPE_AAAA, false, "NODATA"   },
+	{ "nothing.stm",              DNS_TYPE_A,    false, "NXDOMAIN" },
+	{ "example.com",              DNS_TYPE_A,    false, "REFUSED"  },
+	{ "1.7.168.192.in-addr.arpa", DNS_TYPE_PTR,  false, "PTR"      },
+	{ "_http._tcp.stm",           DNS_TYPE_SRV,  true,  "SRV+EDNS" },
+	{ "run.stm",                  DNS_TYPE_ANY,  true,  "ANY+EDNS" }
+};
+
+#define NUM_DNS_MIX (sizeof(dns_mix) / sizeof(dns_mix[0]))
+
+static struct udp_pcb *dns_client;
+static int dns_replies;
+static int dns_rcode;
+static int dns_answers;
+
+static void dns_client_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, ip_addr_t *addr, u16_t port)
+{
+	uint8_t hdr[12];
+	if (pbuf_copy_partial(p, hdr, 12, 0) == 12)
+	{
+		dns_replies++;
+		dns_rcode = hdr[3] & 15;
+		dns_answers = (hdr[6] << 8) | hdr[7];
+	}
+	pbuf_free(p);
+}
+
+static int dns_query(uint8_t *msg, const dns_case_t *c, uint16_t id)
+{
+	const char *name, *dot;
+	uint8_t *ptr;
+	memset(msg, 0, 12);
+	msg[0] = id >> 8;
+	msg[1] = id;
+	msg[2] = 1;    /* rd */
+	msg[5] = 1;    /* one question */
+	msg[11] = c->edns;
+	ptr = msg + 12;
+	for (name = c->name; *name != 0; name = *dot ? dot + 1 : dot)
+	{
+		dot = strchr(name, '.');
+		if (dot == NULL) dot = name + strlen(name);
+		*ptr++ = dot - name;
+		memcpy(ptr, name, dot - name);
+		ptr += dot - name;
+	}
+	*ptr++ = 0;
+	*ptr++ = c->type >> 8; *ptr++ = c->type;
+	*ptr++ = 0; *ptr++ = 1;
+	if (c->edns)
+	{
+		static const uint8_t opt[] = {0, 0, 41, 0x10, 0, 0, 0, 0, 0, 0, 0};
+		memcpy(ptr, opt, sizeof(opt));
+		ptr += sizeof(opt);
+	}
+	return ptr - msg;
+}
+
+static void bench_dns(int queries)
+{
+	int i, j, len;
+	uint8_t msg[512];
+	double t;
+
+	printf("dns: %d queries per case\n", queries);
+	for (j = 0; j < NUM_DNS_MIX; j++)
+	{
+		len = dns_query(msg, &dns_mix[j], j);
+		reset_counters();
+		dns_replies = 0;
+		t = seconds();
+		for (i = 0; i < queries; i++)
+			send_to(dns_client, msg, len, SERVER_IP, 53);
+		t = seconds() - t;
+		printf("  %-9s %-26s rcode %d, %d answers, %d replies, %.0f queries/s\n",
+			dns_mix[j].what, dns_mix[j].name, dns_rcode, dns_answers, dns_replies, queries / t);
+		report_allocs(queries);
+	}
+}
+
+/* malformed input: mutated and truncated copies of valid messages */
+
+static void mutate(uint8_t *msg, int *len, int max)
+{
+	int i, n;
+	n = 1 + rnd() % 8;
+	for (i = 0; i < n; i++)
+		msg[rnd() % *len] = rnd();
+	switch (rnd() % 4)
+	{
+	case 0: *len = 1 + rnd() % *len; break;          /* truncated */
+	case 1: if (*len < max) msg[(*len)++] = rnd(); break;
+	}
+}
+
+/* crafted queries around the size limits, answered with FORMERR or dropped */
+
+typedef struct
+{
+	int         name_len;   /* octets of each question name */
+	int         n_question;
+	int         edns_size;  /* 0: no OPT record */
+	bool        bad;
+	const char *what;
+} dns_size_case_t;
+
+static const dns_size_case_t dns_size_mix[] =
+{
+	{ 256,  1, 0,    true,  "name of 256 octets"               },
+	{ 1150, 1, 0,    true,  "name of 1150 octets"              },
+	{ 250,  4, 0,    true,  "questions beyond 512 octets"      },
+	{ 244,  2, 512,  true,  "questions leave no room for OPT"  },
+	{ 255,  4, 1232, false, "EDNS, 1048 octets of questions"   }
+};
+
+#define NUM_DNS_SIZE_MIX (sizeof(dns_size_mix) / sizeof(dns_size_mix[0]))
+
+static int dns_size_query(uint8_t *msg, const dns_size_case_t *c)
+{
+	int i, n, rem;
+	uint8_t *ptr;
+	memset(msg, 0, 12);
+	msg[5] = c->n_question;
+	msg[11] = c->edns_size != 0;
+	ptr = msg + 12;
+	for (i = 0; i < c->n_question; i++)
+	{
+		for (rem = c->name_len - 1; rem > 0; rem -= n + 1)
+		{
+			n = rem - 1 > 63 ? 62 : rem - 1;
+			*ptr++ = n;
+			memset(ptr, 'a' + i, n);
+			ptr += n;
+		}
+		*ptr++ = 0;
+		*ptr++ = 0; *ptr++ = DNS_TYPE_A;
+		*ptr++ = 0; *ptr++ = 1;
+	}
+	if (c->edns_size != 0)
+	{
+		uint8_t opt[] = {0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0};
+		opt[3] = c->edns_size >> 8;
+		opt[4] = c->edns_size;
+		memcpy(ptr, opt, sizeof(opt));
+		ptr += sizeof(opt);
+	}
+	return ptr - msg;
+}
+
+static void bench_malformed(int count)
+{
+	int i, len, replies;
+	uint8_t msg[1400], mac[6];
+	static const uint8_t loop[] = /* question name pointing to itself */
+		{0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0xC0, 12, 0, 1, 0, 1};
+
+	printf("malformed: %d messages each\n", count);
+
+	dhcp_reply.replies = 0;
+	for (i = 0; i < count; i++)
+	{
+		make_mac(mac, i);
+		len = dhcp_message(msg, 1 + rnd() % 8, mac, 0, rnd() & 1);
+		mutate(msg, &len, sizeof(msg));
+		send_to(dhcp_client, msg, len, 0xFFFFFFFF, 67);
+	}
+	printf("  dhcp: %d replies\n", dhcp_reply.replies);
+
+	dns_replies = 0;
+	send_to(dns_client, loop, sizeof(loop), SERVER_IP, 53);
+	replies = dns_replies;
+	for (i = 0; i < count; i++)
+	{
+		len = dns_query(msg, &dns_mix[rnd() % NUM_DNS_MIX], i);
+		mutate(msg, &len, sizeof(msg));
+		send_to(dns_client, msg, len, SERVER_IP, 53);
+	}
+	printf("  dns: %d replies, pointer loop %s\n", dns_replies, replies ? "answered" : "dropped");
+
+	for (i = 0; i < NUM_DNS_SIZE_MIX; i++)
+	{
+		len = dns_size_query(msg, &dns_size_mix[i]);
+		replies = dns_replies;
+		dns_rcode = -1;
+		send_to(dns_client, msg, len, SERVER_IP, 53);
+		replies = dns_replies - replies;
+		printf("  %-32s %4d octets: %s", dns_size_mix[i].what, len, replies ? "rcode" : "dropped");
+		if (replies) printf(" %d", dns_rcode);
+		printf("%s\n", dns_size_mix[i].bad && replies && dns_rcode != 1 ? ", FAILED" : "");
+	}
+	printf("  heap in use after the run: %u bytes, %lu loopback drops\n",
+		(unsigned)lwip_stats.mem.used, queue_drops);
+}
+
+int main(int argc, char *argv[])
+{
+	ip_addr_t ip, mask, gw;
+	int clients = argc > 1 ? atoi(argv[1]) : 4096;
+	int rounds = argc > 2 ? atoi(argv[2]) : 4;
+	int queries = argc > 3 ? atoi(argv[3]) : 100000;
+
+	lwip_init();
+	ip.addr = SERVER_IP;
+	IP4_ADDR(&mask, 255, 255, 255, 0);
+	ip_addr_set_zero(&gw);
+	netif_add(&lo, &ip, &mask, &gw, NULL, lo_init, ip_input);
+	netif_set_default(&lo);
+	netif_set_up(&lo);
+
+	if (dhserv_init(&dhcp_config) != ERR_OK || dnserv_init(&ip, 53, &dns_zone) != ERR_OK)
+	{
+		printf("server init failed\n");
+		return 1;
+	}
+	dhcp_client = udp_new();
+	udp_bind(dhcp_client, IP_ADDR_ANY, 68);
+	udp_recv(dhcp_client, dhcp_client_recv, NULL);
+	dns_client = udp_new();
+	udp_bind(dns_client, IP_ADDR_ANY, 5300);
+	udp_recv(dns_client, dns_client_recv, NULL);
+
+	bench_dhcp(clients, rounds);
+	bench_dns(queries);
+	bench_malformed(queries);
+	return 0;
+}